@@ -8,3 +8,15 @@ CND_BASEDIR=`pwd`
 CND_ARTIFACT_DIR_default=dist/default/production
 CND_ARTIFACT_NAME_default=heartrate.X.production.hex
 CND_ARTIFACT_PATH_default=dist/default/production/heartrate.X.production.hex
+# size configuration
+CND_ARTIFACT_DIR_size=dist/size/production
+CND_ARTIFACT_NAME_size=heartrate.X.production.hex
+CND_ARTIFACT_PATH_size=dist/size/production/heartrate.X.production.hex
+# speed configuration
+CND_ARTIFACT_DIR_speed=dist/speed/production
+CND_ARTIFACT_NAME_speed=heartrate.X.production.hex
+CND_ARTIFACT_PATH_speed=dist/speed/production/heartrate.X.production.hex
+# mixed configuration
+CND_ARTIFACT_DIR_mixed=dist/mixed/production
+CND_ARTIFACT_NAME_mixed=heartrate.X.production.hex
+CND_ARTIFACT_PATH_mixed=dist/mixed/production/heartrate.X.production.hex
@@ -27,7 +27,9 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "app.h"
+#include "definitions.h"
 #include "system/console/sys_console.h"
 #include "app_usart_echo.h"
 // *****************************************************************************
@@ -53,6 +55,36 @@
 
 APP_DATA appData;
 
+/* Serial ports shown by the "uart" command, capacity functions are NULL for
+   ports without a ring buffer */
+typedef struct
+{
+    const char *name;
+
+    void (*statsGet)(SERCOM_USART_STATS *stats);
+
+    void (*statsReset)(void);
+
+    size_t (*rxSizeGet)(void);
+
+    size_t (*txSizeGet)(void);
+
+} APP_UART_PORT;
+
+static const APP_UART_PORT appUartPorts[] =
+{
+    { "sercom0 sensor", SERCOM0_USART_StatsGet, SERCOM0_USART_StatsReset, SERCOM0_USART_ReadBufferSizeGet, SERCOM0_USART_WriteBufferSizeGet },
+    { "sercom2 telemetry", SERCOM2_USART_StatsGet, SERCOM2_USART_StatsReset, NULL, NULL },
+    { "sercom3 console", SERCOM3_USART_StatsGet, SERCOM3_USART_StatsReset, SERCOM3_USART_ReadBufferSizeGet, SERCOM3_USART_WriteBufferSizeGet },
+};
+
+static void APP_UartCommand(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR appUartCmdTbl[] =
+{
+    {"uart", APP_UartCommand, ": show serial port buffer statistics, 'uart reset' clears them"},
+};
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Callback Functions
@@ -69,8 +101,52 @@ APP_DATA appData;
 // *****************************************************************************
 
 
-/* TODO:  Add any necessary local functions.
-*/
+/* Dropped receive bytes are lost, refused transmit bytes may have been retried */
+static void APP_UartDirectionPrint(SYS_CMD_DEVICE_NODE* pCmdIO, const char *direction, const char *overflow,
+                                   const SERCOM_USART_DIRECTION_STATS *stats, size_t (*sizeGet)(void))
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    if (sizeGet != NULL)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n  %s: %lu bytes, peak %lu of %lu, %lu %s", direction,
+            stats->byteCount, stats->peakCount, (uint32_t)sizeGet(), stats->overflowCount, overflow);
+    }
+    else
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n  %s: %lu bytes, largest transfer %lu, %lu %s", direction,
+            stats->byteCount, stats->peakCount, stats->overflowCount, overflow);
+    }
+}
+
+static void APP_UartCommand(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SERCOM_USART_STATS stats;
+    uint32_t port;
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0))
+    {
+        for (port = 0; port < (sizeof(appUartPorts) / sizeof(appUartPorts[0])); port++)
+        {
+            appUartPorts[port].statsReset();
+        }
+        return;
+    }
+
+    for (port = 0; port < (sizeof(appUartPorts) / sizeof(appUartPorts[0])); port++)
+    {
+        /* Taken before printing, the console statistics change while it prints */
+        appUartPorts[port].statsGet(&stats);
+
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s: %lu overruns, %lu framing/parity errors", appUartPorts[port].name,
+            stats.overrunCount, stats.errorCount);
+        APP_UartDirectionPrint(pCmdIO, "rx", "dropped", &stats.rx, appUartPorts[port].rxSizeGet);
+        APP_UartDirectionPrint(pCmdIO, "tx", "refused", &stats.tx, appUartPorts[port].txSizeGet);
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
 
 
 // *****************************************************************************
@@ -98,6 +174,7 @@ void APP_Initialize ( void )
      * parameters.
      */
     SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, "\r\nGetting Started to Heart Rate demo \r\n");
+    (void)SYS_CMD_ADDGRP(appUartCmdTbl, sizeof(appUartCmdTbl)/sizeof(*appUartCmdTbl), "uart", ": serial port commands");
     APP_HEART_RATE9_Initialize();
 }
 
@@ -93,6 +93,23 @@ typedef struct
 
 } APP_DATA;
 
+// *****************************************************************************
+/* Heart Rate Log Block Size
+
+  Summary:
+    Size of the records stored in the flash log.
+
+  Description:
+    Every record is a SYS_HRCODEC block of heart rate samples. The sample
+    timestamp is the RTC counter in seconds, the value the heart rate.
+
+  Remarks:
+    One record fills a flash page after the SYS_FLASHLOG page header. Drained
+    with SYS_FLASHLOG_IteratorNext and decoded with SYS_HRCODEC_DecoderGet.
+ */
+
+#define APP_HEARTRATE_LOG_BLOCK_SIZE    56U
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Callback Routines
@@ -84,6 +84,11 @@ APP_DATA appHeartRateData;
 #define RECEIVE_BUFFER_SIZE     (CLICK_HEARTRATE9_USART_READ_BUFFER_SIZE * 10)
 APP_HEART_RATE9_DATA app_heartrate_Data;
 void APP_HeartRateCallback (DRV_HANDLE handle, int heartrate );
+void APP_HeartRateSessionCallback (DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary );
+
+/* Flash log record being filled, stored when full or at the end of a window */
+static uint8_t appLogBlock[APP_HEARTRATE_LOG_BLOCK_SIZE];
+static SYS_HRCODEC_ENCODER appLogEncoder;
 
 
 /**
@@ -102,6 +107,15 @@ void APP_HeartRateCallback (DRV_HANDLE handle, int heartrate );
 // *****************************************************************************
 // *****************************************************************************
 
+static void APP_LogBlockStore(void)
+{
+    if (SYS_HRCODEC_EncoderFinish(&appLogEncoder) != 0U)
+    {
+        (void)SYS_FLASHLOG_Append(appLogBlock);
+    }
+    SYS_HRCODEC_EncoderInit(&appLogEncoder, appLogBlock, sizeof(appLogBlock));
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -120,6 +134,7 @@ void APP_HEART_RATE9_Initialize ( void )
 {
     /* Place the App state machine in its initial state. */
     app_heartrate_Data.state = APP_HEART_RATE9_STATE_INIT;
+    SYS_HRCODEC_EncoderInit(&appLogEncoder, appLogBlock, sizeof(appLogBlock));
     SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, startMessage);
 }
 
@@ -154,6 +169,7 @@ void APP_HEART_RATE9_Tasks ( void )
                 }
                  else
                  {
+                      DRV_HEARTRATE_SessionEventHandlerSet(appHeartRateData.drvHeartRatehandle, APP_HeartRateSessionCallback);
                       appHeartRateData.state = APP_STATE_SERVICE_TASKS;
                  }
                 
@@ -170,7 +186,7 @@ void APP_HEART_RATE9_Tasks ( void )
         case APP_STATE_ERROR:
 
         {
-            SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, "Un Error state !!! exiting !!!\r\n");
+            SYS_LOG_ERROR(SYS_LOG_MODULE_APP, "Un Error state !!! exiting !!!");
             break;
         }
 
@@ -187,10 +203,37 @@ void APP_HEART_RATE9_Tasks ( void )
 
 void APP_HeartRateCallback (DRV_HANDLE handle, int heartrate )
 {
+    SYS_HRCODEC_SAMPLE sample;
+    uint32_t profileStart;
+
     if(handle == appHeartRateData.drvHeartRatehandle)
-     SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, "Received new heartrate %d \r\n", heartrate);
+    {
+        SYS_LOG_INFO(SYS_LOG_MODULE_APP, "Received new heartrate %d", heartrate);
+
+        sample.timestamp = RTC_Timer32CounterGet() / RTC_TIMER32_FREQUENCY;
+        sample.value = heartrate;
+
+        profileStart = SYS_PROFILE_START();
+        if (!SYS_HRCODEC_EncoderPut(&appLogEncoder, &sample))
+        {
+            APP_LogBlockStore();
+            (void)SYS_HRCODEC_EncoderPut(&appLogEncoder, &sample);
+        }
+        SYS_PROFILE_STOP(SYS_PROFILE_ID_HRCODEC_ENCODE, profileStart);
+    }
     else
-        SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, "Received new bug!!! %d \r\n", heartrate);
+        SYS_LOG_WARN(SYS_LOG_MODULE_APP, "Received new bug!!! %d", heartrate);
+}
+
+void APP_HeartRateSessionCallback (DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary )
+{
+    SYS_LOG_INFO(SYS_LOG_MODULE_APP, "Window %lu: %u frames (%u discarded, %u valid) min %u max %u avg %u",
+        summary->windowIndex, summary->frameCount, summary->discardedCount, summary->validCount,
+        summary->heartRateMin, summary->heartRateMax, summary->heartRateMean);
+
+    /* The sensor is off until the next window, keep the last readings */
+    APP_LogBlockStore();
+    SYS_FLASHLOG_Flush();
 }
 
 /*******************************************************************************
@@ -56,7 +56,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include "configuration.h"
-#include "driver/usart/drv_usart.h"
+#include "driver/heartrate/drv_heartrate.h"
 
 
 
@@ -91,9 +91,80 @@ extern "C" {
 #define SYS_CONSOLE_USB_CDC_MAX_INSTANCES 	   		0
 #define SYS_CONSOLE_PRINT_BUFFER_SIZE        		200
 
+/* Output that does not fit in the SERCOM3 transmit ring is held here and
+   drained by SYS_CONSOLE_Tasks. Set to 0 to drop it instead. */
+#define SYS_CONSOLE_UART_STAGING_BUFFER_SIZE_IDX0   512U
+
 
 #define SYS_CONSOLE_INDEX_0                       0
 
+/* Deepest sleep mode entered by the power service. Use SYS_POWER_MODE_IDLE
+   to keep the debugger attached, SYS_POWER_MODE_READY to never sleep. */
+#define SYS_POWER_DEEPEST_MODE                    SYS_POWER_MODE_STANDBY
+
+/* CPU clock governor. Pending bytes at or above the high threshold switch
+   GCLK0 to the 48 MHz DFLL, staying at or below the low threshold for the
+   given number of task passes switches back to the 8 MHz OSC8M. */
+#define SYS_POWER_BACKLOG_HIGH_THRESHOLD          64U
+#define SYS_POWER_BACKLOG_LOW_THRESHOLD           8U
+#define SYS_POWER_LOW_POWER_DELAY                 200U
+
+/* Cycle profiling of the sensor receive path, see the "prof" command. Build
+   once more with RAMFUNC_DISABLE defined to compare against flash execution. */
+#define SYS_PROFILE_ENABLE                        0
+
+/* SysTick micro-benchmarks, see the "bench" command. Set SYS_BENCH_RUN_AT_BOOT
+   to 1 to measure once during initialization, before the console is used. */
+#define SYS_BENCH_MAX_ENTRIES                     12U
+#define SYS_BENCH_ITERATIONS                      32U
+#define SYS_BENCH_RUN_AT_BOOT                     0
+
+/* Also time the C library snprintf against the formatter. This links the
+   newlib formatted output the formatter replaces, keep it 0 in releases. */
+#define SYS_BENCH_LIBC_COMPARE                    0
+
+/* Stack high-water mark, see the "stack" command. Painting the stack in
+   Reset_Handler adds about 4 cycles per word to the time from reset. */
+#define SYS_STACK_PAINT_ENABLE                    1
+
+/* Tokenized log, decoded on the host with tools/tlog/tlog_decode.py */
+#define SYS_TLOG_ENABLE                           1
+#define SYS_TLOG_BUFFER_SIZE                      256U
+#define SYS_TLOG_CONSOLE_INDEX                    SYS_CONSOLE_INDEX_0
+
+/* Leveled console log. Levels above SYS_LOG_LEVEL_MAX generate no code, use
+   SYS_LOG_LEVEL_NONE or SYS_LOG_LEVEL_ERROR for production builds. Modules
+   start at SYS_LOG_LEVEL_DEFAULT and are changed with the "log" command. */
+#define SYS_LOG_LEVEL_MAX                         SYS_LOG_LEVEL_DEBUG
+#define SYS_LOG_LEVEL_DEFAULT                     SYS_LOG_LEVEL_INFO
+#define SYS_LOG_BUFFER_SIZE                       128U
+#define SYS_LOG_CONSOLE_INDEX                     SYS_CONSOLE_INDEX_0
+
+/* Binary telemetry on SERCOM2. A frame is sent once it holds
+   SYS_TELEMETRY_SAMPLES_PER_FRAME samples or its oldest sample is
+   SYS_TELEMETRY_FLUSH_MS old. */
+#define SYS_TELEMETRY_SAMPLES_PER_FRAME           8U
+#define SYS_TELEMETRY_FLUSH_MS                    100U
+#define SYS_TELEMETRY_START_ENABLED               1
+
+/* Record bytes per capture frame, at least one record with the longest chunk */
+#define SYS_TELEMETRY_CAPTURE_PAYLOAD_SIZE        240U
+
+/* Loopback self-test, see the "loopback" command. SERCOM2 TX (PA08) must be
+   wired to SERCOM0 RX (PA07), telemetry is paused while the test runs. */
+#define SYS_LOOPBACK_STEPS_MAX                    12U
+#define SYS_LOOPBACK_STEP_MS                      2000U
+#define SYS_LOOPBACK_DRAIN_MS                     50U
+
+/* Flash log region at the top of the flash, the linker script reserves the
+   same FLASHLOG_LENGTH bytes */
+#define SYS_FLASHLOG_SIZE                         0x8000U
+#define SYS_FLASHLOG_START_ADDRESS                (0x40000U - SYS_FLASHLOG_SIZE)
+
+/* Configuration record rows right below the flash log, the linker script
+   reserves the same CFG_LENGTH bytes */
+#define SYS_CFG_SIZE                              0x200U
+#define SYS_CFG_START_ADDRESS                     (SYS_FLASHLOG_START_ADDRESS - SYS_CFG_SIZE)
 
 
 
@@ -104,20 +175,32 @@ extern "C" {
 // Section: Driver Configuration
 // *****************************************************************************
 // *****************************************************************************
-/* USART Driver Instance 0 Configuration Options */
-#define DRV_USART_INDEX_0                  0
-#define DRV_USART_CLIENTS_NUMBER_IDX0      1
-
 /* HEART Driver Instance 0 Configuration Options */
 #define DRV_HEARTRATE_INDEX_0                  0
-#define DRV_HEARTRATE_CLIENTS_NUMBER_IDX0      1   
+#define DRV_HEARTRATE_CLIENTS_NUMBER_IDX0      3   
+
+/* HEARTRATE Driver Instance 0 measurement windows. The sensor is released
+   from reset for the window once every period, a period of 0 keeps it
+   streaming continuously. Streaming is the default, applications opt in to
+   windows with DRV_HEARTRATE_SessionConfigure or the "period" tunable. */
+#define DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0       0U
+#define DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0       30000U
+#define DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0   100U
+
+/* HEARTRATE Driver Instance 0 defaults of the "cfg" tunables. Received bytes
+   are handed to the driver in chunks of the read threshold, one heart rate
+   is reported every decimation frames. */
+#define DRV_HEARTRATE_READ_THRESHOLD_IDX0          10U
+#define DRV_HEARTRATE_REPORT_DECIMATION_IDX0       100U
+#define DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0        5000U
     
-/* USART Driver Global Configuration Options */
-#define DRV_USART_INSTANCES_NUMBER         1
-
 /* HEARTRATE Driver Global Configuration Options */
 #define DRV_HEARTRATE_INSTANCES_NUMBER         1    
 
+/* RAM buffer the raw SERCOM0 chunks are captured into for replay on the
+   host, see "telem capture". Set to 0 to leave the capture out. */
+#define DRV_HEARTRATE_CAPTURE_BUFFER_SIZE      2048U
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -58,12 +58,25 @@
 #include "peripheral/clock/plib_clock.h"
 #include "peripheral/nvic/plib_nvic.h"
 #include "peripheral/systick/plib_systick.h"
-#include "driver/usart/drv_usart.h"
+#include "peripheral/pm/plib_pm.h"
+#include "peripheral/rtc/plib_rtc.h"
 #include "driver/heartrate/drv_heartrate.h"
 #include "system/console/sys_console.h"
 #include "system/console/src/sys_console_uart_definitions.h"
 #include "system/int/sys_int.h"
 #include "system/reset/sys_reset.h"
+#include "system/power/sys_power.h"
+#include "system/profile/sys_profile.h"
+#include "system/bench/sys_bench.h"
+#include "system/stack/sys_stack.h"
+#include "system/tlog/sys_tlog.h"
+#include "system/log/sys_log.h"
+#include "system/telemetry/sys_telemetry.h"
+#include "system/loopback/sys_loopback.h"
+#include "system/flashlog/sys_flashlog.h"
+#include "system/hrcodec/sys_hrcodec.h"
+#include "system/cfg/sys_cfg.h"
+#include "system/boot/sys_boot.h"
 #include "osal/osal.h"
 #include "system/debug/sys_debug.h"
 #include "app.h"
@@ -191,7 +204,6 @@ Remarks:
 
 typedef struct
 {
-    SYS_MODULE_OBJ  drvUsart0;
     SYS_MODULE_OBJ  sysConsole0;
     SYS_MODULE_OBJ  drvHeartRate0;
 
@@ -136,7 +136,7 @@ typedef enum
   Remarks:
     The enumeration used as the return type for the client-level status routines
     defined by each device driver or system module (for example,
-    DRV_USART_ClientStatus) must be based on the values in this enumeration.
+    DRV_<module>_ClientStatus) must be based on the values in this enumeration.
 */
 
 typedef enum
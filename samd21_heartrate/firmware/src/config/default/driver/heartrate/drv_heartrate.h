@@ -54,6 +54,7 @@
 #include "system/system.h"
 #include "driver/driver.h"
 #include "drv_heartrate_definitions.h"
+#include "driver/heartrate/src/drv_heartrate_frame.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -90,6 +91,151 @@
 typedef struct _DRV_HEARTRATE_INIT DRV_HEARTRATE_INIT;
 
 typedef void (*DRV_HEARTRATE_APP_CALLBACK )(DRV_HANDLE handle, int heartrate );
+
+// *****************************************************************************
+/* HEARTRATE Measurement Session Configuration
+
+  Summary:
+    Defines when the sensor is powered and how long it settles.
+
+  Description:
+    The sensor is held in reset for periodMs - windowMs and released for
+    windowMs every periodMs. The first warmupFrames frames of every window
+    are discarded. A periodMs of 0 disables the scheduler and the sensor
+    streams continuously.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t periodMs;
+
+    uint32_t windowMs;
+
+    uint32_t warmupFrames;
+
+} DRV_HEARTRATE_SESSION_CONFIG;
+
+// *****************************************************************************
+/* HEARTRATE Measurement Session Summary
+
+  Summary:
+    Result of one measurement window.
+
+  Description:
+    startTime is the RTC counter value (RTC_Timer32FrequencyGet ticks per
+    second) at which the sensor was released from reset. Minimum, maximum
+    and mean only cover frames that reported a non zero heart rate; they are
+    0 when validCount is 0.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t windowIndex;
+
+    uint32_t startTime;
+
+    uint16_t discardedCount;
+
+    uint16_t frameCount;
+
+    uint16_t validCount;
+
+    uint8_t heartRateMin;
+
+    uint8_t heartRateMax;
+
+    uint8_t heartRateMean;
+
+} DRV_HEARTRATE_SESSION_SUMMARY;
+
+typedef void (*DRV_HEARTRATE_SESSION_CALLBACK )(DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary );
+
+// *****************************************************************************
+/* HEARTRATE Sample
+
+  Summary:
+    One frame received from the sensor.
+
+  Description:
+    timestamp is the RTC counter value at which the frame was parsed.
+    sequence is incremented for every reported frame, frames discarded
+    during the warmup of a measurement window or received while the
+    sensor is held in reset are not reported.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t timestamp;
+
+    uint32_t sequence;
+
+    DRV_HEARTRATE_FRAME frame;
+
+} DRV_HEARTRATE_SAMPLE;
+
+typedef void (*DRV_HEARTRATE_SAMPLE_CALLBACK )(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample );
+
+/* Longest chunk the receive notification hands over, the USART ring holds
+   one byte less than its size */
+#define DRV_HEARTRATE_CAPTURE_CHUNK_MAX        (128U)
+
+/* Records were lost on a full capture buffer before this one */
+#define DRV_HEARTRATE_CAPTURE_FLAG_GAP         (0x01U)
+
+// *****************************************************************************
+/* HEARTRATE Capture Record
+
+  Summary:
+    One chunk of raw sensor bytes as the receive notification handed it over.
+
+  Description:
+    timestamp is the RTC counter value in the receive interrupt. sequence
+    counts every chunk received while the capture runs, including the ones
+    lost on a full capture buffer, so that a replay can tell where they are
+    missing.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t timestamp;
+
+    uint16_t sequence;
+
+    uint8_t length;
+
+    uint8_t flags;
+
+} DRV_HEARTRATE_CAPTURE_RECORD;
+
+typedef struct
+{
+    uint32_t recordCount;
+
+    uint32_t byteCount;
+
+    /* Chunks and bytes lost because the capture buffer was full */
+    uint32_t droppedRecordCount;
+
+    uint32_t droppedByteCount;
+
+    /* Capture buffer fill in bytes, record headers included */
+    uint32_t pendingBytes;
+
+    uint32_t peakUsage;
+
+} DRV_HEARTRATE_CAPTURE_STATISTICS;
 // *****************************************************************************
 // *****************************************************************************
 // Section: HEARTRATE Driver System Interface Routines
@@ -348,6 +494,282 @@ void DRV_HEARTRATE_TASKS( SYS_MODULE_OBJ object);
 
 void DRV_HEARTRATE_ClientEventHandlerSet(const DRV_HANDLE handle, const DRV_HEARTRATE_APP_CALLBACK callback);
 
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_IsIdle( SYS_MODULE_OBJ object )
+
+  Summary:
+    Tells whether the driver is waiting for the next sensor frame.
+
+  Description:
+    Returns true once the start-up delay has elapsed and every byte received
+    from the sensor has been parsed. The device may then sleep until the PLIB
+    receive interrupt reports new data.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object handle, returned from DRV_HEARTRATE_Initialize
+
+  Returns:
+    true if no received data is waiting to be processed, false otherwise.
+
+  Remarks:
+    Used by the power service with interrupts disabled, so it never blocks.
+*/
+
+bool DRV_HEARTRATE_IsIdle( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_SensorIsOff( SYS_MODULE_OBJ object )
+
+  Summary:
+    Tells whether the sensor is held in reset between measurement windows.
+
+  Description:
+    No sensor data arrives while the sensor is off, so the CPU may be stalled
+    for a few milliseconds, for example by a flash erase, without losing
+    received bytes.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object handle, returned from DRV_HEARTRATE_Initialize
+
+  Returns:
+    true between measurement windows, false while the sensor streams or the
+    next window is about to start.
+
+  Remarks:
+    Always false when the driver streams continuously.
+*/
+
+bool DRV_HEARTRATE_SensorIsOff( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_LoopbackEnable( SYS_MODULE_OBJ object, bool enable )
+
+  Summary:
+    Holds the sensor in reset and reports every frame received.
+
+  Description:
+    Used by the loopback self-test, which feeds synthetic frames into the
+    sensor USART from another SERCOM. While enabled the measurement window
+    scheduler is stopped, the sensor is kept in reset so that it does not
+    drive the receive line and every complete frame is passed to the
+    clients. Disabling applies the session configuration again.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object handle, returned from DRV_HEARTRATE_Initialize
+    enable - true to enter loopback, false to return to the sensor
+
+  Returns:
+    true if the mode was changed, false if the driver is not ready.
+
+  Remarks:
+    The parser and the receive buffer are cleared on every change.
+*/
+
+bool DRV_HEARTRATE_LoopbackEnable( SYS_MODULE_OBJ object, bool enable );
+
+// *****************************************************************************
+/* Function:
+    uint32_t DRV_HEARTRATE_BacklogGet( SYS_MODULE_OBJ object )
+
+  Summary:
+    Returns the number of received bytes the parser has not consumed yet.
+
+  Description:
+    Counts the bytes waiting in the USART ring buffer, in the receive
+    notification buffer and in the parser buffer. Used by the power service
+    to select the CPU clock.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_HEARTRATE_Initialize
+
+  Returns:
+    Number of pending bytes, 0 if the driver is not ready.
+
+  Remarks:
+    None.
+*/
+
+uint32_t DRV_HEARTRATE_BacklogGet( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_SessionConfigure
+    (
+        const DRV_HANDLE handle,
+        const DRV_HEARTRATE_SESSION_CONFIG * config
+    )
+
+  Summary:
+    Changes the measurement window schedule.
+
+  Description:
+    Replaces the schedule given in the initialization data. The current
+    window is abandoned without a summary. With a non zero period the sensor
+    is put into reset and the next window starts immediately, with a zero
+    period the sensor is released and streams continuously.
+
+  Precondition:
+    DRV_HEARTRATE_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle - A valid open-instance handle
+    config - New schedule
+
+  Returns:
+    false if the handle is invalid or the window is longer than the period.
+
+  Remarks:
+    None.
+*/
+
+bool DRV_HEARTRATE_SessionConfigure( const DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_CONFIG * config );
+
+// *****************************************************************************
+/* Function:
+    void DRV_HEARTRATE_SessionEventHandlerSet
+    (
+        const DRV_HANDLE handle,
+        const DRV_HEARTRATE_SESSION_CALLBACK callback
+    )
+
+  Summary:
+    Registers the callback that receives the per-window summaries.
+
+  Description:
+    The callback is invoked from DRV_HEARTRATE_TASKS when a measurement
+    window closes and the sensor has been put back into reset.
+
+  Precondition:
+    DRV_HEARTRATE_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle   - A valid open-instance handle
+    callback - Summary handler, NULL to unregister
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void DRV_HEARTRATE_SessionEventHandlerSet( const DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_CALLBACK callback );
+
+// *****************************************************************************
+/* Function:
+    void DRV_HEARTRATE_SampleEventHandlerSet
+    (
+        const DRV_HANDLE handle,
+        const DRV_HEARTRATE_SAMPLE_CALLBACK callback
+    )
+
+  Summary:
+    Registers the callback that receives every sensor frame.
+
+  Description:
+    The callback is invoked from DRV_HEARTRATE_TASKS for every frame, before
+    the frames are decimated for the DRV_HEARTRATE_APP_CALLBACK.
+
+  Precondition:
+    DRV_HEARTRATE_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle   - A valid open-instance handle
+    callback - Sample handler, NULL to unregister
+
+  Returns:
+    None.
+
+  Remarks:
+    The callback runs on the sensor receive path and must not block.
+*/
+
+void DRV_HEARTRATE_SampleEventHandlerSet( const DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE_CALLBACK callback );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_CaptureEnable( SYS_MODULE_OBJ object, bool enable )
+
+  Summary:
+    Starts or stops mirroring the raw sensor bytes into the capture buffer.
+
+  Description:
+    Every chunk the receive notification copies out of the USART ring is
+    also written to the capture buffer with its arrival time, before the
+    parser sees it. Starting a capture empties the buffer and clears the
+    statistics. When the buffer is full further chunks are counted as
+    dropped until the reader makes room.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_HEARTRATE_Initialize
+    enable - true to start a new capture, false to stop it
+
+  Returns:
+    false if the driver is not ready or DRV_HEARTRATE_CAPTURE_BUFFER_SIZE
+    is 0.
+
+  Remarks:
+    Records already in the buffer can still be read after the capture stops.
+*/
+
+bool DRV_HEARTRATE_CaptureEnable( SYS_MODULE_OBJ object, bool enable );
+
+bool DRV_HEARTRATE_CaptureIsEnabled( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_HEARTRATE_CaptureRead
+    (
+        SYS_MODULE_OBJ object,
+        DRV_HEARTRATE_CAPTURE_RECORD * record,
+        uint8_t * data,
+        size_t size
+    )
+
+  Summary:
+    Removes the oldest record from the capture buffer.
+
+  Description:
+    The record is left in the buffer if its chunk is longer than size.
+
+  Precondition:
+    DRV_HEARTRATE_Initialize must have been called.
+
+  Parameters:
+    object - Driver object returned by DRV_HEARTRATE_Initialize
+    record - Receives the record header
+    data   - Receives record->length bytes
+    size   - Room in data, DRV_HEARTRATE_CAPTURE_CHUNK_MAX always fits
+
+  Returns:
+    true if a record was read.
+
+  Remarks:
+    Call from task context, the receive interrupt writes the buffer.
+*/
+
+bool DRV_HEARTRATE_CaptureRead( SYS_MODULE_OBJ object, DRV_HEARTRATE_CAPTURE_RECORD * record, uint8_t * data, size_t size );
+
+void DRV_HEARTRATE_CaptureStatisticsGet( SYS_MODULE_OBJ object, DRV_HEARTRATE_CAPTURE_STATISTICS * stats );
+
 
 
 
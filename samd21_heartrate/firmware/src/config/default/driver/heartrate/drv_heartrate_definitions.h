@@ -126,6 +126,25 @@ struct _DRV_HEARTRATE_INIT
     /* Memory Pool for Client Objects */
     uintptr_t                               clientObjPool;
 
+    /* Time between the start of two measurement windows in milliseconds.
+     * 0 keeps the sensor out of reset and streaming continuously. */
+    uint32_t                                sessionPeriodMs;
+
+    /* Time the sensor is released from reset in every window */
+    uint32_t                                sessionWindowMs;
+
+    /* Frames discarded at the start of every window while the sensor
+     * output settles */
+    uint32_t                                sessionWarmupFrames;
+
+    /* Received bytes that trigger the PLIB read notification */
+    uint32_t                                readThreshold;
+
+    /* Frames between two heart rate reports to the client callbacks */
+    uint32_t                                reportDecimation;
+
+    /* Time the sensor is given after reset before the driver opens */
+    uint32_t                                startupDelayMs;
 
 };
 
@@ -60,14 +60,17 @@
 static void heartrate9_initialize(void);
 /* This is the driver instance object array. */
 static bool  bInitialized=false;
-static int iInitializeDelay = 5000;
+/* RTC counter value at which the sensor startup delay ends */
+static uint32_t startupDeadline = 0;
 static DRV_HEARTRATE_OBJ gDrvHEARTRATEObj[DRV_HEARTRATE_INSTANCES_NUMBER] ;
 
 static void _DRV_HEARTRATE_PLIB_CallbackHandler(int event, uintptr_t context);
 static void heartrate9_set_rst(uint8_t state);
-static int8_t heartrate9_read_byte(DRV_HEARTRATE_OBJ *dObj);
-static void hr9_rx_buff_update(DRV_HEARTRATE_OBJ *dObj);
+static RAMFUNC int8_t heartrate9_read_byte(DRV_HEARTRATE_OBJ *dObj);
 static bool is_heartrate9_byte_ready(DRV_HEARTRATE_OBJ *dObj);
+static void _DRV_HEARTRATE_SessionSet(DRV_HEARTRATE_OBJ *dObj, uint32_t periodMs, uint32_t windowMs, uint32_t warmupFrames);
+static void _DRV_HEARTRATE_SessionTasks(DRV_HEARTRATE_OBJ *dObj);
+static bool _DRV_HEARTRATE_SessionFrame(DRV_HEARTRATE_OBJ *dObj, uint8_t heartRate);
 
 static inline uint32_t  _DRV_HEARTRATE_MAKE_HANDLE(uint16_t token, uint8_t drvIndex, uint8_t clientIndex)
 {
@@ -121,6 +124,179 @@ static DRV_HEARTRATE_CLIENT_OBJ* _DRV_HEARTRATE_DriverHandleValidate(DRV_HANDLE
     return(clientObj);
 }
 
+static uint32_t _DRV_HEARTRATE_MsToTicks(uint32_t ms)
+{
+    uint32_t frequency = RTC_Timer32FrequencyGet();
+
+    /* Split the conversion so that long periods do not overflow */
+    return (((ms / 1000U) * frequency) + (((ms % 1000U) * frequency) / 1000U));
+}
+
+/* Wrap safe check whether the RTC counter has reached the deadline */
+static inline bool _DRV_HEARTRATE_SessionDue(uint32_t now, uint32_t deadline)
+{
+    return ((int32_t)(now - deadline) >= 0);
+}
+
+static void _DRV_HEARTRATE_SessionSet(DRV_HEARTRATE_OBJ *dObj, uint32_t periodMs, uint32_t windowMs, uint32_t warmupFrames)
+{
+    DRV_HEARTRATE_SESSION *session = &dObj->session;
+
+    session->config.periodMs        = periodMs;
+    session->config.windowMs        = windowMs;
+    session->config.warmupFrames    = warmupFrames;
+
+    session->periodTicks    = _DRV_HEARTRATE_MsToTicks(periodMs);
+    session->windowTicks    = _DRV_HEARTRATE_MsToTicks(windowMs);
+    session->warmupFrames   = warmupFrames;
+
+    if (periodMs == 0U)
+    {
+        session->state = DRV_HEARTRATE_SESSION_STATE_STREAMING;
+        RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_COMPARE_MATCH);
+        heartrate9_set_rst(1);
+    }
+    else
+    {
+        /* Hold the sensor in reset, the first window opens on the next task call */
+        session->state      = DRV_HEARTRATE_SESSION_STATE_OFF;
+        session->nextStart  = RTC_Timer32CounterGet();
+        heartrate9_set_rst(0);
+    }
+}
+
+static void _DRV_HEARTRATE_SessionWakeupSet(uint32_t deadline)
+{
+    /* The compare match wakes the device from standby at the deadline */
+    RTC_Timer32CompareSet(deadline);
+    RTC_Timer32InterruptEnable(RTC_TIMER32_INT_MASK_COMPARE_MATCH);
+}
+
+static void _DRV_HEARTRATE_SessionTasks(DRV_HEARTRATE_OBJ *dObj)
+{
+    DRV_HEARTRATE_SESSION *session = &dObj->session;
+    DRV_HEARTRATE_CLIENT_OBJ *clientObj;
+    uint32_t now;
+
+    if ((session->state == DRV_HEARTRATE_SESSION_STATE_STREAMING) ||
+        (session->state == DRV_HEARTRATE_SESSION_STATE_LOOPBACK))
+    {
+        return;
+    }
+
+    now = RTC_Timer32CounterGet();
+
+    if (session->state == DRV_HEARTRATE_SESSION_STATE_OFF)
+    {
+        if (_DRV_HEARTRATE_SessionDue(now, session->nextStart) == false)
+        {
+            return;
+        }
+
+        /* Restart the parser so a frame cut off by the previous reset is dropped */
+        DRV_HEARTRATE_FrameParserReset(&dObj->frameParser);
+        dObj->heartrate_pross_cnt           = 0;
+        dObj->firstReportPending            = true;
+        dObj->hr9_rx_data_buf_clr_state     = false;
+
+        session->summary.windowIndex++;
+        session->summary.startTime      = now;
+        session->summary.discardedCount = 0;
+        session->summary.frameCount     = 0;
+        session->summary.validCount     = 0;
+        session->summary.heartRateMin   = 0xFFU;
+        session->summary.heartRateMax   = 0;
+        session->summary.heartRateMean  = 0;
+        session->heartRateSum           = 0;
+
+        session->windowEnd  = now + session->windowTicks;
+        session->nextStart  = session->nextStart + session->periodTicks;
+
+        /* Do not try to catch up on windows missed while the device was busy */
+        if (_DRV_HEARTRATE_SessionDue(now, session->nextStart) == true)
+        {
+            session->nextStart = now + session->periodTicks;
+        }
+
+        session->state = (session->warmupFrames != 0U) ? DRV_HEARTRATE_SESSION_STATE_WARMUP : DRV_HEARTRATE_SESSION_STATE_ACQUIRE;
+        heartrate9_set_rst(1);
+        _DRV_HEARTRATE_SessionWakeupSet(session->windowEnd);
+        return;
+    }
+
+    if (_DRV_HEARTRATE_SessionDue(now, session->windowEnd) == false)
+    {
+        return;
+    }
+
+    /* Window closed, power the sensor down before reporting */
+    heartrate9_set_rst(0);
+    session->state = DRV_HEARTRATE_SESSION_STATE_OFF;
+
+    if (session->summary.validCount != 0U)
+    {
+        session->summary.heartRateMean = (uint8_t)(session->heartRateSum / session->summary.validCount);
+    }
+    else
+    {
+        session->summary.heartRateMin = 0;
+    }
+
+    for (uint32_t iClient = 0; iClient != dObj->nClientsMax; iClient++)
+    {
+        clientObj = &((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+
+        if ((clientObj->inUse == true) && (clientObj->sessionCallback != NULL))
+        {
+            clientObj->sessionCallback(clientObj->clientHandle, &session->summary);
+        }
+    }
+
+    _DRV_HEARTRATE_SessionWakeupSet(session->nextStart);
+}
+
+/* Called for every complete frame, returns false if the frame must not be reported */
+static bool _DRV_HEARTRATE_SessionFrame(DRV_HEARTRATE_OBJ *dObj, uint8_t heartRate)
+{
+    DRV_HEARTRATE_SESSION *session = &dObj->session;
+
+    switch (session->state)
+    {
+        case DRV_HEARTRATE_SESSION_STATE_STREAMING:
+        case DRV_HEARTRATE_SESSION_STATE_LOOPBACK:
+            return true;
+
+        case DRV_HEARTRATE_SESSION_STATE_WARMUP:
+            session->summary.discardedCount++;
+            if (session->summary.discardedCount >= session->warmupFrames)
+            {
+                session->state = DRV_HEARTRATE_SESSION_STATE_ACQUIRE;
+            }
+            return false;
+
+        case DRV_HEARTRATE_SESSION_STATE_ACQUIRE:
+            session->summary.frameCount++;
+            if (heartRate != 0U)
+            {
+                session->summary.validCount++;
+                session->heartRateSum += heartRate;
+                if (heartRate < session->summary.heartRateMin)
+                {
+                    session->summary.heartRateMin = heartRate;
+                }
+                if (heartRate > session->summary.heartRateMax)
+                {
+                    session->summary.heartRateMax = heartRate;
+                }
+            }
+            return true;
+
+        default:
+            /* Line noise while the sensor is held in reset */
+            return false;
+    }
+}
+
 SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MODULE_INIT* const init )
 {
     DRV_HEARTRATE_OBJ *dObj = NULL;
@@ -129,7 +305,7 @@ SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const
     /* Validate the request */
     if(drvIndex >= DRV_HEARTRATE_INSTANCES_NUMBER)
     {
-        //SYS_DEBUG(SYS_ERROR_ERROR, "Invalid driver instance");
+        SYS_LOG_ERROR(SYS_LOG_MODULE_HEARTRATE, "Invalid driver instance");
         return SYS_MODULE_OBJ_INVALID;
     }
     
@@ -137,7 +313,7 @@ SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const
 
     if(gDrvHEARTRATEObj[drvIndex].inUse != false)
     {
-        //SYS_DEBUG(SYS_ERROR_ERROR, "Instance already in use");
+        SYS_LOG_ERROR(SYS_LOG_MODULE_HEARTRATE, "Instance already in use");
         return SYS_MODULE_OBJ_INVALID;
     }
 
@@ -150,7 +326,23 @@ SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const
     dObj->nClients              = 0;
     dObj->isExclusive           = false;
     dObj->heartrateTokenCount       = 1;
-    
+    dObj->sampleSequence        = 0;
+    dObj->reportDecimation      = (uint16_t)heartrateInit->reportDecimation;
+    dObj->firstReportPending    = true;
+
+    DRV_HEARTRATE_FrameParserReset(&dObj->frameParser);
+
+    _DRV_HEARTRATE_SessionSet(dObj, heartrateInit->sessionPeriodMs, heartrateInit->sessionWindowMs, heartrateInit->sessionWarmupFrames);
+
+    /* A periodic session holds the sensor in reset and discards the warmup
+       frames of every window, so the startup delay only applies to streaming.
+       The device sleeps through it until the compare match. */
+    startupDeadline = RTC_Timer32CounterGet();
+    if ((heartrateInit->sessionPeriodMs == 0U) && (heartrateInit->startupDelayMs != 0U))
+    {
+        startupDeadline += _DRV_HEARTRATE_MsToTicks(heartrateInit->startupDelayMs);
+        _DRV_HEARTRATE_SessionWakeupSet(startupDeadline);
+    }
 
 
     if (OSAL_MUTEX_Create(&dObj->clientMutex) == OSAL_RESULT_FALSE)
@@ -162,8 +354,10 @@ SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const
 
   
 
-    dObj->heartratePlib->setReadThreshold(10); 
-    dObj->heartratePlib->readNotificationEnable(true,false);
+    dObj->heartratePlib->setReadThreshold(heartrateInit->readThreshold);
+    /* Persistent, so that bytes left in the PLIB ring while rx_buff is full
+       are picked up with the next byte instead of stalling the receive path */
+    dObj->heartratePlib->readNotificationEnable(true,true);
     dObj->heartratePlib->readCallbackRegister((DRV_HEARTRATE_PLIB_READ_CALLBACK_REG)_DRV_HEARTRATE_PLIB_CallbackHandler, (uintptr_t)dObj);
     dObj->heartratePlib->read(dObj->rx_buff,DRV_RECEIVE_HEARTRATE_DATA_SIZE);
    
@@ -174,17 +368,130 @@ SYS_MODULE_OBJ DRV_HEARTRATE_Initialize( const SYS_MODULE_INDEX drvIndex, const
     return ( (SYS_MODULE_OBJ)drvIndex );
 }
 
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+static inline uint32_t _DRV_HEARTRATE_CaptureWrap(uint32_t index)
+{
+    return (index >= DRV_HEARTRATE_CAPTURE_BUFFER_SIZE) ? (index - DRV_HEARTRATE_CAPTURE_BUFFER_SIZE) : index;
+}
+
+static uint32_t _DRV_HEARTRATE_CaptureUsed(const DRV_HEARTRATE_CAPTURE *capture)
+{
+    uint32_t inIndex = capture->inIndex;
+    uint32_t outIndex = capture->outIndex;
+
+    return (inIndex >= outIndex) ? (inIndex - outIndex) : ((DRV_HEARTRATE_CAPTURE_BUFFER_SIZE - outIndex) + inIndex);
+}
+
+static void _DRV_HEARTRATE_CaptureCopyIn(DRV_HEARTRATE_CAPTURE *capture, uint32_t index, const uint8_t *src, uint32_t size)
+{
+    uint32_t first = DRV_HEARTRATE_CAPTURE_BUFFER_SIZE - index;
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    memcpy(&capture->buffer[index], src, first);
+    memcpy(capture->buffer, &src[first], size - first);
+}
+
+static void _DRV_HEARTRATE_CaptureCopyOut(const DRV_HEARTRATE_CAPTURE *capture, uint32_t index, uint8_t *dst, uint32_t size)
+{
+    uint32_t first = DRV_HEARTRATE_CAPTURE_BUFFER_SIZE - index;
+
+    if (first > size)
+    {
+        first = size;
+    }
+
+    memcpy(dst, &capture->buffer[index], first);
+    memcpy(&dst[first], capture->buffer, size - first);
+}
+
+/* Called from the receive interrupt with the chunk just appended to rx_buff */
+static void _DRV_HEARTRATE_CaptureWrite(DRV_HEARTRATE_CAPTURE *capture, const uint8_t *data, uint32_t size)
+{
+    DRV_HEARTRATE_CAPTURE_RECORD record;
+    uint32_t used = _DRV_HEARTRATE_CaptureUsed(capture) + sizeof(record) + size;
+    uint32_t index;
+
+    record.sequence = capture->sequence++;
+
+    /* One byte stays free so that a full buffer differs from an empty one */
+    if (used >= DRV_HEARTRATE_CAPTURE_BUFFER_SIZE)
+    {
+        capture->stats.droppedRecordCount++;
+        capture->stats.droppedByteCount += size;
+        capture->gap = true;
+        return;
+    }
+
+    record.timestamp    = RTC_Timer32CounterGet();
+    record.length       = (uint8_t)size;
+    record.flags        = (capture->gap == true) ? DRV_HEARTRATE_CAPTURE_FLAG_GAP : 0U;
+
+    index = capture->inIndex;
+    _DRV_HEARTRATE_CaptureCopyIn(capture, index, (const uint8_t *)&record, sizeof(record));
+    index = _DRV_HEARTRATE_CaptureWrap(index + sizeof(record));
+    _DRV_HEARTRATE_CaptureCopyIn(capture, index, data, size);
+
+    /* Published last, the reader does not see a partial record */
+    capture->inIndex = _DRV_HEARTRATE_CaptureWrap(index + size);
+
+    capture->gap = false;
+    capture->stats.recordCount++;
+    capture->stats.byteCount += size;
+    if (used > capture->stats.peakUsage)
+    {
+        capture->stats.peakUsage = used;
+    }
+}
+#endif
+
 static void _DRV_HEARTRATE_PLIB_CallbackHandler(int event, uintptr_t context)
 {
-    uint32_t nBytesAvailable = 0;
     DRV_HEARTRATE_OBJ *dObj = (DRV_HEARTRATE_OBJ*)context;
-    if (event == HEARTRATE_EVENT_READ_THRESHOLD_REACHED)
+    uint32_t inIndex;
+    uint32_t outIndex;
+    uint32_t nBytes;
+    uint32_t nFirst;
+
+    if ((event == HEARTRATE_EVENT_READ_THRESHOLD_REACHED) || (event == HEARTRATE_EVENT_READ_BUFFER_FULL))
     {
-        /* Receiver should atleast have the thershold number of bytes in the ring buffer */
-        nBytesAvailable = dObj->heartratePlib->readCountGet();
-        
-        dObj->no_of_bytes_rcvd = dObj->heartratePlib->read((uint8_t*)&dObj->rx_data[0], nBytesAvailable);
-        dObj->hr9_data_rx_flag = true;
+        /* Append to the ring behind the bytes the task has not parsed yet.
+           What does not fit stays in the PLIB ring buffer, the notification
+           is persistent and the next byte calls back again. */
+        inIndex  = dObj->rx_buff_in_index;
+        outIndex = dObj->rx_buff_out_index;
+        nBytes   = (outIndex + DRV_RECEIVE_HEARTRATE_DATA_SIZE - inIndex - 1U) % DRV_RECEIVE_HEARTRATE_DATA_SIZE;
+
+        if (nBytes > dObj->heartratePlib->readCountGet())
+        {
+            nBytes = dObj->heartratePlib->readCountGet();
+        }
+
+        nFirst = DRV_RECEIVE_HEARTRATE_DATA_SIZE - inIndex;
+        if (nFirst > nBytes)
+        {
+            nFirst = nBytes;
+        }
+
+        nFirst = dObj->heartratePlib->read(&dObj->rx_buff[inIndex], nFirst);
+        nBytes = nFirst + dObj->heartratePlib->read(dObj->rx_buff, nBytes - nFirst);
+
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+        if ((dObj->capture.enabled == true) && (nBytes != 0U))
+        {
+            _DRV_HEARTRATE_CaptureWrite(&dObj->capture, &dObj->rx_buff[inIndex], nFirst);
+            if (nBytes > nFirst)
+            {
+                _DRV_HEARTRATE_CaptureWrite(&dObj->capture, dObj->rx_buff, nBytes - nFirst);
+            }
+        }
+#endif
+
+        /* Published last, the task does not see bytes before they are copied */
+        dObj->rx_buff_in_index = (uint16_t)((inIndex + nBytes) % DRV_RECEIVE_HEARTRATE_DATA_SIZE);
     }
 }
 
@@ -193,7 +500,7 @@ SYS_STATUS DRV_HEARTRATE_Status( SYS_MODULE_OBJ object)
     /* Validate the request */
     if( (object == SYS_MODULE_OBJ_INVALID) || (object >= DRV_HEARTRATE_INSTANCES_NUMBER) )
     {
-        //SYS_DEBUG(SYS_ERROR_ERROR, "Invalid system object handle");
+        SYS_LOG_ERROR(SYS_LOG_MODULE_HEARTRATE, "Invalid system object handle");
         return SYS_STATUS_UNINITIALIZED;
     }
 
@@ -209,7 +516,7 @@ DRV_HANDLE DRV_HEARTRATE_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INT
     /* Validate the request */
     if (drvIndex >= DRV_HEARTRATE_INSTANCES_NUMBER || (!bInitialized))
     {
-        //SYS_DEBUG(SYS_ERROR_ERROR, "Invalid Driver Instance");
+        SYS_LOG_ERROR(SYS_LOG_MODULE_HEARTRATE, "Invalid Driver Instance");
         return DRV_HANDLE_INVALID;
     }
 
@@ -217,7 +524,7 @@ DRV_HANDLE DRV_HEARTRATE_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INT
 
     if(dObj->status != SYS_STATUS_READY)
     {
-        //SYS_DEBUG(SYS_ERROR_ERROR, "Was the driver initialized?");
+        SYS_LOG_ERROR(SYS_LOG_MODULE_HEARTRATE, "Was the driver initialized?");
         return DRV_HANDLE_INVALID;
     }
 
@@ -263,6 +570,10 @@ DRV_HANDLE DRV_HEARTRATE_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INT
             
             clientObj->callback     = NULL;
 
+            clientObj->sessionCallback = NULL;
+
+            clientObj->sampleCallback = NULL;
+
             if(ioIntent & DRV_IO_INTENT_EXCLUSIVE)
             {
                 /* Set the driver exclusive flag */
@@ -330,15 +641,24 @@ void DRV_HEARTRATE_TASKS( SYS_MODULE_OBJ object)
     
      DRV_HEARTRATE_OBJ *dObj = NULL;
      DRV_HEARTRATE_CLIENT_OBJ *clientObj=NULL;
+     DRV_HANDLE readHandle = DRV_HANDLE_INVALID;
     /* Allocate the driver object */
      int heartrate_data=-1;
-    //wait for 5 seconds 
+    //wait for the sensor startup delay
     if(!bInitialized)
     {
-        
-        iInitializeDelay--; 
-        SYSTICK_DelayMs(1);
-        if(!iInitializeDelay)   bInitialized=true;
+        if(_DRV_HEARTRATE_SessionDue(RTC_Timer32CounterGet(), startupDeadline) == false)
+        {
+            return;
+        }
+
+        bInitialized=true;
+        if((DRV_HEARTRATE_Status(object) == SYS_STATUS_READY) &&
+           (gDrvHEARTRATEObj[drvIndex].session.state == DRV_HEARTRATE_SESSION_STATE_STREAMING))
+        {
+            RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_COMPARE_MATCH);
+        }
+        SYS_BOOT_Mark(SYS_BOOT_MILESTONE_SENSOR);
         return;
     }
   
@@ -346,23 +666,45 @@ void DRV_HEARTRATE_TASKS( SYS_MODULE_OBJ object)
     if(DRV_HEARTRATE_Status(object)  == SYS_STATUS_READY)
     {
        dObj= &gDrvHEARTRATEObj[drvIndex];
-       
-      
+
+       _DRV_HEARTRATE_SessionTasks(dObj);
+
+        /* Parse once on behalf of the first client that wants data */
         for(int iClient = 0; iClient != dObj->nClientsMax; iClient++)
         {
-            if(true == ((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient].inUse)
+            clientObj = &((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+
+            if((true == clientObj->inUse) && clientObj->clientHandle && (clientObj->callback || clientObj->sampleCallback))
             {
-                /* This means we have a free client object to use */
+                readHandle = clientObj->clientHandle;
+                break;
+            }
+        }
+
+        if(readHandle == DRV_HANDLE_INVALID)
+        {
+            return;
+        }
 
-                clientObj = &((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+        heartrate_data = DRV_HEARTRATE_Read(readHandle);
+        if(heartrate_data <= 0)
+        {
+            return;
+        }
+      
+        for(int iClient = 0; iClient != dObj->nClientsMax; iClient++)
+        {
+            clientObj = &((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
 
-                if(clientObj->clientHandle && clientObj->callback)
+            if((true == clientObj->inUse) && clientObj->clientHandle && clientObj->callback)
+            {
+                (clientObj->callback)(clientObj->clientHandle, dObj->heartRate);
+                /* The parser still holds the frame just reported */
+                if(dObj->frameParser.frame.quality == DRV_HEARTRATE_FRAME_QUALITY_HR_VALID)
                 {
-                        heartrate_data = DRV_HEARTRATE_Read(clientObj->clientHandle);
-                        if(heartrate_data > 0)
-                            (clientObj->callback)(clientObj->clientHandle, dObj->heartRate);
-                   //code for callback and cloud to be added.
+                    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_FIRST_SAMPLE);
                 }
+                //code for callback and cloud to be added.
             }
         }
     }
@@ -392,6 +734,7 @@ int DRV_HEARTRATE_Read(DRV_HANDLE handle)
 {
     DRV_HEARTRATE_CLIENT_OBJ* clientObj = (DRV_HEARTRATE_CLIENT_OBJ *)NULL;
     int heartrate_data=-1;
+    uint32_t profileStart;
     /* Validate the driver handle */
     clientObj = _DRV_HEARTRATE_DriverHandleValidate(handle);
     
@@ -400,12 +743,14 @@ int DRV_HEARTRATE_Read(DRV_HANDLE handle)
          // Return the Heartrate 
         if(true == is_heartrate9_byte_ready(clientObj->hDriver))
         {
+            profileStart        = SYS_PROFILE_START();
             heartrate_data      = heartrate9_read_byte(clientObj->hDriver);
+            SYS_PROFILE_STOP(SYS_PROFILE_ID_HEARTRATE_PARSE, profileStart);
             if(heartrate_data !=-1)
             {
                  
                  clientObj->hDriver->heartRate = heartrate_data;
-                 SYS_CONSOLE_Print(SYS_CONSOLE_INDEX_0, "DRV new heartrate %d \r\n", heartrate_data);
+                 SYS_TLOG("DRV new heartrate %d", heartrate_data);
                  return heartrate_data;
             }
         }
@@ -427,139 +772,326 @@ void DRV_HEARTRATE_ClientEventHandlerSet(const DRV_HANDLE handle, const DRV_HEAR
     return ;
 }
 
-////// static methods to support reading multi objects///////
+uint32_t DRV_HEARTRATE_BacklogGet( SYS_MODULE_OBJ object )
+{
+    DRV_HEARTRATE_OBJ *dObj;
+    uint32_t backlog;
+
+    if (DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return 0;
+    }
+
+    dObj = &gDrvHEARTRATEObj[object];
+
+    backlog = dObj->heartratePlib->readCountGet();
 
-static void hr9_rx_buff_update(DRV_HEARTRATE_OBJ *dObj)
+    if (dObj->rx_buff_in_index >= dObj->rx_buff_out_index)
+    {
+        backlog += dObj->rx_buff_in_index - dObj->rx_buff_out_index;
+    }
+    else
+    {
+        backlog += (DRV_RECEIVE_HEARTRATE_DATA_SIZE - dObj->rx_buff_out_index) + dObj->rx_buff_in_index;
+    }
+
+    return backlog;
+}
+
+bool DRV_HEARTRATE_SessionConfigure( const DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_CONFIG * config )
 {
-    if(true == dObj->hr9_data_rx_flag)
+    DRV_HEARTRATE_CLIENT_OBJ* clientObj = _DRV_HEARTRATE_DriverHandleValidate(handle);
+
+    if ((clientObj == NULL) || (config == NULL))
     {
-        dObj->hr9_data_rx_flag = false;
-        if((dObj->rx_buff_in_index + dObj->no_of_bytes_rcvd) >= DRV_RECEIVE_HEARTRATE_DATA_SIZE)
-        {
-            memcpy((char *)&dObj->rx_buff[dObj->rx_buff_in_index], (char *)dObj->rx_data, (DRV_RECEIVE_HEARTRATE_DATA_SIZE - dObj->rx_buff_in_index));
-            memcpy((char *)dObj->rx_buff, (char *)&dObj->rx_data[DRV_RECEIVE_HEARTRATE_DATA_SIZE - dObj->rx_buff_in_index], (dObj->rx_buff_in_index + dObj->no_of_bytes_rcvd - DRV_RECEIVE_HEARTRATE_DATA_SIZE));
-        }
-        else
-        {
-            memcpy((char *)&dObj->rx_buff[dObj->rx_buff_in_index], (char *)dObj->rx_data, dObj->no_of_bytes_rcvd);
-        }
-        
-        dObj->rx_buff_in_index += dObj->no_of_bytes_rcvd;
-        if(dObj->rx_buff_in_index >= DRV_RECEIVE_HEARTRATE_DATA_SIZE)
+        return false;
+    }
+
+    if ((config->periodMs != 0U) && (config->windowMs >= config->periodMs))
+    {
+        return false;
+    }
+
+    _DRV_HEARTRATE_SessionSet(clientObj->hDriver, config->periodMs, config->windowMs, config->warmupFrames);
+
+    return true;
+}
+
+void DRV_HEARTRATE_SessionEventHandlerSet( const DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_CALLBACK callback )
+{
+    DRV_HEARTRATE_CLIENT_OBJ* clientObj = _DRV_HEARTRATE_DriverHandleValidate(handle);
+
+    if (clientObj != NULL)
+    {
+        clientObj->sessionCallback = callback;
+    }
+}
+
+void DRV_HEARTRATE_SampleEventHandlerSet( const DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE_CALLBACK callback )
+{
+    DRV_HEARTRATE_CLIENT_OBJ* clientObj = _DRV_HEARTRATE_DriverHandleValidate(handle);
+
+    if (clientObj != NULL)
+    {
+        clientObj->sampleCallback = callback;
+    }
+}
+
+bool DRV_HEARTRATE_IsIdle( SYS_MODULE_OBJ object )
+{
+    DRV_HEARTRATE_OBJ *dObj;
+    DRV_HEARTRATE_SESSION *session;
+    uint32_t deadline;
+
+    if(DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    if(!bInitialized)
+    {
+        return (_DRV_HEARTRATE_SessionDue(RTC_Timer32CounterGet() + 2U, startupDeadline) == false);
+    }
+
+    dObj = &gDrvHEARTRATEObj[object];
+    session = &dObj->session;
+
+    /* A compare value the counter has already passed, or is about to pass
+       while it synchronizes, would not wake the device until the counter wraps */
+    if ((session->state != DRV_HEARTRATE_SESSION_STATE_STREAMING) &&
+        (session->state != DRV_HEARTRATE_SESSION_STATE_LOOPBACK))
+    {
+        deadline = (session->state == DRV_HEARTRATE_SESSION_STATE_OFF) ? session->nextStart : session->windowEnd;
+        if (_DRV_HEARTRATE_SessionDue(RTC_Timer32CounterGet() + 2U, deadline) == true)
         {
-            dObj->rx_buff_in_index = dObj->rx_buff_in_index - DRV_RECEIVE_HEARTRATE_DATA_SIZE;
+            return false;
         }
     }
+
+    return (dObj->rx_buff_in_index == dObj->rx_buff_out_index);
 }
 
-static bool is_heartrate9_byte_ready(DRV_HEARTRATE_OBJ *dObj)
+bool DRV_HEARTRATE_SensorIsOff( SYS_MODULE_OBJ object )
 {
-   
-    if (false == dObj->hr9_rx_data_buf_clr_state)
+    DRV_HEARTRATE_SESSION *session;
+
+    if((!bInitialized) || (DRV_HEARTRATE_Status(object) != SYS_STATUS_READY))
+    {
+        return false;
+    }
+
+    session = &gDrvHEARTRATEObj[object].session;
+
+    /* Leave room for a row erase before the window starts */
+    return ((session->state == DRV_HEARTRATE_SESSION_STATE_OFF) &&
+            (_DRV_HEARTRATE_SessionDue(RTC_Timer32CounterGet() + DRV_HEARTRATE_SENSOR_OFF_MARGIN, session->nextStart) == false));
+}
+
+bool DRV_HEARTRATE_LoopbackEnable( SYS_MODULE_OBJ object, bool enable )
+{
+    DRV_HEARTRATE_OBJ *dObj;
+    DRV_HEARTRATE_SESSION *session;
+
+    if(DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    dObj = &gDrvHEARTRATEObj[object];
+    session = &dObj->session;
+
+    /* Start from an empty buffer, a frame cut off by the change is dropped */
+    DRV_HEARTRATE_FrameParserReset(&dObj->frameParser);
+    dObj->heartrate_pross_cnt           = 0;
+    dObj->firstReportPending            = true;
+    dObj->hr9_rx_data_buf_clr_state     = false;
+
+    if (enable == true)
+    {
+        session->state = DRV_HEARTRATE_SESSION_STATE_LOOPBACK;
+        RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_COMPARE_MATCH);
+        heartrate9_set_rst(0);
+    }
+    else
     {
-        memset((char*)dObj->rx_buff, 0x00, DRV_HEARTRATE_RECEIVE_BUFFER_SIZE);
-       dObj->hr9_rx_data_buf_clr_state  = true;
-        dObj->rx_buff_in_index     = 0;
-        dObj->rx_buff_out_index    = 0;
-        dObj->hr9_data_rx_flag     = false;
+        _DRV_HEARTRATE_SessionSet(dObj, session->config.periodMs, session->config.windowMs, session->config.warmupFrames);
     }
-    if((dObj->rx_buff_in_index == dObj->rx_buff_out_index) && (false == dObj->hr9_data_rx_flag)) return false;
 
     return true;
 }
 
-static int8_t heartrate9_read_byte(DRV_HEARTRATE_OBJ *dObj)
+bool DRV_HEARTRATE_CaptureEnable( SYS_MODULE_OBJ object, bool enable )
 {
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+    DRV_HEARTRATE_CAPTURE *capture;
 
-    uint16_t lcl_rx_buff_in_index = dObj->rx_buff_in_index;
+    if (DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    capture = &gDrvHEARTRATEObj[object].capture;
+    capture->enabled = false;
+
+    if (enable == true)
+    {
+        /* The interrupt has stopped writing, the buffer is emptied from here */
+        capture->outIndex   = capture->inIndex;
+        capture->sequence   = 0;
+        capture->gap        = false;
+        memset(&capture->stats, 0, sizeof(capture->stats));
+        capture->enabled    = true;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool DRV_HEARTRATE_CaptureIsEnabled( SYS_MODULE_OBJ object )
+{
+    if (DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return false;
+    }
 
-    hr9_rx_buff_update(dObj);
-    if(dObj->rx_buff_out_index > lcl_rx_buff_in_index)
+    return gDrvHEARTRATEObj[object].capture.enabled;
+}
+
+bool DRV_HEARTRATE_CaptureRead( SYS_MODULE_OBJ object, DRV_HEARTRATE_CAPTURE_RECORD * record, uint8_t * data, size_t size )
+{
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+    DRV_HEARTRATE_CAPTURE *capture;
+    uint32_t index;
+
+    if (DRV_HEARTRATE_Status(object) != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    capture = &gDrvHEARTRATEObj[object].capture;
+    index = capture->outIndex;
+
+    if (index == capture->inIndex)
+    {
+        return false;
+    }
+
+    _DRV_HEARTRATE_CaptureCopyOut(capture, index, (uint8_t *)record, sizeof(*record));
+    if (record->length > size)
+    {
+        return false;
+    }
+
+    index = _DRV_HEARTRATE_CaptureWrap(index + sizeof(*record));
+    _DRV_HEARTRATE_CaptureCopyOut(capture, index, data, record->length);
+    capture->outIndex = _DRV_HEARTRATE_CaptureWrap(index + record->length);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void DRV_HEARTRATE_CaptureStatisticsGet( SYS_MODULE_OBJ object, DRV_HEARTRATE_CAPTURE_STATISTICS * stats )
+{
+    memset(stats, 0, sizeof(*stats));
+
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+    if (DRV_HEARTRATE_Status(object) == SYS_STATUS_READY)
     {
-        lcl_rx_buff_in_index    = DRV_RECEIVE_HEARTRATE_DATA_SIZE;
+        *stats = gDrvHEARTRATEObj[object].capture.stats;
+        stats->pendingBytes = _DRV_HEARTRATE_CaptureUsed(&gDrvHEARTRATEObj[object].capture);
     }
-    while(dObj->rx_buff_out_index < lcl_rx_buff_in_index)
+#endif
+}
+
+////// static methods to support reading multi objects///////
+
+static bool is_heartrate9_byte_ready(DRV_HEARTRATE_OBJ *dObj)
+{
+    /* Drop what is buffered, the read callback keeps writing behind it */
+    if (false == dObj->hr9_rx_data_buf_clr_state)
+    {
+        dObj->hr9_rx_data_buf_clr_state  = true;
+        dObj->rx_buff_out_index    = dObj->rx_buff_in_index;
+    }
+
+    return (dObj->rx_buff_in_index != dObj->rx_buff_out_index);
+}
+
+static void _DRV_HEARTRATE_SampleNotify(DRV_HEARTRATE_OBJ *dObj, const DRV_HEARTRATE_FRAME *frame)
+{
+    DRV_HEARTRATE_CLIENT_OBJ *clientObj;
+    DRV_HEARTRATE_SAMPLE sample;
+    uint32_t iClient;
+
+    sample.timestamp    = RTC_Timer32CounterGet();
+    sample.sequence     = dObj->sampleSequence++;
+    sample.frame        = *frame;
+
+    for (iClient = 0; iClient != dObj->nClientsMax; iClient++)
     {
-        switch(dObj->heartrate9_read_byte_state)
+        clientObj = &((DRV_HEARTRATE_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+
+        if ((clientObj->inUse == true) && (clientObj->sampleCallback != NULL))
         {
-            case HEADER_BYTE1:
-                for(; dObj->rx_buff_out_index < lcl_rx_buff_in_index; dObj->rx_buff_out_index++)
-                {
-                    if(dObj->rx_buff[dObj->rx_buff_out_index] == '1')
-                    {
-                        dObj->heartrate9_read_byte_state  = HEADER_BYTE2;
-                        dObj->rx_buff_out_index++;
-                        break;
-                    }
-                }
-                break;
-            case HEADER_BYTE2:
-                if(dObj->rx_buff[dObj->rx_buff_out_index] == '5')
-                {
-                    dObj->heartrate9_read_byte_state  = HEADER_BYTE3;
-                }
-                else
-                {
-                    dObj->heartrate9_read_byte_state  = HEADER_BYTE1;
-                }
-                dObj->rx_buff_out_index++;
-                break;
-            case HEADER_BYTE3:
-                if(dObj->rx_buff[dObj->rx_buff_out_index] == ';')
-                {
-                    dObj->heartrate9_read_byte_state  = HEART_RATE_BYTE_POS_FIND;
-                }
-                else
-                {
-                    dObj->heartrate9_read_byte_state  = HEADER_BYTE1;
-                }
-                dObj->rx_buff_out_index++;
-                break;
-            case HEART_RATE_BYTE_POS_FIND:
-                for(; dObj->rx_buff_out_index < lcl_rx_buff_in_index; dObj->rx_buff_out_index++)
-                {
-                    if(dObj->rx_buff[dObj->rx_buff_out_index] == ';')
-                    {
-                        dObj->semicoln_cnt++;
-                        if(dObj->semicoln_cnt == 3)
-                        {
-                            dObj->semicoln_cnt                = 0;
-                            dObj->rx_buff_out_index++;
-                            dObj->current_heartrate           = 0;
-                            dObj->heartrate9_read_byte_state  = HEART_RATE_READ;
-                            break;
-                        }
-                    }
-                }
-                break;
-            case HEART_RATE_READ:
-                for(; dObj->rx_buff_out_index < lcl_rx_buff_in_index; dObj->rx_buff_out_index++)
-                {
-                    if(dObj->rx_buff[dObj->rx_buff_out_index] != ';')
-                    {
-                        dObj->current_heartrate   = (dObj->current_heartrate * 10) + (dObj->rx_buff[dObj->rx_buff_out_index] - 0x30);
-                    }
-                    else
-                    {
-                        dObj->heartrate9_read_byte_state  = HEADER_BYTE1;
-                        dObj->heartrate_pross_cnt++;
-                        if(dObj->heartrate_pross_cnt == 100)
-                        {
-                            dObj->heartrate_pross_cnt         = 0;
-                            dObj->hr9_rx_data_buf_clr_state   = false;
-                            return((int8_t)dObj->current_heartrate);
-                        }
-                        break;
-                    }
-                }
-                break;
-            default:
-                break;
+            clientObj->sampleCallback(clientObj->clientHandle, &sample);
         }
     }
-    if(dObj->rx_buff_out_index == DRV_RECEIVE_HEARTRATE_DATA_SIZE)
+}
+
+static RAMFUNC int8_t heartrate9_read_byte(DRV_HEARTRATE_OBJ *dObj)
+{
+
+    uint16_t lcl_rx_buff_in_index = dObj->rx_buff_in_index;
+    const DRV_HEARTRATE_FRAME *frame = &dObj->frameParser.frame;
+    bool frameComplete;
+
+    while(dObj->rx_buff_out_index != lcl_rx_buff_in_index)
     {
-        dObj->rx_buff_out_index = 0;
+        /* Parse up to the end of the ring first when the data wraps */
+        uint16_t end = (dObj->rx_buff_out_index > lcl_rx_buff_in_index) ? DRV_RECEIVE_HEARTRATE_DATA_SIZE : lcl_rx_buff_in_index;
+
+        dObj->rx_buff_out_index += DRV_HEARTRATE_FrameParse(&dObj->frameParser, &dObj->rx_buff[dObj->rx_buff_out_index],
+                                        end - dObj->rx_buff_out_index, &frameComplete);
+        if(dObj->rx_buff_out_index == DRV_RECEIVE_HEARTRATE_DATA_SIZE)
+        {
+            dObj->rx_buff_out_index = 0;
+        }
+
+        if(false == frameComplete)
+        {
+            continue;
+        }
+
+        SYS_BOOT_Mark(SYS_BOOT_MILESTONE_FIRST_FRAME);
+
+        /* A field with a stray character or a heart rate out of range is a
+           damaged or spliced frame, its heart rate is not a measurement */
+        if((frame->quality & (DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT | DRV_HEARTRATE_FRAME_QUALITY_OVERFLOW)) != 0U)
+        {
+            continue;
+        }
+
+        if(false == _DRV_HEARTRATE_SessionFrame(dObj, frame->heartRate))
+        {
+            continue;
+        }
+
+        _DRV_HEARTRATE_SampleNotify(dObj, frame);
+
+        /* The first valid heart rate after startup or a window start is
+           reported right away instead of after a full decimation */
+        dObj->heartrate_pross_cnt++;
+        if((dObj->heartrate_pross_cnt >= dObj->reportDecimation) ||
+           ((true == dObj->firstReportPending) && (frame->quality == DRV_HEARTRATE_FRAME_QUALITY_HR_VALID)))
+        {
+            dObj->firstReportPending          = (frame->quality != DRV_HEARTRATE_FRAME_QUALITY_HR_VALID);
+            dObj->heartrate_pross_cnt         = 0;
+            return((int8_t)frame->heartRate);
+        }
     }
 
     return(-1);
@@ -0,0 +1,174 @@
+/*******************************************************************************
+  HEARTRATE Driver Frame Parser Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_heartrate_frame.c
+
+  Summary:
+    Parser for the text frames sent by the Heart Rate 9 click.
+
+  Description:
+    This file is built into the firmware and into the host tools. Define
+    RAMFUNC_DISABLE for host builds.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "toolchain_specifics.h"
+#include "drv_heartrate_frame.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+void DRV_HEARTRATE_FrameParserReset( DRV_HEARTRATE_FRAME_PARSER *parser )
+{
+    memset(parser, 0, sizeof(*parser));
+
+    parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER1;
+}
+
+RAMFUNC size_t DRV_HEARTRATE_FrameParse( DRV_HEARTRATE_FRAME_PARSER *parser, const uint8_t *data, size_t size, bool *complete )
+{
+    size_t index = 0U;
+    uint8_t c;
+
+    *complete = false;
+
+    while (index < size)
+    {
+        c = data[index];
+        index++;
+
+        switch (parser->state)
+        {
+            case DRV_HEARTRATE_FRAME_STATE_HEADER1:
+                if (c == (uint8_t)'1')
+                {
+                    parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER2;
+                }
+                else
+                {
+                    parser->skippedBytes++;
+                }
+                break;
+
+            case DRV_HEARTRATE_FRAME_STATE_HEADER2:
+                if (c == (uint8_t)'5')
+                {
+                    parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER3;
+                }
+                else
+                {
+                    parser->headerErrors++;
+                    parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER1;
+                }
+                break;
+
+            case DRV_HEARTRATE_FRAME_STATE_HEADER3:
+                if (c == (uint8_t)';')
+                {
+                    memset(&parser->frame, 0, sizeof(parser->frame));
+                    parser->field = 0U;
+                    parser->state = DRV_HEARTRATE_FRAME_STATE_CHANNEL;
+                }
+                else
+                {
+                    parser->headerErrors++;
+                    parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER1;
+                }
+                break;
+
+            case DRV_HEARTRATE_FRAME_STATE_CHANNEL:
+                if (c == (uint8_t)';')
+                {
+                    parser->field++;
+                    if (parser->field == DRV_HEARTRATE_FRAME_CHANNELS)
+                    {
+                        parser->value = 0U;
+                        parser->state = DRV_HEARTRATE_FRAME_STATE_HEART_RATE;
+                    }
+                }
+                else if ((c >= (uint8_t)'0') && (c <= (uint8_t)'9'))
+                {
+                    parser->frame.channel[parser->field] = (parser->frame.channel[parser->field] * 10U) + (uint32_t)(c - (uint8_t)'0');
+                }
+                else
+                {
+                    parser->frame.quality |= DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT;
+                }
+                break;
+
+            case DRV_HEARTRATE_FRAME_STATE_HEART_RATE:
+                if (c != (uint8_t)';')
+                {
+                    if ((c < (uint8_t)'0') || (c > (uint8_t)'9'))
+                    {
+                        parser->frame.quality |= DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT;
+                    }
+                    parser->value = (parser->value * 10U) + (uint32_t)c - (uint32_t)'0';
+                    break;
+                }
+
+                parser->frame.heartRate = (uint8_t)parser->value;
+
+                if (parser->value > 0xFFU)
+                {
+                    parser->frame.quality |= DRV_HEARTRATE_FRAME_QUALITY_OVERFLOW;
+                }
+                if (parser->frame.heartRate != 0U)
+                {
+                    parser->frame.quality |= DRV_HEARTRATE_FRAME_QUALITY_HR_VALID;
+                }
+
+                parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER1;
+                *complete = true;
+                return index;
+
+            default:
+                parser->state = DRV_HEARTRATE_FRAME_STATE_HEADER1;
+                break;
+        }
+    }
+
+    return index;
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,184 @@
+/*******************************************************************************
+  HEARTRATE Driver Frame Parser
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_heartrate_frame.h
+
+  Summary:
+    Parser for the text frames sent by the Heart Rate 9 click.
+
+  Description:
+    The click sends one frame per sample in the form "15;ch0;ch1;ch2;hr;".
+    The parser is fed with chunks of received bytes and reports every complete
+    frame. It does not depend on any Harmony module, so the same source is
+    built into the host tools.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_HEARTRATE_FRAME_H
+#define DRV_HEARTRATE_FRAME_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Raw optical channels between the header and the heart rate field */
+#define DRV_HEARTRATE_FRAME_CHANNELS                3U
+
+/* Frame quality flags */
+#define DRV_HEARTRATE_FRAME_QUALITY_HR_VALID        0x01U   /* heart rate field is not zero */
+#define DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT       0x02U   /* a field held a character other than a digit */
+#define DRV_HEARTRATE_FRAME_QUALITY_OVERFLOW        0x04U   /* the heart rate did not fit in 8 bits */
+
+typedef enum
+{
+    DRV_HEARTRATE_FRAME_STATE_HEADER1 = 0,
+    DRV_HEARTRATE_FRAME_STATE_HEADER2,
+    DRV_HEARTRATE_FRAME_STATE_HEADER3,
+    DRV_HEARTRATE_FRAME_STATE_CHANNEL,
+    DRV_HEARTRATE_FRAME_STATE_HEART_RATE,
+
+} DRV_HEARTRATE_FRAME_STATE;
+
+typedef struct
+{
+    uint32_t    channel[DRV_HEARTRATE_FRAME_CHANNELS];
+
+    /* Heart rate field, modulo 256 as the sensor frames were always read */
+    uint8_t     heartRate;
+
+    /* DRV_HEARTRATE_FRAME_QUALITY_* flags */
+    uint8_t     quality;
+
+} DRV_HEARTRATE_FRAME;
+
+typedef struct
+{
+    DRV_HEARTRATE_FRAME_STATE   state;
+
+    /* Channel field being read */
+    uint8_t                     field;
+
+    /* Heart rate field value before truncation */
+    uint32_t                    value;
+
+    /* Last complete frame, valid when DRV_HEARTRATE_FrameParse reports one */
+    DRV_HEARTRATE_FRAME         frame;
+
+    /* Bytes skipped while looking for a frame header */
+    uint32_t                    skippedBytes;
+
+    /* Partial headers that did not continue with "5;" */
+    uint32_t                    headerErrors;
+
+} DRV_HEARTRATE_FRAME_PARSER;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    void DRV_HEARTRATE_FrameParserReset( DRV_HEARTRATE_FRAME_PARSER *parser )
+
+  Summary:
+    Drops any partial frame and clears the error counters.
+
+  Description:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void DRV_HEARTRATE_FrameParserReset( DRV_HEARTRATE_FRAME_PARSER *parser );
+
+// *****************************************************************************
+/* Function:
+    size_t DRV_HEARTRATE_FrameParse( DRV_HEARTRATE_FRAME_PARSER *parser,
+        const uint8_t *data, size_t size, bool *complete )
+
+  Summary:
+    Consumes received bytes up to the end of the next frame.
+
+  Description:
+    The parser stops right after the ';' that ends a frame and sets complete,
+    the frame is then available in parser->frame. Otherwise all bytes are
+    consumed and complete is cleared.
+
+  Parameters:
+    parser   - Parser state
+    data     - Received bytes
+    size     - Number of bytes in data
+    complete - Set when a frame ended
+
+  Returns:
+    Number of bytes consumed.
+
+  Remarks:
+    Any character of the heart rate field other than ';' is accumulated as a
+    digit, which is how the driver always read the field.
+*/
+
+size_t DRV_HEARTRATE_FrameParse( DRV_HEARTRATE_FRAME_PARSER *parser, const uint8_t *data, size_t size, bool *complete );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //#ifndef DRV_HEARTRATE_FRAME_H
+
+/*******************************************************************************
+ End of File
+*/
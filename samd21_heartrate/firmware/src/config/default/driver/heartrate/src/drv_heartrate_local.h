@@ -52,7 +52,6 @@
 #include "osal/osal.h"
 
 #define DRV_RECEIVE_HEARTRATE_DATA_SIZE     (128)
-#define DRV_HEARTRATE_RECEIVE_BUFFER_SIZE  (DRV_RECEIVE_HEARTRATE_DATA_SIZE * 10)
 // *****************************************************************************
 // *****************************************************************************
 // Section: Data Type Definitions
@@ -82,6 +81,10 @@
 
 #define DRV_HEARTRATE_TOKEN_MAX                       (DRV_HEARTRATE_TOKEN_MASK >> 16)
 
+/* RTC ticks before a window start from which the sensor no longer counts as
+   off, longer than a flash row erase */
+#define DRV_HEARTRATE_SENSOR_OFF_MARGIN               (16U)
+
 
 // *****************************************************************************
 /* HEARTRATE Driver Buffer Events
@@ -110,14 +113,77 @@ typedef enum
     DRV_HEARTRATE_REQUEST_STATUS_ERROR,
 
 } DRV_HEARTRATE_REQUEST_STATUS;
+
+// *****************************************************************************
+/* HEARTRATE Driver Measurement Session States */
+
 typedef enum
 {
-    HEADER_BYTE1 = 0,
-    HEADER_BYTE2,
-    HEADER_BYTE3,
-    HEART_RATE_BYTE_POS_FIND,
-    HEART_RATE_READ,
-}HEART_RATE_DATA_BUF_PROCESS_STATE;
+    /* Scheduler disabled, the sensor streams continuously */
+    DRV_HEARTRATE_SESSION_STATE_STREAMING = 0,
+
+    /* Sensor held in reset until the next window starts */
+    DRV_HEARTRATE_SESSION_STATE_OFF,
+
+    /* Sensor released, frames are discarded while it settles */
+    DRV_HEARTRATE_SESSION_STATE_WARMUP,
+
+    /* Frames are accumulated into the window summary */
+    DRV_HEARTRATE_SESSION_STATE_ACQUIRE,
+
+    /* Sensor held in reset, frames come from the loopback self-test */
+    DRV_HEARTRATE_SESSION_STATE_LOOPBACK,
+
+} DRV_HEARTRATE_SESSION_STATE;
+
+typedef struct
+{
+    DRV_HEARTRATE_SESSION_STATE     state;
+
+    /* Schedule as configured, applied again when the loopback test ends */
+    DRV_HEARTRATE_SESSION_CONFIG    config;
+
+    /* Schedule converted to RTC ticks */
+    uint32_t                        periodTicks;
+
+    uint32_t                        windowTicks;
+
+    uint32_t                        warmupFrames;
+
+    /* RTC counter values of the next window start and the current window end */
+    uint32_t                        nextStart;
+
+    uint32_t                        windowEnd;
+
+    uint32_t                        heartRateSum;
+
+    DRV_HEARTRATE_SESSION_SUMMARY   summary;
+
+} DRV_HEARTRATE_SESSION;
+typedef struct
+{
+    volatile bool                       enabled;
+
+    /* Set by the interrupt when a record was dropped, the next one is flagged */
+    bool                                gap;
+
+    uint16_t                            sequence;
+
+    /* Byte offsets of DRV_HEARTRATE_CAPTURE_RECORD headers each followed by
+       its chunk. inIndex is written by the receive interrupt only, outIndex
+       by DRV_HEARTRATE_CaptureRead only. */
+    volatile uint32_t                   inIndex;
+
+    volatile uint32_t                   outIndex;
+
+    DRV_HEARTRATE_CAPTURE_STATISTICS    stats;
+
+#if (DRV_HEARTRATE_CAPTURE_BUFFER_SIZE > 0)
+    uint8_t                             buffer[DRV_HEARTRATE_CAPTURE_BUFFER_SIZE];
+#endif
+
+} DRV_HEARTRATE_CAPTURE;
+
 // *****************************************************************************
 /* HEARTRATE Driver Instance Object
 
@@ -174,19 +240,28 @@ typedef struct
     OSAL_MUTEX_DECLARE(clientMutex);
    
     int heartRate;
+    /* Receive ring, appended to by the read callback, one byte stays free
+       so that a full ring differs from an empty one */
     uint8_t rx_buff[DRV_RECEIVE_HEARTRATE_DATA_SIZE];
-    uint8_t rx_data[DRV_HEARTRATE_RECEIVE_BUFFER_SIZE];
-     uint32_t no_of_bytes_rcvd;
-     bool hr9_data_rx_flag;
-     //HEART_RATE_DATA_BUF_PROCESS_STATE    heartrate9_read_byte_state = HEADER_BYTE1;
-    HEART_RATE_DATA_BUF_PROCESS_STATE    heartrate9_read_byte_state;
+    DRV_HEARTRATE_FRAME_PARSER frameParser;
+    uint32_t sampleSequence;
     volatile uint16_t rx_buff_in_index;
     uint16_t rx_buff_out_index;
      bool hr9_click_intrfce_initialized;
      bool hr9_rx_data_buf_clr_state;
      uint16_t heartrate_pross_cnt;
-    uint8_t current_heartrate;
-    uint8_t semicoln_cnt;
+
+    /* Frames per heart rate report, from DRV_HEARTRATE_INIT */
+    uint16_t reportDecimation;
+
+    /* Report the next valid heart rate without waiting for the decimation */
+    bool firstReportPending;
+
+    /* Measurement window scheduler */
+    DRV_HEARTRATE_SESSION session;
+
+    /* Raw receive chunks mirrored for replay on the host */
+    DRV_HEARTRATE_CAPTURE capture;
 
 } DRV_HEARTRATE_OBJ;
 
@@ -210,6 +285,10 @@ typedef struct
     
     DRV_HEARTRATE_APP_CALLBACK     callback;
 
+    DRV_HEARTRATE_SESSION_CALLBACK sessionCallback;
+
+    DRV_HEARTRATE_SAMPLE_CALLBACK  sampleCallback;
+
 } DRV_HEARTRATE_CLIENT_OBJ;
 
 #endif //#ifndef DRV_HEARTRATE_LOCAL_H
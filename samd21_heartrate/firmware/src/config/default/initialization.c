@@ -75,61 +75,6 @@
 
 
 
-// *****************************************************************************
-// *****************************************************************************
-// Section: Driver Initialization Data
-// *****************************************************************************
-// *****************************************************************************
-// <editor-fold defaultstate="collapsed" desc="DRV_USART Instance 0 Initialization Data">
-
-static DRV_USART_CLIENT_OBJ drvUSART0ClientObjPool[DRV_USART_CLIENTS_NUMBER_IDX0];
-
-
-const DRV_USART_PLIB_INTERFACE drvUsart0PlibAPI = {
-    .readCallbackRegister = (DRV_USART_PLIB_READ_CALLBACK_REG)SERCOM2_USART_ReadCallbackRegister,
-    .read = (DRV_USART_PLIB_READ)SERCOM2_USART_Read,
-    .readIsBusy = (DRV_USART_PLIB_READ_IS_BUSY)SERCOM2_USART_ReadIsBusy,
-    .readCountGet = (DRV_USART_PLIB_READ_COUNT_GET)SERCOM2_USART_ReadCountGet,
-    .readAbort = (DRV_USART_PLIB_READ_ABORT)SERCOM2_USART_ReadAbort,
-    .writeCallbackRegister = (DRV_USART_PLIB_WRITE_CALLBACK_REG)SERCOM2_USART_WriteCallbackRegister,
-    .write = (DRV_USART_PLIB_WRITE)SERCOM2_USART_Write,
-    .writeIsBusy = (DRV_USART_PLIB_WRITE_IS_BUSY)SERCOM2_USART_WriteIsBusy,
-    .writeCountGet = (DRV_USART_PLIB_WRITE_COUNT_GET)SERCOM2_USART_WriteCountGet,
-    .errorGet = (DRV_USART_PLIB_ERROR_GET)SERCOM2_USART_ErrorGet,
-    .serialSetup = (DRV_USART_PLIB_SERIAL_SETUP)SERCOM2_USART_SerialSetup
-};
-
-const uint32_t drvUsart0remapDataWidth[] = { 0x5, 0x6, 0x7, 0x0, 0x1 };
-const uint32_t drvUsart0remapParity[] = { 0x2, 0x0, 0x80000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
-const uint32_t drvUsart0remapStopBits[] = { 0x0, 0xFFFFFFFF, 0x40 };
-const uint32_t drvUsart0remapError[] = { 0x4, 0x0, 0x2 };
-
-const DRV_USART_INIT drvUsart0InitData =
-{
-    .usartPlib = &drvUsart0PlibAPI,
-
-    /* USART Number of clients */
-    .numClients = DRV_USART_CLIENTS_NUMBER_IDX0,
-
-    /* USART Client Objects Pool */
-    .clientObjPool = (uintptr_t)&drvUSART0ClientObjPool[0],
-
-
-    .remapDataWidth = drvUsart0remapDataWidth,
-
-    .remapParity = drvUsart0remapParity,
-
-    .remapStopBits = drvUsart0remapStopBits,
-
-    .remapError = drvUsart0remapError,
-
-    .dataWidth = DRV_USART_DATA_8_BIT,
-};
-
-// </editor-fold>
-
-
-
 // *****************************************************************************
 // *****************************************************************************
 // Section: Driver Initialization Data
@@ -154,13 +99,25 @@ const DRV_HEARTRATE_PLIB_INTERFACE drvHeartRatet0PlibAPI = {
 };
 
 
-const DRV_HEARTRATE_INIT drvHeartRate0InitData =
+/* Not const, the SYS_CFG items below replace the tunables before the driver
+   is initialized */
+DRV_HEARTRATE_INIT drvHeartRate0InitData =
 {
      .clientObjPool = (uintptr_t)&drvHEARTRATE0ClientObjPool[0],
      .heartratePlib = &drvHeartRatet0PlibAPI,
 
     /* USART Number of clients */
     .numClients = DRV_HEARTRATE_CLIENTS_NUMBER_IDX0,
+
+    /* Measurement window schedule */
+    .sessionPeriodMs = DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0,
+    .sessionWindowMs = DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0,
+    .sessionWarmupFrames = DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0,
+
+    /* Receive path and start-up */
+    .readThreshold = DRV_HEARTRATE_READ_THRESHOLD_IDX0,
+    .reportDecimation = DRV_HEARTRATE_REPORT_DECIMATION_IDX0,
+    .startupDelayMs = DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0,
 };
 
 // </editor-fold>
@@ -209,9 +166,20 @@ const SYS_CONSOLE_UART_PLIB_INTERFACE sysConsole0UARTPlibAPI =
 	.writeFreeBufferCountGet = (SYS_CONSOLE_UART_PLIB_WRITE_FREE_BUFFER_COUNT_GET)SERCOM3_USART_WriteFreeBufferCountGet,
 };
 
+#if (SYS_CONSOLE_UART_STAGING_BUFFER_SIZE_IDX0 > 0U)
+static uint8_t sysConsole0StagingBuffer[SYS_CONSOLE_UART_STAGING_BUFFER_SIZE_IDX0];
+#endif
+
 const SYS_CONSOLE_UART_INIT_DATA sysConsole0UARTInitData =
 {
     .uartPLIB = &sysConsole0UARTPlibAPI,    
+#if (SYS_CONSOLE_UART_STAGING_BUFFER_SIZE_IDX0 > 0U)
+    .stagingBuffer = sysConsole0StagingBuffer,
+    .stagingBufferSize = SYS_CONSOLE_UART_STAGING_BUFFER_SIZE_IDX0,
+#else
+    .stagingBuffer = NULL,
+    .stagingBufferSize = 0U,
+#endif
 };
 
 const SYS_CONSOLE_INIT sysConsole0Init =
@@ -225,6 +193,276 @@ const SYS_CONSOLE_INIT sysConsole0Init =
 
 // </editor-fold>
 
+// <editor-fold defaultstate="collapsed" desc="SYS_POWER Initialization Data">
+
+static SYS_POWER_MODE sysPowerHeartRateModeGet(void)
+{
+    /* SERCOM0 runs in standby with start-of-frame detection, so the device
+       can sleep until the next sensor byte arrives */
+    return DRV_HEARTRATE_IsIdle(sysObj.drvHeartRate0) ? SYS_POWER_MODE_STANDBY : SYS_POWER_MODE_READY;
+}
+
+static SYS_POWER_MODE sysPowerConsoleModeGet(void)
+{
+    /* Received characters must be handed to the command processor first */
+    if (SERCOM3_USART_ReadCountGet() != 0U)
+    {
+        return SYS_POWER_MODE_READY;
+    }
+
+    /* Staged output is moved to the transmit ring by SYS_CONSOLE_Tasks as
+       soon as the ring has room */
+    if ((SYS_CONSOLE_WriteCountGet(SYS_CONSOLE_INDEX_0) > (ssize_t)SERCOM3_USART_WriteCountGet()) &&
+        (SERCOM3_USART_WriteFreeBufferCountGet() != 0U))
+    {
+        return SYS_POWER_MODE_READY;
+    }
+
+    /* The transmitter is clocked on demand only while receiving, let the
+       data register empty interrupts drain the ring from IDLE */
+    if ((SERCOM3_USART_WriteCountGet() != 0U) || (SERCOM3_USART_TransmitComplete() == false))
+    {
+        return SYS_POWER_MODE_IDLE;
+    }
+
+    return SYS_POWER_MODE_STANDBY;
+}
+
+static SYS_POWER_MODE sysPowerTlogModeGet(void)
+{
+    /* Queued records are moved to the console by SYS_TLOG_Tasks */
+    return SYS_TLOG_IsIdle() ? SYS_POWER_MODE_STANDBY : SYS_POWER_MODE_READY;
+}
+
+static SYS_POWER_MODE sysPowerTelemetryModeGet(void)
+{
+    /* A full or expired batch is encoded and sent by SYS_TELEMETRY_Tasks */
+    if (SYS_TELEMETRY_IsIdle() == false)
+    {
+        return SYS_POWER_MODE_READY;
+    }
+
+    /* The frame in flight is sent by the data register empty interrupt */
+    if ((SERCOM2_USART_WriteIsBusy() == true) || (SERCOM2_USART_TransmitComplete() == false))
+    {
+        return SYS_POWER_MODE_IDLE;
+    }
+
+    return SYS_POWER_MODE_STANDBY;
+}
+
+static SYS_POWER_MODE sysPowerCfgModeGet(void)
+{
+    /* A requested save is written by SYS_CFG_Tasks */
+    return SYS_CFG_IsIdle() ? SYS_POWER_MODE_STANDBY : SYS_POWER_MODE_READY;
+}
+
+static SYS_POWER_MODE sysPowerFlashLogModeGet(void)
+{
+    /* Flash operations are polled for completion by SYS_FLASHLOG_Tasks */
+    return SYS_FLASHLOG_IsIdle() ? SYS_POWER_MODE_STANDBY : SYS_POWER_MODE_READY;
+}
+
+static SYS_POWER_MODE sysPowerLoopbackModeGet(void)
+{
+    /* While frames are sent the telemetry client keeps the device in IDLE */
+    return SYS_LOOPBACK_IsIdle() ? SYS_POWER_MODE_STANDBY : SYS_POWER_MODE_READY;
+}
+
+static const SYS_POWER_CLIENT_MODE_GET sysPowerClients[] =
+{
+    sysPowerHeartRateModeGet,
+    sysPowerConsoleModeGet,
+    sysPowerTlogModeGet,
+    sysPowerTelemetryModeGet,
+    sysPowerFlashLogModeGet,
+    sysPowerCfgModeGet,
+    sysPowerLoopbackModeGet,
+};
+
+static uint32_t sysPowerHeartRateBacklogGet(void)
+{
+    return DRV_HEARTRATE_BacklogGet(sysObj.drvHeartRate0);
+}
+
+static uint32_t sysPowerConsoleBacklogGet(void)
+{
+    return SERCOM3_USART_ReadCountGet();
+}
+
+static const SYS_POWER_CLIENT_BACKLOG_GET sysPowerBacklogClients[] =
+{
+    sysPowerHeartRateBacklogGet,
+    sysPowerConsoleBacklogGet,
+};
+
+static bool sysPowerSercom0IsIdle(void)
+{
+    /* A sensor character being received would be corrupted by the switch */
+    if ((SERCOM0_USART_ReceiverIsIdle() == false) || (SERCOM0_USART_ReadCountGet() != 0U))
+    {
+        return false;
+    }
+
+    return (SERCOM0_USART_WriteCountGet() == 0U) && SERCOM0_USART_TransmitComplete();
+}
+
+static bool sysPowerSercom2IsIdle(void)
+{
+    return (SERCOM2_USART_WriteIsBusy() == false) && SERCOM2_USART_TransmitComplete();
+}
+
+static bool sysPowerSercom3IsIdle(void)
+{
+    return (SERCOM3_USART_WriteCountGet() == 0U) && SERCOM3_USART_TransmitComplete();
+}
+
+/* Settings programmed by the SERCOMx_USART_Initialize functions */
+static const SYS_POWER_SERIAL_PORT sysPowerSerialPorts[] =
+{
+    {
+        .serialSetup = SERCOM0_USART_SerialSetup,
+        .isIdle = sysPowerSercom0IsIdle,
+        .setup = { .baudRate = SERCOM0_USART_BAUD_RATE, .parity = USART_PARITY_NONE, .dataWidth = USART_DATA_8_BIT, .stopBits = USART_STOP_1_BIT },
+    },
+    {
+        .serialSetup = SERCOM2_USART_SerialSetup,
+        .isIdle = sysPowerSercom2IsIdle,
+        .setup = { .baudRate = SERCOM2_USART_BAUD_RATE, .parity = USART_PARITY_NONE, .dataWidth = USART_DATA_8_BIT, .stopBits = USART_STOP_1_BIT },
+    },
+    {
+        .serialSetup = SERCOM3_USART_SerialSetup,
+        .isIdle = sysPowerSercom3IsIdle,
+        .setup = { .baudRate = SERCOM3_USART_BAUD_RATE, .parity = USART_PARITY_NONE, .dataWidth = USART_DATA_8_BIT, .stopBits = USART_STOP_1_BIT },
+    },
+};
+
+const SYS_POWER_INIT sysPowerInit =
+{
+    .clients = sysPowerClients,
+    .numClients = sizeof(sysPowerClients) / sizeof(sysPowerClients[0]),
+    .deepestMode = SYS_POWER_DEEPEST_MODE,
+    .backlogClients = sysPowerBacklogClients,
+    .numBacklogClients = sizeof(sysPowerBacklogClients) / sizeof(sysPowerBacklogClients[0]),
+    .serialPorts = sysPowerSerialPorts,
+    .numSerialPorts = sizeof(sysPowerSerialPorts) / sizeof(sysPowerSerialPorts[0]),
+    .backlogHighThreshold = SYS_POWER_BACKLOG_HIGH_THRESHOLD,
+    .backlogLowThreshold = SYS_POWER_BACKLOG_LOW_THRESHOLD,
+    .lowPowerDelay = SYS_POWER_LOW_POWER_DELAY,
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_TELEMETRY Initialization Data">
+
+static const SYS_TELEMETRY_PLIB_INTERFACE sysTelemetryPlibAPI =
+{
+    .write = SERCOM2_USART_Write,
+    .writeIsBusy = SERCOM2_USART_WriteIsBusy,
+};
+
+static const SYS_TELEMETRY_INIT sysTelemetryInit =
+{
+    .plib = &sysTelemetryPlibAPI,
+    .heartRateIndex = DRV_HEARTRATE_INDEX_0,
+    .flushTicks = (SYS_TELEMETRY_FLUSH_MS * RTC_TIMER32_FREQUENCY) / 1000U,
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_LOOPBACK Initialization Data">
+
+static const SYS_LOOPBACK_SOURCE_PLIB_INTERFACE sysLoopbackSourcePlibAPI =
+{
+    .serialSetup = SERCOM2_USART_SerialSetup,
+    .write = SERCOM2_USART_Write,
+    .writeIsBusy = SERCOM2_USART_WriteIsBusy,
+    .transmitComplete = SERCOM2_USART_TransmitComplete,
+    .writeCallbackRegister = SERCOM2_USART_WriteCallbackRegister,
+};
+
+static const SYS_LOOPBACK_SINK_PLIB_INTERFACE sysLoopbackSinkPlibAPI =
+{
+    .serialSetup = SERCOM0_USART_SerialSetup,
+    .statsGet = SERCOM0_USART_StatsGet,
+};
+
+static const uint32_t sysLoopbackBaudRates[] =
+{
+    115200U, 230400U, 460800U, 921600U, 1500000U, 2000000U, 3000000U, 4000000U, 6000000U, 8000000U,
+};
+
+static const SYS_LOOPBACK_INIT sysLoopbackInit =
+{
+    .source = &sysLoopbackSourcePlibAPI,
+    .sink = &sysLoopbackSinkPlibAPI,
+    .heartRateIndex = DRV_HEARTRATE_INDEX_0,
+    .baudRates = sysLoopbackBaudRates,
+    .numBaudRates = sizeof(sysLoopbackBaudRates) / sizeof(sysLoopbackBaudRates[0]),
+    .setup = { .baudRate = SERCOM0_USART_BAUD_RATE, .parity = USART_PARITY_NONE, .dataWidth = USART_DATA_8_BIT, .stopBits = USART_STOP_1_BIT },
+    .stepTicks = (SYS_LOOPBACK_STEP_MS * RTC_TIMER32_FREQUENCY) / 1000U,
+    .drainTicks = (SYS_LOOPBACK_DRAIN_MS * RTC_TIMER32_FREQUENCY) / 1000U,
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_FLASHLOG Initialization Data">
+
+static bool sysFlashLogIsQuiet(void)
+{
+    return DRV_HEARTRATE_SensorIsOff(sysObj.drvHeartRate0);
+}
+
+static const SYS_FLASHLOG_INIT sysFlashLogInit =
+{
+    .startAddress = SYS_FLASHLOG_START_ADDRESS,
+    .size = SYS_FLASHLOG_SIZE,
+    .recordSize = APP_HEARTRATE_LOG_BLOCK_SIZE,
+    .isQuiet = sysFlashLogIsQuiet,
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SYS_CFG Initialization Data">
+
+/* Append new items at the end, bump the version when items are removed or
+   reordered */
+static const SYS_CFG_ITEM sysCfgItems[] =
+{
+    { "threshold",  &drvHeartRate0InitData.readThreshold,       1U, 64U },
+    { "decimation", &drvHeartRate0InitData.reportDecimation,    1U, 0xFFFFU },
+    { "startup",    &drvHeartRate0InitData.startupDelayMs,      0U, 10000U },
+    { "period",     &drvHeartRate0InitData.sessionPeriodMs,     0U, 86400000U },
+    { "window",     &drvHeartRate0InitData.sessionWindowMs,     1000U, 86400000U },
+    { "warmup",     &drvHeartRate0InitData.sessionWarmupFrames, 0U, 0xFFFFU },
+};
+
+static bool sysCfgIsValid(void)
+{
+    /* Same rule as DRV_HEARTRATE_SessionConfigure */
+    return (drvHeartRate0InitData.sessionPeriodMs == 0U) ||
+           (drvHeartRate0InitData.sessionWindowMs < drvHeartRate0InitData.sessionPeriodMs);
+}
+
+static bool sysCfgIsQuiet(void)
+{
+    /* A continuously streaming sensor is never off, accept losing a few
+       bytes once rather than never saving */
+    return (drvHeartRate0InitData.sessionPeriodMs == 0U) || DRV_HEARTRATE_SensorIsOff(sysObj.drvHeartRate0);
+}
+
+static const SYS_CFG_INIT sysCfgInit =
+{
+    .startAddress = SYS_CFG_START_ADDRESS,
+    .size = SYS_CFG_SIZE,
+    .version = 1U,
+    .items = sysCfgItems,
+    .numItems = sizeof(sysCfgItems) / sizeof(sysCfgItems[0]),
+    .isValid = sysCfgIsValid,
+    .isQuiet = sysCfgIsQuiet,
+};
+
+// </editor-fold>
 
 
 
@@ -251,12 +489,16 @@ void SYS_Initialize ( void* data )
     /* MISRAC 2012 deviation block start */
     /* MISRA C-2012 Rule 2.2 deviated in this file.  Deviation record ID -  H3_MISRAC_2012_R_2_2_DR_1 */
 
+    /* Before anything else, the boot time is counted from the reset handler */
+    SYS_BOOT_Initialize();
+
     NVMCTRL_REGS->NVMCTRL_CTRLB = NVMCTRL_CTRLB_RWS(3UL);
 
   
     PORT_Initialize();
 
     CLOCK_Initialize();
+    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_CLOCKS);
 
 
 
@@ -265,21 +507,45 @@ void SYS_Initialize ( void* data )
 
     NVMCTRL_Initialize( );
 
+    /* Tunables of the modules initialized below */
+    SYS_CFG_Initialize(&sysCfgInit);
+
     SERCOM2_USART_Initialize();
 
 
     SERCOM0_USART_Initialize();
 
-	SYSTICK_TimerInitialize();
+    RTC_Initialize();
+    RTC_Timer32Start();
+    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_PERIPHERALS);
 
-    sysObj.drvUsart0 = DRV_USART_Initialize(DRV_USART_INDEX_0, (SYS_MODULE_INIT *)&drvUsart0InitData);
+	SYSTICK_TimerInitialize();
 
     sysObj.drvHeartRate0 = DRV_HEARTRATE_Initialize(DRV_HEARTRATE_INDEX_0, (SYS_MODULE_INIT *)&drvHeartRate0InitData);
+    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_DRIVER);
 
     SYS_CMD_Initialize((SYS_MODULE_INIT*)&sysCmdInit);
 
     sysObj.sysConsole0 = SYS_CONSOLE_Initialize(SYS_CONSOLE_INDEX_0, (SYS_MODULE_INIT *)&sysConsole0Init);
 
+    SYS_POWER_Initialize(&sysPowerInit);
+
+    SYS_PROFILE_Initialize();
+
+    SYS_BENCH_Initialize();
+
+    SYS_STACK_Initialize();
+
+    SYS_TLOG_Initialize();
+
+    SYS_LOG_Initialize();
+
+    SYS_TELEMETRY_Initialize(&sysTelemetryInit);
+
+    SYS_LOOPBACK_Initialize(&sysLoopbackInit);
+
+    SYS_FLASHLOG_Initialize(&sysFlashLogInit);
+
 
 
     APP_Initialize();
@@ -287,6 +553,8 @@ void SYS_Initialize ( void* data )
 
     NVIC_Initialize();
 
+    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_SYSTEM);
+
     /* MISRAC 2012 deviation block end */
 }
 
@@ -67,6 +67,21 @@ extern const H3DeviceVectors exception_table;
 
 extern void Dummy_Handler(void);
 
+#if (SYS_PROFILE_ENABLE == 1)
+/* Measures the complete sensor receive interrupt, including the call into SRAM */
+static void SERCOM0_USART_ProfiledInterruptHandler(void)
+{
+    uint32_t profileStart = SYS_PROFILE_START();
+
+    SERCOM0_USART_InterruptHandler();
+
+    SYS_PROFILE_STOP(SYS_PROFILE_ID_SERCOM0_ISR, profileStart);
+}
+#define SERCOM0_VECTOR_HANDLER     SERCOM0_USART_ProfiledInterruptHandler
+#else
+#define SERCOM0_VECTOR_HANDLER     SERCOM0_USART_InterruptHandler
+#endif
+
 /* Brief default interrupt handler for unused IRQs.*/
 void __attribute__((optimize("-O1"),section(".text.Dummy_Handler"),long_call, noreturn))Dummy_Handler(void)
 {
@@ -76,7 +91,7 @@ void __attribute__((optimize("-O1"),section(".text.Dummy_Handler"),long_call, no
 }
 
 /* MISRAC 2012 deviation block start */
-/* MISRA C-2012 Rule 8.6 deviated 24 times.  Deviation record ID -  H3_MISRAC_2012_R_8_6_DR_1 */
+/* MISRA C-2012 Rule 8.6 deviated 23 times.  Deviation record ID -  H3_MISRAC_2012_R_8_6_DR_1 */
 /* Device vectors list dummy definition*/
 extern void SVCall_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void PendSV_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -84,7 +99,6 @@ extern void SysTick_Handler            ( void ) __attribute__((weak, alias("Dumm
 extern void PM_Handler                 ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void SYSCTRL_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void WDT_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void RTC_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void NVMCTRL_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DMAC_Handler               ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -125,13 +139,13 @@ const H3DeviceVectors exception_table=
     .pfnPM_Handler                 = PM_Handler,
     .pfnSYSCTRL_Handler            = SYSCTRL_Handler,
     .pfnWDT_Handler                = WDT_Handler,
-    .pfnRTC_Handler                = RTC_Handler,
+    .pfnRTC_Handler                = RTC_InterruptHandler,
     .pfnEIC_Handler                = EIC_Handler,
     .pfnNVMCTRL_Handler            = NVMCTRL_Handler,
     .pfnDMAC_Handler               = DMAC_Handler,
     .pfnUSB_Handler                = USB_Handler,
     .pfnEVSYS_Handler              = EVSYS_Handler,
-    .pfnSERCOM0_Handler            = SERCOM0_USART_InterruptHandler,
+    .pfnSERCOM0_Handler            = SERCOM0_VECTOR_HANDLER,
     .pfnSERCOM1_Handler            = SERCOM1_Handler,
     .pfnSERCOM2_Handler            = SERCOM2_USART_InterruptHandler,
     .pfnSERCOM3_Handler            = SERCOM3_USART_InterruptHandler,
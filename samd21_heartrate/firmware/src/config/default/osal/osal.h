@@ -248,15 +248,15 @@
 
   Example:
     <code>
-    if (OSAL_SEM_Pend(&semUARTRX, 50) == OSAL_RESULT_TRUE)
+    if (OSAL_SEM_Pend(&semHeartRate, 50) == OSAL_RESULT_TRUE)
     {
-        // character available
-        c = DRV_USART_ReadByte(drvID);
+        // heart rate available
+        hr = DRV_HEARTRATE_Read(drvID);
         ...
     }
     else
     {
-        // character not available, resend prompt
+        // heart rate not available, retry later
         ...
     }
     </code>
@@ -436,7 +436,7 @@
      // prevent other tasks pre-empting this sequence of code
      IntState = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_HIGH);
      // modify the peripheral
-     DRV_USART_Reinitialize( objUSART,  &initData);
+     SERCOM0_USART_SerialSetup( &serialSetup, 0);
      OSAL_CRIT_Leave(OSAL_CRIT_TYPE_HIGH, IntState);
     </code>
 
@@ -484,7 +484,7 @@
      // prevent other tasks pre-empting this sequence of code
      intState = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
      // modify the peripheral
-     DRV_USART_Reinitialize( objUSART,  &initData);
+     SERCOM0_USART_SerialSetup( &serialSetup, 0);
      OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, IntState);
     </code>
 
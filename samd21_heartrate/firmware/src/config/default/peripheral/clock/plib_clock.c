@@ -42,9 +42,19 @@
 #include "device.h"
 #include "interrupts.h"
 
+#define CLOCK_DFLL48M_FREQUENCY     48000000U
+#define CLOCK_OSC8M_FREQUENCY       8000000U
+
+static CLOCK_MODE clockMode = CLOCK_MODE_HIGH_PERFORMANCE;
+
 static void SYSCTRL_Initialize(void)
 {
     SYSCTRL_REGS->SYSCTRL_OSC32K = 0x0U;
+
+    /* Keep the factory calibration, run OSC8M undivided and only while a
+     * generator selects it. Like the DFLL it may be requested in STANDBY by
+     * the SERCOM start-of-frame detection */
+    SYSCTRL_REGS->SYSCTRL_OSC8M = (SYSCTRL_REGS->SYSCTRL_OSC8M & ~SYSCTRL_OSC8M_PRESC_Msk) | SYSCTRL_OSC8M_PRESC(0U) | SYSCTRL_OSC8M_ONDEMAND_Msk | SYSCTRL_OSC8M_RUNSTDBY_Msk | SYSCTRL_OSC8M_ENABLE_Msk;
 }
 
 
@@ -82,7 +92,7 @@ static void DFLL_Initialize(void)
 static void GCLK0_Initialize(void)
 {
 
-    GCLK_REGS->GCLK_GENCTRL = GCLK_GENCTRL_SRC(7U) | GCLK_GENCTRL_GENEN_Msk | GCLK_GENCTRL_ID(0U);
+    GCLK_REGS->GCLK_GENCTRL = GCLK_GENCTRL_SRC(7U) | GCLK_GENCTRL_GENEN_Msk | GCLK_GENCTRL_RUNSTDBY_Msk | GCLK_GENCTRL_ID(0U);
 
     while((GCLK_REGS->GCLK_STATUS & GCLK_STATUS_SYNCBUSY_Msk) == GCLK_STATUS_SYNCBUSY_Msk)
     {
@@ -90,15 +100,43 @@ static void GCLK0_Initialize(void)
     }
 }
 
+static void GCLK2_Initialize(void)
+{
+    GCLK_REGS->GCLK_GENDIV = GCLK_GENDIV_DIV(1U) | GCLK_GENDIV_ID(2U);
+
+    GCLK_REGS->GCLK_GENCTRL = GCLK_GENCTRL_SRC(3U) | GCLK_GENCTRL_GENEN_Msk | GCLK_GENCTRL_RUNSTDBY_Msk | GCLK_GENCTRL_ID(2U);
+
+    while((GCLK_REGS->GCLK_STATUS & GCLK_STATUS_SYNCBUSY_Msk) == GCLK_STATUS_SYNCBUSY_Msk)
+    {
+        /* wait for the Generator 2 synchronization */
+    }
+}
+
 void CLOCK_Initialize (void)
 {
     /* Function to Initialize the Oscillators */
     SYSCTRL_Initialize();
 
+    /* Start the RTC generator while the CPU still runs from OSC8M, its
+     * synchronization waits on the slow clock either way and SYS_BOOT then
+     * counts all cycles before the switch to the DFLL at one rate */
+    GCLK2_Initialize();
+
     DFLL_Initialize();
     GCLK0_Initialize();
 
+    /* DFLL is now requested by GCLK0, so ONDEMAND can be set safely. In
+     * STANDBY it stops and is only restarted when a peripheral configured
+     * with RUNSTDBY (SERCOM start-of-frame detection) requests its clock */
+    SYSCTRL_REGS->SYSCTRL_DFLLCTRL |= (uint16_t)(SYSCTRL_DFLLCTRL_ONDEMAND_Msk | SYSCTRL_DFLLCTRL_RUNSTDBY_Msk);
 
+    while((SYSCTRL_REGS->SYSCTRL_PCLKSR & SYSCTRL_PCLKSR_DFLLRDY_Msk) != SYSCTRL_PCLKSR_DFLLRDY_Msk)
+    {
+        /* Waiting for DFLL to be ready */
+    }
+
+    /* Selection of the Generator and write Lock for RTC */
+    GCLK_REGS->GCLK_CLKCTRL = GCLK_CLKCTRL_ID(4U) | GCLK_CLKCTRL_GEN(0x2U)  | GCLK_CLKCTRL_CLKEN_Msk;
     /* Selection of the Generator and write Lock for SERCOM0_CORE */
     GCLK_REGS->GCLK_CLKCTRL = GCLK_CLKCTRL_ID(20U) | GCLK_CLKCTRL_GEN(0x0U)  | GCLK_CLKCTRL_CLKEN_Msk;
     /* Selection of the Generator and write Lock for SERCOM2_CORE */
@@ -108,8 +146,30 @@ void CLOCK_Initialize (void)
 
     /* Configure the APBC Bridge Clocks */
     PM_REGS->PM_APBCMASK = 0x10034U;
+}
+
+void CLOCK_ModeSet (CLOCK_MODE mode)
+{
+    uint32_t source = (mode == CLOCK_MODE_LOW_POWER) ? GCLK_GENCTRL_SRC_OSC8M_Val : GCLK_GENCTRL_SRC_DFLL48M_Val;
 
+    /* Both oscillators run on demand, so the new source is started by the
+     * generator itself and the old one stops once it is deselected */
+    GCLK_REGS->GCLK_GENCTRL = GCLK_GENCTRL_SRC(source) | GCLK_GENCTRL_GENEN_Msk | GCLK_GENCTRL_RUNSTDBY_Msk | GCLK_GENCTRL_ID(0U);
 
-    /*Disable RC oscillator*/
-    SYSCTRL_REGS->SYSCTRL_OSC8M = 0x0U;
+    while((GCLK_REGS->GCLK_STATUS & GCLK_STATUS_SYNCBUSY_Msk) == GCLK_STATUS_SYNCBUSY_Msk)
+    {
+        /* wait for the Generator 0 synchronization */
+    }
+
+    clockMode = mode;
+}
+
+CLOCK_MODE CLOCK_ModeGet (void)
+{
+    return clockMode;
+}
+
+uint32_t CLOCK_GCLK0FrequencyGet (void)
+{
+    return (clockMode == CLOCK_MODE_LOW_POWER) ? CLOCK_OSC8M_FREQUENCY : CLOCK_DFLL48M_FREQUENCY;
 }
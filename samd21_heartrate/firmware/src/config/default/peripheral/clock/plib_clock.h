@@ -66,6 +66,30 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+// *****************************************************************************
+/* CPU Clock Modes
+
+  Summary:
+    Identifies the source of generic clock generator 0.
+
+  Description:
+    GCLK0 clocks the CPU, the bus and all SERCOM cores. The low power mode
+    runs it from OSC8M, the high performance mode from the DFLL.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* OSC8M, 8 MHz */
+    CLOCK_MODE_LOW_POWER = 0,
+
+    /* DFLL48M open loop, 48 MHz */
+    CLOCK_MODE_HIGH_PERFORMANCE,
+
+} CLOCK_MODE;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -75,6 +99,12 @@ extern "C" {
 
 void CLOCK_Initialize (void);
 
+void CLOCK_ModeSet (CLOCK_MODE mode);
+
+CLOCK_MODE CLOCK_ModeGet (void);
+
+uint32_t CLOCK_GCLK0FrequencyGet (void);
+
 #ifdef __cplusplus // Provide C++ Compatibility
 }
 #endif
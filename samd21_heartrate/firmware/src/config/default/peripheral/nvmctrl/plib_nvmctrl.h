@@ -114,6 +114,8 @@ bool NVMCTRL_USER_ROW_RowErase( uint32_t address );
 
 void NVMCTRL_CacheInvalidate ( void );
 
+void NVMCTRL_WaitStatesSet ( uint32_t waitStates );
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus // Provide C++ Compatibility
 }
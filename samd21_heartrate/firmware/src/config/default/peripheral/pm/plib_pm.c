@@ -0,0 +1,86 @@
+/*******************************************************************************
+  Power Manager(PM) PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_pm.c
+
+  Summary:
+    PM PLIB Implementation File.
+
+  Description:
+    This file defines the interface to the PM peripheral library. This
+    library provides access to and control of the associated peripheral
+    instance.
+
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "plib_pm.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: PM Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void PM_Initialize( void )
+{
+    /* Configure default IDLE mode */
+    PM_REGS->PM_SLEEP = PM_SLEEP_IDLE(PM_IDLE_MODE_IDLE0);
+}
+
+void PM_IdleModeEnter( PM_IDLE_MODE idleMode )
+{
+    /* Configure IDLE sleep mode */
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+    PM_REGS->PM_SLEEP = PM_SLEEP_IDLE(idleMode);
+
+    /* Wait for interrupt instruction execution */
+    __DSB();
+    __WFI();
+}
+
+void PM_StandbyModeEnter( void )
+{
+    /* Configure STANDBY sleep mode */
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+
+    /* Wait for interrupt instruction execution */
+    __DSB();
+    __WFI();
+
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+}
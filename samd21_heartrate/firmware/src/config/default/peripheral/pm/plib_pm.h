@@ -0,0 +1,113 @@
+/*******************************************************************************
+  Power Manager(PM) PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_pm.h
+
+  Summary:
+    PM PLIB Header File.
+
+  Description:
+    This file defines the interface to the PM peripheral library. This
+    library provides access to and control of the associated peripheral
+    instance.
+
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLIB_PM_H    // Guards against multiple inclusion
+#define PLIB_PM_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "device.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* PM IDLE Mode Enumeration
+
+  Summary:
+    Defines the clock domains stopped in IDLE sleep mode.
+
+  Description:
+    IDLE0 stops the CPU clock, IDLE1 additionally stops the AHB clock domain
+    and IDLE2 additionally stops the APB clock domain.
+
+  Remarks:
+    Peripherals on a stopped clock domain cannot wake the device.
+*/
+
+typedef enum
+{
+    PM_IDLE_MODE_IDLE0 = PM_SLEEP_IDLE_CPU_Val,
+
+    PM_IDLE_MODE_IDLE1 = PM_SLEEP_IDLE_AHB_Val,
+
+    PM_IDLE_MODE_IDLE2 = PM_SLEEP_IDLE_APB_Val
+
+} PM_IDLE_MODE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void PM_Initialize( void );
+
+void PM_IdleModeEnter( PM_IDLE_MODE idleMode );
+
+void PM_StandbyModeEnter( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* PLIB_PM_H */
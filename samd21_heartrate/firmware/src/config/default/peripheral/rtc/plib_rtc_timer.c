@@ -0,0 +1,161 @@
+/*******************************************************************************
+  Real Time Counter (RTC) PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_rtc_timer.c
+
+  Summary:
+    RTC PLIB Implementation file
+
+  Description:
+    This file defines the interface to the RTC peripheral library. This
+    library provides access to and control of the associated peripheral
+    instance in 32-bit timer mode.
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "plib_rtc.h"
+#include "interrupts.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static RTC_OBJECT rtcObj;
+
+static inline void RTC_SyncWait(void)
+{
+    while((RTC_REGS->MODE0.RTC_STATUS & RTC_STATUS_SYNCBUSY_Msk) == RTC_STATUS_SYNCBUSY_Msk)
+    {
+        /* Wait for Synchronization */
+    }
+}
+
+void RTC_Initialize(void)
+{
+    RTC_REGS->MODE0.RTC_CTRL = RTC_MODE0_CTRL_SWRST_Msk;
+
+    while((RTC_REGS->MODE0.RTC_CTRL & RTC_MODE0_CTRL_SWRST_Msk) == RTC_MODE0_CTRL_SWRST_Msk)
+    {
+        /* Wait for Reset to complete */
+    }
+
+    /* 32-bit free running counter, the compare match does not clear it */
+    RTC_REGS->MODE0.RTC_CTRL = RTC_MODE0_CTRL_MODE_COUNT32 | RTC_MODE0_CTRL_PRESCALER_DIV32;
+
+    RTC_SyncWait();
+
+    /* Keep COUNT synchronized so that it can be read without a request */
+    RTC_REGS->MODE0.RTC_READREQ = RTC_READREQ_RCONT_Msk | RTC_READREQ_ADDR(0x10U);
+
+    rtcObj.timer32BitCallback = NULL;
+    rtcObj.context = 0U;
+    rtcObj.intCause = RTC_TIMER32_INT_MASK_INVALID;
+}
+
+void RTC_Timer32Start ( void )
+{
+    RTC_REGS->MODE0.RTC_CTRL |= RTC_MODE0_CTRL_ENABLE_Msk;
+
+    RTC_SyncWait();
+
+    /* Start continuous read synchronization of COUNT */
+    RTC_REGS->MODE0.RTC_READREQ = RTC_READREQ_RREQ_Msk | RTC_READREQ_RCONT_Msk | RTC_READREQ_ADDR(0x10U);
+}
+
+void RTC_Timer32Stop ( void )
+{
+    RTC_REGS->MODE0.RTC_CTRL &= (uint16_t)(~RTC_MODE0_CTRL_ENABLE_Msk);
+
+    RTC_SyncWait();
+}
+
+void RTC_Timer32CounterSet ( uint32_t count )
+{
+    RTC_REGS->MODE0.RTC_COUNT = count;
+
+    RTC_SyncWait();
+}
+
+uint32_t RTC_Timer32CounterGet ( void )
+{
+    RTC_SyncWait();
+
+    return RTC_REGS->MODE0.RTC_COUNT;
+}
+
+uint32_t RTC_Timer32FrequencyGet ( void )
+{
+    return RTC_TIMER32_FREQUENCY;
+}
+
+void RTC_Timer32CompareSet ( uint32_t compareValue )
+{
+    RTC_REGS->MODE0.RTC_COMP = compareValue;
+
+    RTC_SyncWait();
+}
+
+void RTC_Timer32InterruptEnable( RTC_TIMER32_INT_MASK interrupt )
+{
+    RTC_REGS->MODE0.RTC_INTENSET = (uint8_t)interrupt;
+}
+
+void RTC_Timer32InterruptDisable( RTC_TIMER32_INT_MASK interrupt )
+{
+    RTC_REGS->MODE0.RTC_INTENCLR = (uint8_t)interrupt;
+}
+
+void RTC_Timer32CallbackRegister ( RTC_TIMER32_CALLBACK callback, uintptr_t context )
+{
+    rtcObj.timer32BitCallback = callback;
+
+    rtcObj.context = context;
+}
+
+void RTC_InterruptHandler( void )
+{
+    rtcObj.intCause = (RTC_TIMER32_INT_MASK)(RTC_REGS->MODE0.RTC_INTFLAG & RTC_REGS->MODE0.RTC_INTENSET);
+
+    /* Clear All Interrupts */
+    RTC_REGS->MODE0.RTC_INTFLAG = (uint8_t)RTC_MODE0_INTFLAG_Msk;
+
+    if(rtcObj.timer32BitCallback != NULL)
+    {
+        rtcObj.timer32BitCallback(rtcObj.intCause, rtcObj.context);
+    }
+}
@@ -48,8 +48,11 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "interrupts.h"
 #include "plib_sercom0_usart.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/nvic/plib_nvic.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -93,7 +96,7 @@ void SERCOM0_USART_Initialize( void )
      * Configures Sampling rate
      * Configures IBON
      */
-    SERCOM0_REGS->USART_INT.SERCOM_CTRLA = SERCOM_USART_INT_CTRLA_MODE_USART_INT_CLK | SERCOM_USART_INT_CTRLA_RXPO(0x3UL) | SERCOM_USART_INT_CTRLA_TXPO(0x1UL) | SERCOM_USART_INT_CTRLA_DORD_Msk | SERCOM_USART_INT_CTRLA_IBON_Msk | SERCOM_USART_INT_CTRLA_FORM(0x0UL) | SERCOM_USART_INT_CTRLA_SAMPR(0UL) ;
+    SERCOM0_REGS->USART_INT.SERCOM_CTRLA = SERCOM_USART_INT_CTRLA_MODE_USART_INT_CLK | SERCOM_USART_INT_CTRLA_RXPO(0x3UL) | SERCOM_USART_INT_CTRLA_TXPO(0x1UL) | SERCOM_USART_INT_CTRLA_DORD_Msk | SERCOM_USART_INT_CTRLA_IBON_Msk | SERCOM_USART_INT_CTRLA_FORM(0x0UL) | SERCOM_USART_INT_CTRLA_SAMPR(0UL) | SERCOM_USART_INT_CTRLA_RUNSTDBY_Msk ;
 
     /* Configure Baud Rate */
     SERCOM0_REGS->USART_INT.SERCOM_BAUD = (uint16_t)SERCOM_USART_INT_BAUD_BAUD(SERCOM0_USART_INT_BAUD_VALUE);
@@ -104,8 +107,10 @@ void SERCOM0_USART_Initialize( void )
      * Configures CHSIZE
      * Configures Parity
      * Configures Stop bits
+     * Configures Start-of-Frame Detection, so that a start bit received in
+     * STANDBY requests the generic clock and wakes the device on RXC
      */
-    SERCOM0_REGS->USART_INT.SERCOM_CTRLB = SERCOM_USART_INT_CTRLB_CHSIZE_8_BIT | SERCOM_USART_INT_CTRLB_SBMODE_1_BIT | SERCOM_USART_INT_CTRLB_RXEN_Msk | SERCOM_USART_INT_CTRLB_TXEN_Msk;
+    SERCOM0_REGS->USART_INT.SERCOM_CTRLB = SERCOM_USART_INT_CTRLB_CHSIZE_8_BIT | SERCOM_USART_INT_CTRLB_SBMODE_1_BIT | SERCOM_USART_INT_CTRLB_RXEN_Msk | SERCOM_USART_INT_CTRLB_TXEN_Msk | SERCOM_USART_INT_CTRLB_SFDE_Msk;
 
     /* Wait for sync */
     while((SERCOM0_REGS->USART_INT.SERCOM_SYNCBUSY) != 0U)
@@ -137,6 +142,7 @@ void SERCOM0_USART_Initialize( void )
     sercom0USARTObj.isWrNotificationEnabled = false;
     sercom0USARTObj.isWrNotifyPersistently = false;
     sercom0USARTObj.wrThreshold = 0U;
+    (void)memset(&sercom0USARTObj.stats, 0, sizeof(sercom0USARTObj.stats));
     if (((SERCOM0_REGS->USART_INT.SERCOM_CTRLB & SERCOM_USART_INT_CTRLB_CHSIZE_Msk) >> SERCOM_USART_INT_CTRLB_CHSIZE_Pos) != 0x01U)
     {
         sercom0USARTObj.rdBufferSize = SERCOM0_USART_READ_BUFFER_SIZE;
@@ -156,7 +162,7 @@ void SERCOM0_USART_Initialize( void )
 
 uint32_t SERCOM0_USART_FrequencyGet( void )
 {
-    return 48000000UL;
+    return CLOCK_GCLK0FrequencyGet();
 }
 
 bool SERCOM0_USART_SerialSetup( USART_SERIAL_SETUP * serialSetup, uint32_t clkFrequency )
@@ -253,8 +259,8 @@ void static SERCOM0_USART_ErrorClear( void )
 {
     uint16_t  u16dummyData = 0;
 
-    /* Clear error flag */
-    SERCOM0_REGS->USART_INT.SERCOM_INTFLAG = SERCOM_USART_INT_INTFLAG_ERROR_Msk;
+    /* Clear error flag, and the start of the flushed characters */
+    SERCOM0_REGS->USART_INT.SERCOM_INTFLAG = SERCOM_USART_INT_INTFLAG_ERROR_Msk | SERCOM_USART_INT_INTFLAG_RXS_Msk;
 
     /* Clear all errors */
     SERCOM0_REGS->USART_INT.SERCOM_STATUS = SERCOM_USART_INT_STATUS_PERR_Msk | SERCOM_USART_INT_STATUS_FERR_Msk | SERCOM_USART_INT_STATUS_BUFOVF_Msk ;
@@ -284,6 +290,7 @@ static inline bool SERCOM0_USART_RxPushByte(uint16_t rdByte)
 {
     uint32_t tempInIndex;
     uint32_t rdInIdx;
+    uint32_t rdCount;
     bool isSuccess = false;
 
     tempInIndex = sercom0USARTObj.rdInIndex + 1U;
@@ -329,17 +336,34 @@ static inline bool SERCOM0_USART_RxPushByte(uint16_t rdByte)
 
         sercom0USARTObj.rdInIndex = tempInIndex;
         isSuccess = true;
+
+        /* Ring fill after the push, for the high-water mark */
+        if (tempInIndex >= sercom0USARTObj.rdOutIndex)
+        {
+            rdCount = tempInIndex - sercom0USARTObj.rdOutIndex;
+        }
+        else
+        {
+            rdCount = (sercom0USARTObj.rdBufferSize - sercom0USARTObj.rdOutIndex) + tempInIndex;
+        }
+
+        sercom0USARTObj.stats.rx.byteCount++;
+        if (rdCount > sercom0USARTObj.stats.rx.peakCount)
+        {
+            sercom0USARTObj.stats.rx.peakCount = rdCount;
+        }
     }
     else
     {
         /* Queue is full. Data will be lost. */
+        sercom0USARTObj.stats.rx.overflowCount++;
     }
 
     return isSuccess;
 }
 
 /* This routine is only called from ISR. Hence do not disable/enable USART interrupts. */
-static void SERCOM0_USART_ReadNotificationSend(void)
+static inline void SERCOM0_USART_ReadNotificationSend(void)
 {
     uint32_t nUnreadBytesAvailable;
 
@@ -419,7 +443,7 @@ size_t SERCOM0_USART_Read(uint8_t* pRdBuffer, const size_t size)
     return nBytesRead;
 }
 
-size_t SERCOM0_USART_ReadCountGet(void)
+RAMFUNC size_t SERCOM0_USART_ReadCountGet(void)
 {
     size_t nUnreadBytesAvailable;
     uint32_t rdOutIndex;
@@ -490,6 +514,14 @@ bool SERCOM0_USART_TransmitComplete( void )
     return transmitComplete;
 }
 
+bool SERCOM0_USART_ReceiverIsIdle( void )
+{
+    /* Start-of-frame detection sets RXS on every start bit and the receive
+     * handler clears it with each character it takes. RXS still set means
+     * a character is being shifted in. */
+    return ((SERCOM0_REGS->USART_INT.SERCOM_INTFLAG & SERCOM_USART_INT_INTFLAG_RXS_Msk) == 0U);
+}
+
 /* This routine is only called from ISR. Hence do not disable/enable USART interrupts. */
 static bool SERCOM0_USART_TxPullByte(void* pWrData)
 {
@@ -535,6 +567,7 @@ static inline bool SERCOM0_USART_TxPushByte(uint16_t wrByte)
     uint32_t wrInIndex = sercom0USARTObj.wrInIndex;
     uint32_t wrOutIndex = sercom0USARTObj.wrOutIndex;
     uint32_t wrInIdx;
+    uint32_t wrCount;
 
     bool isSuccess = false;
 
@@ -562,6 +595,22 @@ static inline bool SERCOM0_USART_TxPushByte(uint16_t wrByte)
         sercom0USARTObj.wrInIndex = tempInIndex;
 
         isSuccess = true;
+
+        /* Ring fill after the push, for the high-water mark */
+        if (tempInIndex >= wrOutIndex)
+        {
+            wrCount = tempInIndex - wrOutIndex;
+        }
+        else
+        {
+            wrCount = (sercom0USARTObj.wrBufferSize - wrOutIndex) + tempInIndex;
+        }
+
+        sercom0USARTObj.stats.tx.byteCount++;
+        if (wrCount > sercom0USARTObj.stats.tx.peakCount)
+        {
+            sercom0USARTObj.stats.tx.peakCount = wrCount;
+        }
     }
     else
     {
@@ -664,6 +713,9 @@ size_t SERCOM0_USART_Write(uint8_t* pWrBuffer, const size_t size )
         }
     }
 
+    /* Bytes that did not fit into the ring */
+    sercom0USARTObj.stats.tx.overflowCount += (uint32_t)(size - nBytesWritten);
+
     /* Check if any data is pending for transmission */
     if (SERCOM0_USART_WritePendingBytesGet() > 0U)
     {
@@ -710,6 +762,24 @@ void SERCOM0_USART_WriteCallbackRegister( SERCOM_USART_RING_BUFFER_CALLBACK call
     sercom0USARTObj.wrContext = context;
 }
 
+void SERCOM0_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    *stats = sercom0USARTObj.stats;
+
+    NVIC_INT_Restore(interruptState);
+}
+
+void SERCOM0_USART_StatsReset( void )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    (void)memset(&sercom0USARTObj.stats, 0, sizeof(sercom0USARTObj.stats));
+
+    NVIC_INT_Restore(interruptState);
+}
+
 
 
 void static SERCOM0_USART_ISR_ERR_Handler( void )
@@ -721,6 +791,15 @@ void static SERCOM0_USART_ISR_ERR_Handler( void )
         /* Save the error to report later */
         sercom0USARTObj.errorStatus = errorStatus;
 
+        if ((errorStatus & USART_ERROR_OVERRUN) != USART_ERROR_NONE)
+        {
+            sercom0USARTObj.stats.overrunCount++;
+        }
+        if ((errorStatus & (USART_ERROR_PARITY | USART_ERROR_FRAMING)) != USART_ERROR_NONE)
+        {
+            sercom0USARTObj.stats.errorCount++;
+        }
+
         /* Clear error flags and flush the error bytes */
         SERCOM0_USART_ErrorClear();
 
@@ -731,12 +810,16 @@ void static SERCOM0_USART_ISR_ERR_Handler( void )
     }
 }
 
-void static SERCOM0_USART_ISR_RX_Handler( void )
+void static RAMFUNC SERCOM0_USART_ISR_RX_Handler( void )
 {
 
 
     while ((SERCOM0_REGS->USART_INT.SERCOM_INTFLAG & SERCOM_USART_INT_INTFLAG_RXC_Msk) == SERCOM_USART_INT_INTFLAG_RXC_Msk)
     {
+        /* Cleared before the character is read, a start bit that follows
+         * sets it again */
+        SERCOM0_REGS->USART_INT.SERCOM_INTFLAG = (uint8_t)SERCOM_USART_INT_INTFLAG_RXS_Msk;
+
         if (SERCOM0_USART_RxPushByte( (uint16_t)SERCOM0_REGS->USART_INT.SERCOM_DATA) == true)
         {
             SERCOM0_USART_ReadNotificationSend();
@@ -776,7 +859,7 @@ void static SERCOM0_USART_ISR_TX_Handler( void )
     }
 }
 
-void SERCOM0_USART_InterruptHandler( void )
+RAMFUNC void SERCOM0_USART_InterruptHandler( void )
 {
     bool testCondition = false;
     if(SERCOM0_REGS->USART_INT.SERCOM_INTENSET != 0U)
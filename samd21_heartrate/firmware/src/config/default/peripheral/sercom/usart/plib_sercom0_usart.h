@@ -61,6 +61,15 @@
 #endif
 // DOM-IGNORE-END
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macros
+// *****************************************************************************
+// *****************************************************************************
+
+/* Baud rate programmed by SERCOM0_USART_Initialize */
+#define SERCOM0_USART_BAUD_RATE                 (115200UL)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Routines
@@ -78,6 +87,8 @@ uint32_t SERCOM0_USART_FrequencyGet( void );
 
 bool SERCOM0_USART_TransmitComplete( void );
 
+bool SERCOM0_USART_ReceiverIsIdle( void );
+
 size_t SERCOM0_USART_Write(uint8_t* pWrBuffer, const size_t size );
 
 size_t SERCOM0_USART_WriteCountGet(void);
@@ -108,6 +119,10 @@ void SERCOM0_USART_ReadThresholdSet(uint32_t nBytesThreshold);
 
 void SERCOM0_USART_ReadCallbackRegister( SERCOM_USART_RING_BUFFER_CALLBACK callback, uintptr_t context);
 
+void SERCOM0_USART_StatsGet( SERCOM_USART_STATS * stats );
+
+void SERCOM0_USART_StatsReset( void );
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
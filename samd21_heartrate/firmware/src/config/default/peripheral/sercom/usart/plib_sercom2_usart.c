@@ -48,8 +48,11 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "interrupts.h"
 #include "plib_sercom2_usart.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/nvic/plib_nvic.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -144,11 +147,12 @@ void SERCOM2_USART_Initialize( void )
     sercom2USARTObj.txBusyStatus = false;
     sercom2USARTObj.txCallback = NULL;
     sercom2USARTObj.errorStatus = USART_ERROR_NONE;
+    (void)memset(&sercom2USARTObj.stats, 0, sizeof(sercom2USARTObj.stats));
 }
 
 uint32_t SERCOM2_USART_FrequencyGet( void )
 {
-    return 48000000UL;
+    return CLOCK_GCLK0FrequencyGet();
 }
 
 bool SERCOM2_USART_SerialSetup( USART_SERIAL_SETUP * serialSetup, uint32_t clkFrequency )
@@ -301,8 +305,19 @@ bool SERCOM2_USART_Write( void *buffer, const size_t size )
             sercom2USARTObj.txProcessedSize = processedSize;
             SERCOM2_REGS->USART_INT.SERCOM_INTENSET = (uint8_t)SERCOM_USART_INT_INTFLAG_DRE_Msk;
 
+            sercom2USARTObj.stats.tx.byteCount += (uint32_t)size;
+            if (size > sercom2USARTObj.stats.tx.peakCount)
+            {
+                sercom2USARTObj.stats.tx.peakCount = (uint32_t)size;
+            }
+
             writeStatus = true;
         }
+        else
+        {
+            /* Previous transfer still in progress, the request is lost */
+            sercom2USARTObj.stats.tx.overflowCount += (uint32_t)size;
+        }
     }
 
     return writeStatus;
@@ -422,6 +437,24 @@ void SERCOM2_USART_ReadCallbackRegister( SERCOM_USART_CALLBACK callback, uintptr
     sercom2USARTObj.rxContext = context;
 }
 
+void SERCOM2_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    *stats = sercom2USARTObj.stats;
+
+    NVIC_INT_Restore(interruptState);
+}
+
+void SERCOM2_USART_StatsReset( void )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    (void)memset(&sercom2USARTObj.stats, 0, sizeof(sercom2USARTObj.stats));
+
+    NVIC_INT_Restore(interruptState);
+}
+
 
 void static SERCOM2_USART_ISR_ERR_Handler( void )
 {
@@ -434,6 +467,15 @@ void static SERCOM2_USART_ISR_ERR_Handler( void )
         /* Save the error to be reported later */
         sercom2USARTObj.errorStatus = errorStatus;
 
+        if ((errorStatus & USART_ERROR_OVERRUN) != USART_ERROR_NONE)
+        {
+            sercom2USARTObj.stats.overrunCount++;
+        }
+        if ((errorStatus & (USART_ERROR_PARITY | USART_ERROR_FRAMING)) != USART_ERROR_NONE)
+        {
+            sercom2USARTObj.stats.errorCount++;
+        }
+
         /* Clear the error flags and flush out the error bytes */
         SERCOM2_USART_ErrorClear();
 
@@ -475,6 +517,12 @@ void static SERCOM2_USART_ISR_RX_Handler( void )
             /* Increment processed size */
             sercom2USARTObj.rxProcessedSize++;
 
+            sercom2USARTObj.stats.rx.byteCount++;
+            if (sercom2USARTObj.rxProcessedSize > sercom2USARTObj.stats.rx.peakCount)
+            {
+                sercom2USARTObj.stats.rx.peakCount = sercom2USARTObj.rxProcessedSize;
+            }
+
             if(sercom2USARTObj.rxProcessedSize == sercom2USARTObj.rxSize)
             {
                 sercom2USARTObj.rxBusyStatus = false;
@@ -61,6 +61,15 @@
 #endif
 // DOM-IGNORE-END
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macros
+// *****************************************************************************
+// *****************************************************************************
+
+/* Baud rate programmed by SERCOM2_USART_Initialize */
+#define SERCOM2_USART_BAUD_RATE                 (115200UL)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Routines
@@ -101,6 +110,10 @@ bool SERCOM2_USART_ReadAbort(void);
 
 void SERCOM2_USART_ReadCallbackRegister( SERCOM_USART_CALLBACK callback, uintptr_t context );
 
+void SERCOM2_USART_StatsGet( SERCOM_USART_STATS * stats );
+
+void SERCOM2_USART_StatsReset( void );
+
 USART_ERROR SERCOM2_USART_ErrorGet( void );
 
 uint32_t SERCOM2_USART_FrequencyGet( void );
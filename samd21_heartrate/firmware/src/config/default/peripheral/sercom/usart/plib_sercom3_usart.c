@@ -48,8 +48,11 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "interrupts.h"
 #include "plib_sercom3_usart.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/nvic/plib_nvic.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -93,7 +96,7 @@ void SERCOM3_USART_Initialize( void )
      * Configures Sampling rate
      * Configures IBON
      */
-    SERCOM3_REGS->USART_INT.SERCOM_CTRLA = SERCOM_USART_INT_CTRLA_MODE_USART_INT_CLK | SERCOM_USART_INT_CTRLA_RXPO(0x1UL) | SERCOM_USART_INT_CTRLA_TXPO(0x0UL) | SERCOM_USART_INT_CTRLA_DORD_Msk | SERCOM_USART_INT_CTRLA_IBON_Msk | SERCOM_USART_INT_CTRLA_FORM(0x0UL) | SERCOM_USART_INT_CTRLA_SAMPR(0UL) ;
+    SERCOM3_REGS->USART_INT.SERCOM_CTRLA = SERCOM_USART_INT_CTRLA_MODE_USART_INT_CLK | SERCOM_USART_INT_CTRLA_RXPO(0x1UL) | SERCOM_USART_INT_CTRLA_TXPO(0x0UL) | SERCOM_USART_INT_CTRLA_DORD_Msk | SERCOM_USART_INT_CTRLA_IBON_Msk | SERCOM_USART_INT_CTRLA_FORM(0x0UL) | SERCOM_USART_INT_CTRLA_SAMPR(0UL) | SERCOM_USART_INT_CTRLA_RUNSTDBY_Msk ;
 
     /* Configure Baud Rate */
     SERCOM3_REGS->USART_INT.SERCOM_BAUD = (uint16_t)SERCOM_USART_INT_BAUD_BAUD(SERCOM3_USART_INT_BAUD_VALUE);
@@ -104,8 +107,10 @@ void SERCOM3_USART_Initialize( void )
      * Configures CHSIZE
      * Configures Parity
      * Configures Stop bits
+     * Configures Start-of-Frame Detection, so that a start bit received in
+     * STANDBY requests the generic clock and wakes the device on RXC
      */
-    SERCOM3_REGS->USART_INT.SERCOM_CTRLB = SERCOM_USART_INT_CTRLB_CHSIZE_8_BIT | SERCOM_USART_INT_CTRLB_SBMODE_1_BIT | SERCOM_USART_INT_CTRLB_RXEN_Msk | SERCOM_USART_INT_CTRLB_TXEN_Msk;
+    SERCOM3_REGS->USART_INT.SERCOM_CTRLB = SERCOM_USART_INT_CTRLB_CHSIZE_8_BIT | SERCOM_USART_INT_CTRLB_SBMODE_1_BIT | SERCOM_USART_INT_CTRLB_RXEN_Msk | SERCOM_USART_INT_CTRLB_TXEN_Msk | SERCOM_USART_INT_CTRLB_SFDE_Msk;
 
     /* Wait for sync */
     while((SERCOM3_REGS->USART_INT.SERCOM_SYNCBUSY) != 0U)
@@ -137,6 +142,7 @@ void SERCOM3_USART_Initialize( void )
     sercom3USARTObj.isWrNotificationEnabled = false;
     sercom3USARTObj.isWrNotifyPersistently = false;
     sercom3USARTObj.wrThreshold = 0U;
+    (void)memset(&sercom3USARTObj.stats, 0, sizeof(sercom3USARTObj.stats));
     if (((SERCOM3_REGS->USART_INT.SERCOM_CTRLB & SERCOM_USART_INT_CTRLB_CHSIZE_Msk) >> SERCOM_USART_INT_CTRLB_CHSIZE_Pos) != 0x01U)
     {
         sercom3USARTObj.rdBufferSize = SERCOM3_USART_READ_BUFFER_SIZE;
@@ -156,7 +162,7 @@ void SERCOM3_USART_Initialize( void )
 
 uint32_t SERCOM3_USART_FrequencyGet( void )
 {
-    return 48000000UL;
+    return CLOCK_GCLK0FrequencyGet();
 }
 
 bool SERCOM3_USART_SerialSetup( USART_SERIAL_SETUP * serialSetup, uint32_t clkFrequency )
@@ -284,6 +290,7 @@ static inline bool SERCOM3_USART_RxPushByte(uint16_t rdByte)
 {
     uint32_t tempInIndex;
     uint32_t rdInIdx;
+    uint32_t rdCount;
     bool isSuccess = false;
 
     tempInIndex = sercom3USARTObj.rdInIndex + 1U;
@@ -329,10 +336,27 @@ static inline bool SERCOM3_USART_RxPushByte(uint16_t rdByte)
 
         sercom3USARTObj.rdInIndex = tempInIndex;
         isSuccess = true;
+
+        /* Ring fill after the push, for the high-water mark */
+        if (tempInIndex >= sercom3USARTObj.rdOutIndex)
+        {
+            rdCount = tempInIndex - sercom3USARTObj.rdOutIndex;
+        }
+        else
+        {
+            rdCount = (sercom3USARTObj.rdBufferSize - sercom3USARTObj.rdOutIndex) + tempInIndex;
+        }
+
+        sercom3USARTObj.stats.rx.byteCount++;
+        if (rdCount > sercom3USARTObj.stats.rx.peakCount)
+        {
+            sercom3USARTObj.stats.rx.peakCount = rdCount;
+        }
     }
     else
     {
         /* Queue is full. Data will be lost. */
+        sercom3USARTObj.stats.rx.overflowCount++;
     }
 
     return isSuccess;
@@ -535,6 +559,7 @@ static inline bool SERCOM3_USART_TxPushByte(uint16_t wrByte)
     uint32_t wrInIndex = sercom3USARTObj.wrInIndex;
     uint32_t wrOutIndex = sercom3USARTObj.wrOutIndex;
     uint32_t wrInIdx;
+    uint32_t wrCount;
 
     bool isSuccess = false;
 
@@ -562,6 +587,22 @@ static inline bool SERCOM3_USART_TxPushByte(uint16_t wrByte)
         sercom3USARTObj.wrInIndex = tempInIndex;
 
         isSuccess = true;
+
+        /* Ring fill after the push, for the high-water mark */
+        if (tempInIndex >= wrOutIndex)
+        {
+            wrCount = tempInIndex - wrOutIndex;
+        }
+        else
+        {
+            wrCount = (sercom3USARTObj.wrBufferSize - wrOutIndex) + tempInIndex;
+        }
+
+        sercom3USARTObj.stats.tx.byteCount++;
+        if (wrCount > sercom3USARTObj.stats.tx.peakCount)
+        {
+            sercom3USARTObj.stats.tx.peakCount = wrCount;
+        }
     }
     else
     {
@@ -664,6 +705,9 @@ size_t SERCOM3_USART_Write(uint8_t* pWrBuffer, const size_t size )
         }
     }
 
+    /* Bytes that did not fit into the ring */
+    sercom3USARTObj.stats.tx.overflowCount += (uint32_t)(size - nBytesWritten);
+
     /* Check if any data is pending for transmission */
     if (SERCOM3_USART_WritePendingBytesGet() > 0U)
     {
@@ -710,6 +754,24 @@ void SERCOM3_USART_WriteCallbackRegister( SERCOM_USART_RING_BUFFER_CALLBACK call
     sercom3USARTObj.wrContext = context;
 }
 
+void SERCOM3_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    *stats = sercom3USARTObj.stats;
+
+    NVIC_INT_Restore(interruptState);
+}
+
+void SERCOM3_USART_StatsReset( void )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    (void)memset(&sercom3USARTObj.stats, 0, sizeof(sercom3USARTObj.stats));
+
+    NVIC_INT_Restore(interruptState);
+}
+
 
 
 void static SERCOM3_USART_ISR_ERR_Handler( void )
@@ -721,6 +783,15 @@ void static SERCOM3_USART_ISR_ERR_Handler( void )
         /* Save the error to report later */
         sercom3USARTObj.errorStatus = errorStatus;
 
+        if ((errorStatus & USART_ERROR_OVERRUN) != USART_ERROR_NONE)
+        {
+            sercom3USARTObj.stats.overrunCount++;
+        }
+        if ((errorStatus & (USART_ERROR_PARITY | USART_ERROR_FRAMING)) != USART_ERROR_NONE)
+        {
+            sercom3USARTObj.stats.errorCount++;
+        }
+
         /* Clear error flags and flush the error bytes */
         SERCOM3_USART_ErrorClear();
 
@@ -61,6 +61,15 @@
 #endif
 // DOM-IGNORE-END
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macros
+// *****************************************************************************
+// *****************************************************************************
+
+/* Baud rate programmed by SERCOM3_USART_Initialize */
+#define SERCOM3_USART_BAUD_RATE                 (115200UL)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interface Routines
@@ -108,6 +117,10 @@ void SERCOM3_USART_ReadThresholdSet(uint32_t nBytesThreshold);
 
 void SERCOM3_USART_ReadCallbackRegister( SERCOM_USART_RING_BUFFER_CALLBACK callback, uintptr_t context);
 
+void SERCOM3_USART_StatsGet( SERCOM_USART_STATS * stats );
+
+void SERCOM3_USART_StatsReset( void );
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
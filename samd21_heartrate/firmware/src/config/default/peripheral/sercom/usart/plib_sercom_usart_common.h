@@ -223,6 +223,63 @@ typedef struct
 
 } USART_SERIAL_SETUP;
 
+// *****************************************************************************
+/* SERCOM USART Direction Statistics
+
+  Summary:
+    Traffic and buffer occupancy of one direction of a SERCOM USART.
+
+  Description:
+    For ring buffer PLIBs peakCount is the highest number of bytes held in
+    the ring and overflowCount the bytes that found it full. Received bytes
+    are lost then, bytes not accepted by SERCOMx_USART_Write may be written
+    again by the caller, like the console staging buffer does. For the
+    non-blocking PLIBs peakCount is the largest transfer, tx.overflowCount the
+    bytes of write requests rejected while a transfer was in progress and
+    rx.overflowCount stays 0, bytes received while no read is pending are
+    not counted.
+
+  Remarks:
+    Counters wrap silently.
+*/
+
+typedef struct
+{
+    uint32_t byteCount;
+
+    uint32_t peakCount;
+
+    uint32_t overflowCount;
+
+} SERCOM_USART_DIRECTION_STATS;
+
+// *****************************************************************************
+/* SERCOM USART Statistics
+
+  Summary:
+    Statistics returned by SERCOMx_USART_StatsGet.
+
+  Description:
+    overrunCount counts receive buffer overflows of the peripheral itself,
+    bytes lost because the interrupt was served too late. errorCount counts
+    framing and parity errors.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SERCOM_USART_DIRECTION_STATS rx;
+
+    SERCOM_USART_DIRECTION_STATS tx;
+
+    uint32_t overrunCount;
+
+    uint32_t errorCount;
+
+} SERCOM_USART_STATS;
+
 // *****************************************************************************
 /* Callback Function Pointer
 
@@ -283,6 +340,8 @@ typedef struct
 
     volatile USART_ERROR                 errorStatus;
 
+    SERCOM_USART_STATS                   stats;
+
 } SERCOM_USART_OBJECT;
 
 
@@ -372,6 +431,8 @@ typedef struct
 
     volatile USART_ERROR                                errorStatus;
 
+    SERCOM_USART_STATS                                  stats;
+
 } SERCOM_USART_RING_BUFFER_OBJECT;
 
 
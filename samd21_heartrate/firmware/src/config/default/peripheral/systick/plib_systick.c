@@ -42,6 +42,7 @@
 #include "interrupts.h"
 #include "plib_systick.h"
 
+static uint32_t systickFrequency = SYSTICK_FREQ;
 
 void SYSTICK_TimerInitialize ( void )
 {
@@ -86,7 +87,16 @@ uint32_t SYSTICK_TimerCounterGet ( void )
 
 uint32_t SYSTICK_TimerFrequencyGet ( void )
 {
-    return (SYSTICK_FREQ);
+    return (systickFrequency);
+}
+
+void SYSTICK_TimerFrequencySet ( uint32_t frequency )
+{
+    /* Keep the period constant in time when the CPU clock changes */
+    SysTick->LOAD = (((SysTick->LOAD + 1U) / (systickFrequency / 1000U)) * (frequency / 1000U)) - 1U;
+    SysTick->VAL = 0U;
+
+    systickFrequency = frequency;
 }
 
 void SYSTICK_DelayMs ( uint32_t delay_ms)
@@ -97,7 +107,7 @@ void SYSTICK_DelayMs ( uint32_t delay_ms)
    period = SysTick->LOAD + 1U;
 
    /* Calculate the count for the given delay */
-   delayCount=(SYSTICK_FREQ/1000U)*delay_ms;
+   delayCount=(systickFrequency/1000U)*delay_ms;
 
    if((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == SysTick_CTRL_ENABLE_Msk)
    {
@@ -127,7 +137,7 @@ void SYSTICK_DelayUs ( uint32_t delay_us)
    period = SysTick->LOAD + 1U;
 
     /* Calculate the count for the given delay */
-   delayCount=(SYSTICK_FREQ/1000000U)*delay_us;
+   delayCount=(systickFrequency/1000000U)*delay_us;
 
    if((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == SysTick_CTRL_ENABLE_Msk)
    {
@@ -67,6 +67,7 @@ void SYSTICK_TimerPeriodSet ( uint32_t period );
 uint32_t SYSTICK_TimerPeriodGet ( void );
 uint32_t SYSTICK_TimerCounterGet ( void );
 uint32_t SYSTICK_TimerFrequencyGet ( void );
+void SYSTICK_TimerFrequencySet ( uint32_t frequency );
 void SYSTICK_DelayMs ( uint32_t delay_ms );
 void SYSTICK_DelayUs ( uint32_t delay_us );
 
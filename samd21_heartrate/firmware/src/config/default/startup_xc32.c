@@ -28,6 +28,7 @@
 #include <stddef.h>
 #include "device.h"
 #include "interrupts.h"
+#include "system/stack/sys_stack.h"
 
 /*
  *  The MPLAB X Simulator does not yet support simulation of programming the
@@ -65,6 +66,10 @@ extern void __attribute__((weak,long_call, alias("Dummy_App_Func"))) __xc32_on_b
 
 /* Linker defined variables */
 extern uint32_t __svectors;
+extern uint32_t __ramfunc_start__;
+extern uint32_t __ramfunc_end__;
+extern uint32_t __ramfunc_load__;
+extern uint32_t _splim;
 
 /* MISRAC 2012 deviation block end */
 
@@ -90,6 +95,11 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
 #ifdef SCB_VTOR_TBLOFF_Msk
     uint32_t *pSrc;
 #endif
+    uint32_t *pRamfuncSrc;
+    uint32_t *pRamfuncDst;
+#if (SYS_STACK_PAINT_ENABLE == 1)
+    uint32_t *pStack;
+#endif
 
 #if defined (__REINIT_STACK_POINTER)
     /* Initialize SP from linker-defined _stack symbol. */
@@ -102,12 +112,28 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
     __asm__ volatile ("add r7, sp, #0" : : : "r7");
 #endif
 
+#if (SYS_STACK_PAINT_ENABLE == 1)
+    /* Paint the unused stack below this frame for SYS_STACK_UsageGet */
+    for (pStack = &_splim; pStack < (uint32_t *)__get_MSP(); pStack++)
+    {
+        *pStack = SYS_STACK_PAINT_PATTERN;
+    }
+#endif
+
     /* Call the optional application-provided _on_reset() function. */
     _on_reset();
 
     /* Reserved for use by MPLAB XC32. */
     __xc32_on_reset();
 
+    /* Copy the functions linked to SRAM from their load address in flash */
+    pRamfuncSrc = &__ramfunc_load__;
+    for (pRamfuncDst = &__ramfunc_start__; pRamfuncDst < &__ramfunc_end__; pRamfuncDst++)
+    {
+        *pRamfuncDst = *pRamfuncSrc;
+        pRamfuncSrc++;
+    }
+
     /* Initialize data after TCM is enabled.
      * Data initialization from the XC32 .dinit template */
     __pic32c_data_initialization();
@@ -0,0 +1,465 @@
+/*******************************************************************************
+  Micro-benchmark System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_bench.c
+
+  Summary:
+    Micro-benchmark System Service implementation.
+
+  Description:
+    This file contains the source code for the micro-benchmark system
+    service and its built-in benchmarks.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "device.h"
+#include "system/bench/sys_bench.h"
+#include "system/command/sys_command.h"
+#include "system/fmt/sys_fmt.h"
+#include "system/hrcodec/sys_hrcodec.h"
+#include "driver/heartrate/src/drv_heartrate_frame.h"
+#include "peripheral/nvic/plib_nvic.h"
+#include "peripheral/systick/plib_systick.h"
+#if (SYS_BENCH_LIBC_COMPARE == 1)
+#include <stdio.h>
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    const SYS_BENCH_DESCRIPTOR *    bench;
+
+    SYS_BENCH_RESULT                result;
+
+} SYS_BENCH_ENTRY;
+
+typedef struct
+{
+    SYS_BENCH_ENTRY     entries[SYS_BENCH_MAX_ENTRIES];
+
+    uint32_t            count;
+
+    uint32_t            overhead;
+
+    /* CPU clock of the last run */
+    uint32_t            frequency;
+
+} SYS_BENCH_OBJ;
+
+static SYS_BENCH_OBJ gSysBenchObj;
+
+static void _SYS_BENCH_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysBenchCmdTbl[] =
+{
+    {"bench", _SYS_BENCH_Command, ": show benchmark cycles, 'bench run [name]' runs them first"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Built-in Benchmarks
+// *****************************************************************************
+// *****************************************************************************
+
+/* Data copied by the memory benchmarks, one spare word for the unaligned
+   source. The ring read benchmark uses the source as its ring. */
+#define SYS_BENCH_COPY_SIZE             128U
+
+static uint32_t gSysBenchSource[(SYS_BENCH_COPY_SIZE / 4U) + 1U];
+static uint32_t gSysBenchDestination[SYS_BENCH_COPY_SIZE / 4U];
+
+/* Ring read position, the read of 127 bytes wraps */
+#define SYS_BENCH_RING_OUT_INDEX        100U
+
+static const uint8_t gSysBenchFrame[] = "15;98231;121507;14562;72;\r\n";
+
+static DRV_HEARTRATE_FRAME_PARSER gSysBenchParser;
+
+static uint8_t gSysBenchCodecBlock[64];
+
+static SYS_HRCODEC_ENCODER gSysBenchEncoder;
+
+static SYS_HRCODEC_SAMPLE gSysBenchSample;
+
+static char gSysBenchText[40];
+
+static void _SYS_BENCH_Empty(uintptr_t context)
+{
+    (void)context;
+}
+
+static void _SYS_BENCH_FrameParse(uintptr_t context)
+{
+    const uint8_t *data = gSysBenchFrame;
+    size_t size = sizeof(gSysBenchFrame) - 1U;
+    size_t used;
+    bool complete;
+
+    (void)context;
+
+    while (size != 0U)
+    {
+        used = DRV_HEARTRATE_FrameParse(&gSysBenchParser, data, size, &complete);
+        data += used;
+        size -= used;
+    }
+}
+
+/* The loop of SERCOM0_USART_Read, which cannot be run on the live ring,
+   including its character size check for every byte */
+static void _SYS_BENCH_RingRead(uintptr_t context)
+{
+    const uint8_t *ring = (const uint8_t *)gSysBenchSource;
+    uint8_t *buffer = (uint8_t *)gSysBenchDestination;
+    size_t size = (size_t)context;
+    size_t nBytesRead = 0U;
+    uint32_t rdOutIndex = SYS_BENCH_RING_OUT_INDEX;
+    uint32_t rdInIndex = (SYS_BENCH_RING_OUT_INDEX + size) % SYS_BENCH_COPY_SIZE;
+
+    while (nBytesRead < size)
+    {
+        if (rdOutIndex != rdInIndex)
+        {
+            if (((SERCOM0_REGS->USART_INT.SERCOM_CTRLB & SERCOM_USART_INT_CTRLB_CHSIZE_Msk) >> SERCOM_USART_INT_CTRLB_CHSIZE_Pos) != 0x01U)
+            {
+                buffer[nBytesRead] = ring[rdOutIndex];
+                nBytesRead += 1U;
+                rdOutIndex += 1U;
+            }
+
+            if (rdOutIndex >= SYS_BENCH_COPY_SIZE)
+            {
+                rdOutIndex = 0U;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+static void _SYS_BENCH_Memcpy(uintptr_t context)
+{
+    (void)memcpy(gSysBenchDestination, (const uint8_t *)gSysBenchSource + context, SYS_BENCH_COPY_SIZE);
+}
+
+static void _SYS_BENCH_ByteLoop(uintptr_t context)
+{
+    const volatile uint8_t *source = (const volatile uint8_t *)gSysBenchSource;
+    volatile uint8_t *destination = (volatile uint8_t *)gSysBenchDestination;
+    uint32_t i;
+
+    (void)context;
+
+    for (i = 0U; i < SYS_BENCH_COPY_SIZE; i++)
+    {
+        destination[i] = source[i];
+    }
+}
+
+static void _SYS_BENCH_WordLoop(uintptr_t context)
+{
+    const volatile uint32_t *source = gSysBenchSource;
+    volatile uint32_t *destination = gSysBenchDestination;
+    uint32_t i;
+
+    (void)context;
+
+    for (i = 0U; i < (SYS_BENCH_COPY_SIZE / 4U); i++)
+    {
+        destination[i] = source[i];
+    }
+}
+
+static void _SYS_BENCH_FmtFrame(uintptr_t context)
+{
+    (void)context;
+    (void)SYS_FMT_Snprintf(gSysBenchText, sizeof(gSysBenchText), "15;%lu;%lu;%lu;%u;", 98231UL, 121507UL, 14562UL, 72U);
+}
+
+#if (SYS_BENCH_LIBC_COMPARE == 1)
+static void _SYS_BENCH_SnprintfFrame(uintptr_t context)
+{
+    (void)context;
+    (void)snprintf(gSysBenchText, sizeof(gSysBenchText), "15;%lu;%lu;%lu;%u;", 98231UL, 121507UL, 14562UL, 72U);
+}
+#endif
+
+/* One sample a second with a small change, like the application logs */
+static void _SYS_BENCH_CodecPut(uintptr_t context)
+{
+    (void)context;
+
+    gSysBenchSample.timestamp++;
+    gSysBenchSample.value = 72 + (int32_t)(gSysBenchSample.timestamp & 3U);
+
+    if (SYS_HRCODEC_EncoderPut(&gSysBenchEncoder, &gSysBenchSample) == false)
+    {
+        SYS_HRCODEC_EncoderInit(&gSysBenchEncoder, gSysBenchCodecBlock, sizeof(gSysBenchCodecBlock));
+        (void)SYS_HRCODEC_EncoderPut(&gSysBenchEncoder, &gSysBenchSample);
+    }
+}
+
+static const SYS_BENCH_DESCRIPTOR gSysBenchBuiltins[] =
+{
+    { "frame parse",    _SYS_BENCH_FrameParse,      0U,     sizeof(gSysBenchFrame) - 1U },
+    { "ring read 10",   _SYS_BENCH_RingRead,        10U,    10U },
+    { "ring read 127",  _SYS_BENCH_RingRead,        127U,   127U },
+    { "memcpy 128",     _SYS_BENCH_Memcpy,          0U,     SYS_BENCH_COPY_SIZE },
+    { "memcpy 128 u",   _SYS_BENCH_Memcpy,          1U,     SYS_BENCH_COPY_SIZE },
+    { "byte loop 128",  _SYS_BENCH_ByteLoop,        0U,     SYS_BENCH_COPY_SIZE },
+    { "word loop 128",  _SYS_BENCH_WordLoop,        0U,     SYS_BENCH_COPY_SIZE },
+    { "fmt frame",      _SYS_BENCH_FmtFrame,        0U,     0U },
+#if (SYS_BENCH_LIBC_COMPARE == 1)
+    { "snprintf frame", _SYS_BENCH_SnprintfFrame,   0U,     0U },
+#endif
+    { "hrcodec put",    _SYS_BENCH_CodecPut,        0U,     0U },
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Not inlined, so that the empty function is timed through the same call
+   as the benchmarks */
+static __attribute__((noinline)) uint32_t _SYS_BENCH_Time(SYS_BENCH_FUNCTION function, uintptr_t context)
+{
+    bool interruptState = NVIC_INT_Disable();
+    uint32_t start;
+    uint32_t end;
+
+    start = SysTick->VAL;
+    function(context);
+    end = SysTick->VAL;
+
+    NVIC_INT_Restore(interruptState);
+
+    /* SysTick counts down from LOAD, wrapping every 2^24 cycles */
+    return (start - end) & SysTick_LOAD_RELOAD_Msk;
+}
+
+static void _SYS_BENCH_Prepare(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(gSysBenchSource) / sizeof(gSysBenchSource[0])); i++)
+    {
+        gSysBenchSource[i] = 0x01010101U * i;
+    }
+
+    DRV_HEARTRATE_FrameParserReset(&gSysBenchParser);
+    SYS_HRCODEC_EncoderInit(&gSysBenchEncoder, gSysBenchCodecBlock, sizeof(gSysBenchCodecBlock));
+    gSysBenchSample.timestamp = 0U;
+}
+
+static void _SYS_BENCH_Measure(SYS_BENCH_ENTRY *entry, uint32_t overhead)
+{
+    SYS_BENCH_RESULT *result = &entry->result;
+    uint32_t cycles;
+    uint32_t i;
+
+    memset(result, 0, sizeof(*result));
+    result->minCycles = UINT32_MAX;
+
+    for (i = 0U; i < SYS_BENCH_ITERATIONS; i++)
+    {
+        cycles = _SYS_BENCH_Time(entry->bench->function, entry->bench->context);
+        cycles = (cycles > overhead) ? (cycles - overhead) : 0U;
+
+        result->count++;
+        result->totalCycles += cycles;
+        result->minCycles = (cycles < result->minCycles) ? cycles : result->minCycles;
+        result->maxCycles = (cycles > result->maxCycles) ? cycles : result->maxCycles;
+    }
+}
+
+static void _SYS_BENCH_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    const SYS_BENCH_DESCRIPTOR *bench;
+    SYS_BENCH_RESULT result;
+    uint32_t average;
+    uint32_t perByte;
+    uint32_t index;
+
+    if ((argc > 1) && (strcmp(argv[1], "run") == 0))
+    {
+        if (SYS_BENCH_Run((argc > 2) ? argv[2] : NULL) == 0U)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nno such benchmark\r\n");
+            return;
+        }
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\ncpu %lu MHz, overhead %lu cycles, %lu calls each",
+        gSysBenchObj.frequency / 1000000U, gSysBenchObj.overhead, (uint32_t)SYS_BENCH_ITERATIONS);
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nbenchmark            min      avg      max  cyc/B");
+
+    for (index = 0U; SYS_BENCH_ResultGet(index, &bench, &result) == true; index++)
+    {
+        if (result.count == 0U)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%-16s %8s %8s %8s", bench->name, "-", "-", "-");
+            continue;
+        }
+
+        average = result.totalCycles / result.count;
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%-16s %8lu %8lu %8lu", bench->name,
+            result.minCycles, average, result.maxCycles);
+
+        if (bench->bytes != 0U)
+        {
+            perByte = (average * 10U) / bench->bytes;
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, " %4lu.%lu", perByte / 10U, perByte % 10U);
+        }
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_BENCH_Initialize( void )
+{
+    uint32_t i;
+
+    memset(&gSysBenchObj, 0, sizeof(gSysBenchObj));
+
+    for (i = 0U; i < (sizeof(gSysBenchBuiltins) / sizeof(gSysBenchBuiltins[0])); i++)
+    {
+        (void)SYS_BENCH_Register(&gSysBenchBuiltins[i]);
+    }
+
+#if (SYS_BENCH_RUN_AT_BOOT == 1)
+    (void)SYS_BENCH_Run(NULL);
+#endif
+
+    return SYS_CMD_ADDGRP(sysBenchCmdTbl, sizeof(sysBenchCmdTbl)/sizeof(*sysBenchCmdTbl), "bench", ": micro-benchmark commands");
+}
+
+bool SYS_BENCH_Register( const SYS_BENCH_DESCRIPTOR * bench )
+{
+    SYS_BENCH_OBJ *obj = &gSysBenchObj;
+
+    if (obj->count >= SYS_BENCH_MAX_ENTRIES)
+    {
+        return false;
+    }
+
+    obj->entries[obj->count].bench = bench;
+    memset(&obj->entries[obj->count].result, 0, sizeof(SYS_BENCH_RESULT));
+    obj->count++;
+
+    return true;
+}
+
+uint32_t SYS_BENCH_Run( const char * name )
+{
+    SYS_BENCH_OBJ *obj = &gSysBenchObj;
+    uint32_t ctrl = SysTick->CTRL;
+    uint32_t load = SysTick->LOAD;
+    uint32_t cycles;
+    uint32_t run = 0U;
+    uint32_t i;
+
+    /* Free running over 24 bits instead of the 1 ms period of the delays */
+    SysTick->CTRL = 0U;
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    obj->frequency = SYSTICK_TimerFrequencyGet();
+
+    /* The fastest empty call, slower ones were stretched by a bus stall */
+    obj->overhead = UINT32_MAX;
+    for (i = 0U; i < SYS_BENCH_ITERATIONS; i++)
+    {
+        cycles = _SYS_BENCH_Time(_SYS_BENCH_Empty, 0U);
+        obj->overhead = (cycles < obj->overhead) ? cycles : obj->overhead;
+    }
+
+    _SYS_BENCH_Prepare();
+
+    for (i = 0U; i < obj->count; i++)
+    {
+        if ((name == NULL) || (strcmp(name, obj->entries[i].bench->name) == 0))
+        {
+            _SYS_BENCH_Measure(&obj->entries[i], obj->overhead);
+            run++;
+        }
+    }
+
+    SysTick->CTRL = 0U;
+    SysTick->LOAD = load;
+    SysTick->VAL = 0U;
+    SysTick->CTRL = ctrl;
+
+    return run;
+}
+
+bool SYS_BENCH_ResultGet( uint32_t index, const SYS_BENCH_DESCRIPTOR ** bench, SYS_BENCH_RESULT * result )
+{
+    if (index >= gSysBenchObj.count)
+    {
+        return false;
+    }
+
+    *bench = gSysBenchObj.entries[index].bench;
+    *result = gSysBenchObj.entries[index].result;
+
+    return true;
+}
+
+uint32_t SYS_BENCH_OverheadGet( void )
+{
+    return gSysBenchObj.overhead;
+}
@@ -0,0 +1,283 @@
+/*******************************************************************************
+  Micro-benchmark System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_bench.h
+
+  Summary:
+    Micro-benchmark System Service interface.
+
+  Description:
+    This file contains the interface definition for the micro-benchmark
+    system service. Registered functions are timed in CPU cycles with
+    SysTick running free over its full 24 bits, the cost of the
+    measurement itself is calibrated and subtracted. The "bench" command
+    runs them and prints the results as a table.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_BENCH_H
+#define SYS_BENCH_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef void (*SYS_BENCH_FUNCTION)( uintptr_t context );
+
+// *****************************************************************************
+/* Benchmark Descriptor
+
+  Summary:
+    One registered micro-benchmark.
+
+  Description:
+    function is called SYS_BENCH_ITERATIONS times with context and every
+    call is timed on its own. bytes is the amount of data one call
+    processes, the table then shows the cycles per byte as well.
+
+  Remarks:
+    The descriptor must stay valid after registration, keep it const.
+*/
+
+typedef struct
+{
+    const char *        name;
+
+    SYS_BENCH_FUNCTION  function;
+
+    uintptr_t           context;
+
+    /* Bytes processed per call, 0 when a cost per byte does not apply */
+    uint32_t            bytes;
+
+} SYS_BENCH_DESCRIPTOR;
+
+// *****************************************************************************
+/* Benchmark Result
+
+  Summary:
+    Cycles of the timed calls of one benchmark.
+
+  Description:
+    The calibrated overhead is already subtracted.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t count;
+
+    uint32_t minCycles;
+
+    uint32_t maxCycles;
+
+    uint32_t totalCycles;
+
+} SYS_BENCH_RESULT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_BENCH_Initialize( void )
+
+  Summary:
+    Registers the built-in benchmarks and the "bench" command group.
+
+  Description:
+    The built-in benchmarks time the sensor frame parser, the SERCOM ring
+    read, memcpy against byte and word loops, the formatter and the heart
+    rate codec. The formatter is compared against the C library snprintf
+    only with SYS_BENCH_LIBC_COMPARE set to 1, which links the newlib
+    formatted output. With SYS_BENCH_RUN_AT_BOOT set to 1 they are run
+    once here and "bench" shows the results.
+
+  Precondition:
+    SYS_CMD_Initialize and SYSTICK_TimerInitialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_BENCH_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_BENCH_Register( const SYS_BENCH_DESCRIPTOR * bench )
+
+  Summary:
+    Adds a benchmark to the list run by SYS_BENCH_Run and "bench run".
+
+  Description:
+    None.
+
+  Precondition:
+    None.
+
+  Parameters:
+    bench - Benchmark, must stay valid
+
+  Returns:
+    false if SYS_BENCH_MAX_ENTRIES benchmarks are already registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_BENCH_Register( const SYS_BENCH_DESCRIPTOR * bench );
+
+// *****************************************************************************
+/* Function:
+    uint32_t SYS_BENCH_Run( const char * name )
+
+  Summary:
+    Calibrates the overhead and runs benchmarks.
+
+  Description:
+    SysTick is switched to its full 24 bit period for the run and set back
+    afterwards. Every call is timed with interrupts disabled, so the
+    results do not include interrupt handlers. The function must return
+    within 2^24 cycles, 349 ms at 48 MHz.
+
+  Precondition:
+    SYS_BENCH_Initialize must have been called.
+
+  Parameters:
+    name - Benchmark to run, NULL runs all of them
+
+  Returns:
+    Number of benchmarks run.
+
+  Remarks:
+    Call it from the super loop only. The CPU clock is not changed, the
+    cycle counts include the flash wait states of the clock the governor
+    has selected, "bench" prints it with the table.
+*/
+
+uint32_t SYS_BENCH_Run( const char * name );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_BENCH_ResultGet( uint32_t index, const SYS_BENCH_DESCRIPTOR ** bench,
+        SYS_BENCH_RESULT * result )
+
+  Summary:
+    Gets a registered benchmark and the result of its last run.
+
+  Description:
+    result->count is 0 if the benchmark has not been run.
+
+  Precondition:
+    SYS_BENCH_Initialize must have been called.
+
+  Parameters:
+    index  - Registration order, from 0
+    bench  - Receives the descriptor
+    result - Receives the result
+
+  Returns:
+    false if index is past the last registered benchmark.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_BENCH_ResultGet( uint32_t index, const SYS_BENCH_DESCRIPTOR ** bench, SYS_BENCH_RESULT * result );
+
+// *****************************************************************************
+/* Function:
+    uint32_t SYS_BENCH_OverheadGet( void )
+
+  Summary:
+    Cycles subtracted from every timed call.
+
+  Description:
+    The fastest timing of an empty function, measured by the last run.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    Overhead in cycles, 0 before the first run.
+
+  Remarks:
+    None.
+*/
+
+uint32_t SYS_BENCH_OverheadGet( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_BENCH_H
+
+/*******************************************************************************
+ End of File
+*/
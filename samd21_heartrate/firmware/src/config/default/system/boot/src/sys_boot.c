@@ -0,0 +1,326 @@
+/*******************************************************************************
+  Boot Timing System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_boot.c
+
+  Summary:
+    Boot Timing System Service implementation.
+
+  Description:
+    This file contains the source code for the boot timing system service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "device.h"
+#include "toolchain_specifics.h"
+#include "system/boot/sys_boot.h"
+#include "system/command/sys_command.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/rtc/plib_rtc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Types and Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_BOOT_MAGIC                  0x424F4F54U
+
+/* OSC8M undivided, selected by _on_reset until CLOCK_Initialize */
+#define SYS_BOOT_RESET_CLOCK_MHZ        8U
+
+typedef struct
+{
+    /* SysTick value at the last conversion and the cycles not yet converted */
+    uint32_t    sysTickLast;
+
+    uint32_t    cycles;
+
+    uint32_t    cyclesPerUs;
+
+    uint32_t    timeUs;
+
+    /* RTC counter value and boot time at SYS_BOOT_MILESTONE_PERIPHERALS */
+    bool        rtcStarted;
+
+    uint32_t    rtcStart;
+
+    uint32_t    rtcTimeUs;
+
+} SYS_BOOT_OBJ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Record of this boot and of the previous one, not cleared by the C runtime */
+static SYS_BOOT_RECORD NO_INIT gSysBootRecords[2];
+
+static SYS_BOOT_OBJ gSysBootObj;
+
+static const char * const gSysBootNames[SYS_BOOT_MILESTONE_MAX] =
+{
+    "runtime",
+    "clocks",
+    "peripherals",
+    "driver",
+    "system",
+    "sensor",
+    "first frame",
+    "first sample",
+};
+
+static void _SYS_BOOT_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysBootCmdTbl[] =
+{
+    {"boot", _SYS_BOOT_Command, ": show boot milestones, 'boot prev' of the boot before"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t _SYS_BOOT_TimeGet(SYS_BOOT_OBJ *obj)
+{
+    uint32_t frequency;
+    uint32_t ticks;
+    uint32_t seconds;
+    uint32_t now;
+
+    if (obj->rtcStarted == true)
+    {
+        frequency = RTC_Timer32FrequencyGet();
+        ticks = RTC_Timer32CounterGet() - obj->rtcStart;
+        seconds = ticks / frequency;
+
+        /* Saturate after about 71 minutes */
+        if (seconds >= ((0xFFFFFFFFU - obj->rtcTimeUs) / 1000000U))
+        {
+            return 0xFFFFFFFFU;
+        }
+
+        return obj->rtcTimeUs + (seconds * 1000000U) + (((ticks % frequency) * 1000000U) / frequency);
+    }
+
+    /* SysTick counts down from LOAD, wrapping every 2^24 cycles */
+    now = SysTick->VAL;
+    obj->cycles += (obj->sysTickLast - now) & SysTick_LOAD_RELOAD_Msk;
+    obj->sysTickLast = now;
+
+    obj->timeUs += obj->cycles / obj->cyclesPerUs;
+    obj->cycles %= obj->cyclesPerUs;
+
+    return obj->timeUs;
+}
+
+static const char *_SYS_BOOT_CauseName(uint32_t resetCause)
+{
+    if ((resetCause & PM_RCAUSE_POR_Msk) != 0U)
+    {
+        return "power-on";
+    }
+    if ((resetCause & PM_RCAUSE_BOD33_Msk) != 0U)
+    {
+        return "brown-out 3.3V";
+    }
+    if ((resetCause & PM_RCAUSE_BOD12_Msk) != 0U)
+    {
+        return "brown-out 1.2V";
+    }
+    if ((resetCause & PM_RCAUSE_WDT_Msk) != 0U)
+    {
+        return "watchdog";
+    }
+    if ((resetCause & PM_RCAUSE_SYST_Msk) != 0U)
+    {
+        return "software";
+    }
+    if ((resetCause & PM_RCAUSE_EXT_Msk) != 0U)
+    {
+        return "external";
+    }
+    return "unknown";
+}
+
+static void _SYS_BOOT_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_BOOT_RECORD record;
+    bool previous = false;
+    uint32_t last = 0U;
+    uint32_t id;
+
+    if ((argc > 1) && (strcmp(argv[1], "prev") == 0))
+    {
+        previous = true;
+    }
+    else if (argc > 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: boot [prev]\r\n");
+        return;
+    }
+
+    if (SYS_BOOT_RecordGet(previous, &record) == false)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nno record of the previous boot\r\n");
+        return;
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nboot %lu, %s reset (rcause 0x%02lx)", record.bootCount,
+        _SYS_BOOT_CauseName(record.resetCause), record.resetCause);
+
+    for (id = 0; id < (uint32_t)SYS_BOOT_MILESTONE_MAX; id++)
+    {
+        if ((record.reached & (1UL << id)) == 0U)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s: not reached", gSysBootNames[id]);
+            continue;
+        }
+
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s: %lu us, +%lu us", gSysBootNames[id],
+            record.timeUs[id], record.timeUs[id] - last);
+        last = record.timeUs[id];
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Called by the reset handler before the C runtime is initialized, it must
+   not use initialized or zeroed data. Runs the data initialization at 8 MHz
+   instead of the 1 MHz reset clock and starts SysTick as the boot clock. */
+void _on_reset(void)
+{
+    SYSCTRL_REGS->SYSCTRL_OSC8M = (SYSCTRL_REGS->SYSCTRL_OSC8M & ~SYSCTRL_OSC8M_PRESC_Msk) | SYSCTRL_OSC8M_PRESC(0U);
+
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+bool SYS_BOOT_Initialize( void )
+{
+    SYS_BOOT_OBJ *obj = &gSysBootObj;
+    SYS_BOOT_RECORD *current = &gSysBootRecords[0];
+    uint32_t resetCause = PM_REGS->PM_RCAUSE;
+
+    memset(obj, 0, sizeof(*obj));
+    obj->sysTickLast = SysTick_LOAD_RELOAD_Msk;
+    obj->cyclesPerUs = SYS_BOOT_RESET_CLOCK_MHZ;
+
+    /* The RAM content is undefined after a power-on */
+    if ((current->magic == SYS_BOOT_MAGIC) && ((resetCause & PM_RCAUSE_POR_Msk) == 0U))
+    {
+        gSysBootRecords[1] = *current;
+        current->bootCount++;
+    }
+    else
+    {
+        gSysBootRecords[1].magic = 0U;
+        current->bootCount = 1U;
+    }
+
+    current->magic = SYS_BOOT_MAGIC;
+    current->resetCause = resetCause;
+    current->reached = 0U;
+    memset(current->timeUs, 0, sizeof(current->timeUs));
+
+    SYS_BOOT_Mark(SYS_BOOT_MILESTONE_RUNTIME);
+
+    return SYS_CMD_ADDGRP(sysBootCmdTbl, sizeof(sysBootCmdTbl)/sizeof(*sysBootCmdTbl), "boot", ": boot timing commands");
+}
+
+void SYS_BOOT_Mark( SYS_BOOT_MILESTONE milestone )
+{
+    SYS_BOOT_OBJ *obj = &gSysBootObj;
+    SYS_BOOT_RECORD *current = &gSysBootRecords[0];
+    uint32_t timeUs;
+
+    if ((current->reached & (1UL << milestone)) != 0U)
+    {
+        return;
+    }
+
+    timeUs = _SYS_BOOT_TimeGet(obj);
+    current->timeUs[milestone] = timeUs;
+    current->reached |= (1UL << milestone);
+
+    if (milestone == SYS_BOOT_MILESTONE_CLOCKS)
+    {
+        obj->cyclesPerUs = CLOCK_GCLK0FrequencyGet() / 1000000U;
+    }
+    else if (milestone == SYS_BOOT_MILESTONE_PERIPHERALS)
+    {
+        obj->rtcStart = RTC_Timer32CounterGet();
+        obj->rtcTimeUs = timeUs;
+        obj->rtcStarted = true;
+    }
+    else
+    {
+        /* Nothing to switch */
+    }
+}
+
+bool SYS_BOOT_RecordGet( bool previous, SYS_BOOT_RECORD * record )
+{
+    const SYS_BOOT_RECORD *source = &gSysBootRecords[(previous == true) ? 1 : 0];
+
+    if (source->magic != SYS_BOOT_MAGIC)
+    {
+        return false;
+    }
+
+    *record = *source;
+
+    return true;
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,247 @@
+/*******************************************************************************
+  Boot Timing System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_boot.h
+
+  Summary:
+    Boot Timing System Service interface.
+
+  Description:
+    This file contains the interface definition for the boot timing system
+    service. The time from reset to every boot milestone is recorded in RAM
+    that is not initialized by the C runtime, so the record of the previous
+    boot survives a brown-out or watchdog reset and is printed by the "boot"
+    command next to the current one.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_BOOT_H
+#define SYS_BOOT_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Boot Milestones
+
+  Summary:
+    Identifies the recorded boot stages, in the order they are reached.
+
+  Description:
+    The time of a milestone is taken the first time it is marked after reset,
+    later marks are ignored.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* C runtime initialized, SYS_Initialize entered */
+    SYS_BOOT_MILESTONE_RUNTIME = 0,
+
+    /* CLOCK_Initialize done, CPU on the 48 MHz DFLL */
+    SYS_BOOT_MILESTONE_CLOCKS,
+
+    /* PLIBs initialized and the RTC counting */
+    SYS_BOOT_MILESTONE_PERIPHERALS,
+
+    /* Heart rate driver initialized, sensor out of reset */
+    SYS_BOOT_MILESTONE_DRIVER,
+
+    /* SYS_Initialize done, super loop entered */
+    SYS_BOOT_MILESTONE_SYSTEM,
+
+    /* Sensor startup delay over, the driver accepts clients */
+    SYS_BOOT_MILESTONE_SENSOR,
+
+    /* First complete frame from the sensor */
+    SYS_BOOT_MILESTONE_FIRST_FRAME,
+
+    /* First heart rate delivered to a client */
+    SYS_BOOT_MILESTONE_FIRST_SAMPLE,
+
+    SYS_BOOT_MILESTONE_MAX
+
+} SYS_BOOT_MILESTONE;
+
+// *****************************************************************************
+/* Boot Record
+
+  Summary:
+    Milestone times of one boot.
+
+  Description:
+    Times are in microseconds from the start of the reset handler. Time spent
+    in the device startup before the reset handler runs is not included.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t magic;
+
+    /* Boots since the record was last found invalid, 1 after a power-on */
+    uint32_t bootCount;
+
+    /* PM RCAUSE register of this boot */
+    uint32_t resetCause;
+
+    /* Bit n set once milestone n was reached */
+    uint32_t reached;
+
+    uint32_t timeUs[SYS_BOOT_MILESTONE_MAX];
+
+} SYS_BOOT_RECORD;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_BOOT_Initialize( void )
+
+  Summary:
+    Starts the record of this boot and registers the "boot" command group.
+
+  Description:
+    Keeps the record left by the previous boot, if its RAM survived the
+    reset, and marks SYS_BOOT_MILESTONE_RUNTIME.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    Must be the first call of SYS_Initialize. Time is counted with SysTick,
+    started by _on_reset, until SYS_BOOT_MILESTONE_PERIPHERALS and with the
+    RTC after that. SYS_BOOT_MILESTONE_CLOCKS must be marked right after
+    CLOCK_Initialize and SYS_BOOT_MILESTONE_PERIPHERALS right after
+    RTC_Timer32Start, before SYSTICK_TimerInitialize takes SysTick over.
+*/
+
+bool SYS_BOOT_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_BOOT_Mark( SYS_BOOT_MILESTONE milestone )
+
+  Summary:
+    Records the time a milestone was reached.
+
+  Description:
+    Does nothing if the milestone was already reached, so it may be called
+    from paths that run for every frame.
+
+  Precondition:
+    SYS_BOOT_Initialize must have been called.
+
+  Parameters:
+    milestone - Milestone reached
+
+  Returns:
+    None.
+
+  Remarks:
+    Not interrupt safe, call it from the super loop only.
+*/
+
+void SYS_BOOT_Mark( SYS_BOOT_MILESTONE milestone );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_BOOT_RecordGet( bool previous, SYS_BOOT_RECORD * record )
+
+  Summary:
+    Copies the record of this boot or of the previous one.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_BOOT_Initialize must have been called.
+
+  Parameters:
+    previous - true for the record of the previous boot
+    record   - Receives the record
+
+  Returns:
+    false if there is no record of the previous boot, the RAM does not keep
+    its content over a power-on reset.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_BOOT_RecordGet( bool previous, SYS_BOOT_RECORD * record );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_BOOT_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,499 @@
+/*******************************************************************************
+  Configuration Record System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_cfg.c
+
+  Summary:
+    Tunables kept in a CRC protected flash record.
+
+  Description:
+    This file contains the source code of the configuration record service
+    and of the "cfg" command. See sys_cfg.h for the record layout.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "system/cfg/sys_cfg.h"
+#include "system/command/sys_command.h"
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_CFG_PAGES_PER_ROW       (NVMCTRL_FLASH_ROWSIZE / NVMCTRL_FLASH_PAGESIZE)
+#define SYS_CFG_PAGE_WORDS          (NVMCTRL_FLASH_PAGESIZE / 4U)
+#define SYS_CFG_SEQUENCE_ERASED     0xFFFFFFFFU
+
+typedef enum
+{
+    SYS_CFG_OPERATION_NONE = 0,
+    SYS_CFG_OPERATION_WRITE,
+    SYS_CFG_OPERATION_ERASE,
+} SYS_CFG_OPERATION;
+
+typedef struct
+{
+    const SYS_CFG_INIT *    init;
+
+    bool                    initialized;
+
+    uint32_t                pageCount;
+
+    /* Compile time values of the items */
+    uint32_t                defaults[SYS_CFG_ITEMS_MAX];
+
+    /* Page of the newest record, pageCount if there is none */
+    uint32_t                newest;
+
+    uint32_t                sequence;
+
+    /* Record being saved and the page it goes to */
+    uint32_t                page[SYS_CFG_PAGE_WORDS];
+    uint32_t                target;
+
+    SYS_CFG_OPERATION       operation;
+
+    SYS_CFG_STATUS          status;
+
+} SYS_CFG_OBJ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_CFG_OBJ gSysCfgObj;
+
+static void _SYS_CFG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysCfgCmdTbl[] =
+{
+    {"cfg", _SYS_CFG_Command, ": show tunables, 'cfg set <name> <value>', 'cfg default' and 'cfg save' change them"},
+};
+
+static const char * const sysCfgStatusNames[] =
+{
+    "defaults",
+    "loaded",
+    "save pending",
+    "saved",
+    "save failed",
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t _SYS_CFG_Get32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static void _SYS_CFG_Put32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+    dst[3] = (uint8_t)(value >> 24);
+}
+
+/* CRC-16/CCITT-FALSE of the header without its crc field and the values */
+static uint16_t _SYS_CFG_Crc(const uint8_t *page)
+{
+    uint32_t length = SYS_CFG_PAGE_HEADER_SIZE + (4U * (uint32_t)page[5]);
+    uint16_t crc = 0xFFFFU;
+    uint32_t index;
+    uint8_t bit;
+
+    for (index = 0U; index < length; index++)
+    {
+        if ((index == 6U) || (index == 7U))
+        {
+            continue;
+        }
+
+        crc ^= (uint16_t)page[index] << 8;
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+static bool _SYS_CFG_PageIsValid(const SYS_CFG_OBJ *obj, const uint8_t *page)
+{
+    return (_SYS_CFG_Get32(page) != SYS_CFG_SEQUENCE_ERASED) &&
+           (page[4] == obj->init->version) &&
+           (page[5] <= SYS_CFG_ITEMS_MAX) &&
+           (_SYS_CFG_Crc(page) == ((uint16_t)page[6] | ((uint16_t)page[7] << 8)));
+}
+
+static bool _SYS_CFG_PageIsErased(uint32_t address)
+{
+    const uint32_t *word = (const uint32_t *)address;
+    uint32_t index;
+
+    for (index = 0U; index < SYS_CFG_PAGE_WORDS; index++)
+    {
+        if (word[index] != 0xFFFFFFFFU)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t _SYS_CFG_PageAddress(const SYS_CFG_OBJ *obj, uint32_t page)
+{
+    return obj->init->startAddress + (page * NVMCTRL_FLASH_PAGESIZE);
+}
+
+static bool _SYS_CFG_ValuesApply(const SYS_CFG_OBJ *obj, const uint8_t *page)
+{
+    const SYS_CFG_ITEM *items = obj->init->items;
+    uint32_t previous[SYS_CFG_ITEMS_MAX];
+    uint32_t value;
+    size_t count = page[5];
+    size_t index;
+
+    count = (count < obj->init->numItems) ? count : obj->init->numItems;
+
+    for (index = 0U; index < count; index++)
+    {
+        value = _SYS_CFG_Get32(&page[SYS_CFG_PAGE_HEADER_SIZE + (4U * index)]);
+        if ((value < items[index].min) || (value > items[index].max))
+        {
+            return false;
+        }
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        previous[index] = *items[index].value;
+        *items[index].value = _SYS_CFG_Get32(&page[SYS_CFG_PAGE_HEADER_SIZE + (4U * index)]);
+    }
+
+    if ((obj->init->isValid != NULL) && (obj->init->isValid() == false))
+    {
+        for (index = 0U; index < count; index++)
+        {
+            *items[index].value = previous[index];
+        }
+        return false;
+    }
+
+    return true;
+}
+
+/* The page after the newest record, or the first page of the next row if
+   the rest of the current row is not erased. The row of the newest record
+   is never the one erased. */
+static uint32_t _SYS_CFG_TargetGet(const SYS_CFG_OBJ *obj)
+{
+    uint32_t target;
+
+    if (obj->newest == obj->pageCount)
+    {
+        return 0U;
+    }
+
+    target = (obj->newest + 1U) % obj->pageCount;
+
+    if (((target % SYS_CFG_PAGES_PER_ROW) != 0U) && (_SYS_CFG_PageIsErased(_SYS_CFG_PageAddress(obj, target)) == false))
+    {
+        target = ((obj->newest / SYS_CFG_PAGES_PER_ROW) + 1U) * SYS_CFG_PAGES_PER_ROW;
+        target = target % obj->pageCount;
+    }
+
+    return target;
+}
+
+static void _SYS_CFG_OperationDone(SYS_CFG_OBJ *obj)
+{
+    bool failed = (NVMCTRL_ErrorGet() != NVMCTRL_ERROR_NONE);
+
+    NVMCTRL_CacheInvalidate();
+
+    if ((failed == false) && (obj->operation == SYS_CFG_OPERATION_WRITE))
+    {
+        failed = (memcmp((const void *)_SYS_CFG_PageAddress(obj, obj->target), obj->page, sizeof(obj->page)) != 0);
+        if (failed == false)
+        {
+            obj->newest = obj->target;
+            obj->sequence = _SYS_CFG_Get32((const uint8_t *)obj->page);
+            obj->status = SYS_CFG_STATUS_SAVED;
+        }
+    }
+
+    if (failed == true)
+    {
+        obj->status = SYS_CFG_STATUS_SAVE_FAILED;
+    }
+
+    obj->operation = SYS_CFG_OPERATION_NONE;
+}
+
+static bool _SYS_CFG_IsQuiet(const SYS_CFG_OBJ *obj)
+{
+    return (obj->init->isQuiet == NULL) || (obj->init->isQuiet() == true);
+}
+
+static void _SYS_CFG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_CFG_OBJ *obj = &gSysCfgObj;
+    const SYS_CFG_ITEM *item;
+    uint32_t value;
+    char *end;
+    size_t index;
+
+    if ((argc == 4) && (strcmp(argv[1], "set") == 0))
+    {
+        for (index = 0U; index < obj->init->numItems; index++)
+        {
+            if (strcmp(argv[2], obj->init->items[index].name) == 0)
+            {
+                break;
+            }
+        }
+
+        value = (uint32_t)strtoul(argv[3], &end, 0);
+        if (index == obj->init->numItems)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nunknown tunable %s\r\n", argv[2]);
+        }
+        else if ((*end != '\0') || (value < obj->init->items[index].min) || (value > obj->init->items[index].max))
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s must be in %lu..%lu\r\n", argv[2],
+                obj->init->items[index].min, obj->init->items[index].max);
+        }
+        else
+        {
+            *obj->init->items[index].value = value;
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nsave and reset to apply\r\n");
+        }
+        return;
+    }
+
+    if ((argc == 2) && (strcmp(argv[1], "default") == 0))
+    {
+        for (index = 0U; index < obj->init->numItems; index++)
+        {
+            *obj->init->items[index].value = obj->defaults[index];
+        }
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nsave and reset to apply\r\n");
+        return;
+    }
+
+    if ((argc == 2) && (strcmp(argv[1], "save") == 0))
+    {
+        if (SYS_CFG_Save() == false)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nsave refused, invalid combination or save in progress\r\n");
+        }
+        return;
+    }
+
+    if (argc > 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: cfg [set <name> <value>|default|save]\r\n");
+        return;
+    }
+
+    for (index = 0U; index < obj->init->numItems; index++)
+    {
+        item = &obj->init->items[index];
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%-12s %10lu  default %lu, %lu..%lu", item->name,
+            *item->value, obj->defaults[index], item->min, item->max);
+    }
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nrecord: %s, sequence %lu\r\n",
+        sysCfgStatusNames[obj->status], (obj->newest == obj->pageCount) ? 0U : obj->sequence);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_CFG_Initialize( const SYS_CFG_INIT * const init )
+{
+    SYS_CFG_OBJ *obj = &gSysCfgObj;
+    uint32_t region[SYS_CFG_SIZE / 4U];
+    const uint8_t *page;
+    uint32_t sequence;
+    uint32_t index;
+
+    memset(obj, 0, sizeof(*obj));
+
+    obj->init = init;
+
+    if ((init->numItems > SYS_CFG_ITEMS_MAX) || (init->size > sizeof(region)) ||
+        ((init->startAddress % NVMCTRL_FLASH_ROWSIZE) != 0U) || ((init->size % NVMCTRL_FLASH_ROWSIZE) != 0U) ||
+        (init->size < (2U * NVMCTRL_FLASH_ROWSIZE)))
+    {
+        return false;
+    }
+
+    obj->pageCount = init->size / NVMCTRL_FLASH_PAGESIZE;
+    obj->newest = obj->pageCount;
+    obj->status = SYS_CFG_STATUS_DEFAULTS;
+
+    for (index = 0U; index < init->numItems; index++)
+    {
+        obj->defaults[index] = *init->items[index].value;
+    }
+
+    (void)NVMCTRL_Read(region, init->size, init->startAddress);
+
+    for (index = 0U; index < obj->pageCount; index++)
+    {
+        page = (const uint8_t *)&region[index * SYS_CFG_PAGE_WORDS];
+        sequence = _SYS_CFG_Get32(page);
+
+        if ((_SYS_CFG_PageIsValid(obj, page) == true) &&
+            ((obj->newest == obj->pageCount) || (sequence > obj->sequence)))
+        {
+            obj->newest = index;
+            obj->sequence = sequence;
+        }
+    }
+
+    if ((obj->newest != obj->pageCount) &&
+        (_SYS_CFG_ValuesApply(obj, (const uint8_t *)&region[obj->newest * SYS_CFG_PAGE_WORDS]) == true))
+    {
+        obj->status = SYS_CFG_STATUS_LOADED;
+    }
+
+    obj->initialized = true;
+
+    return SYS_CMD_ADDGRP(sysCfgCmdTbl, sizeof(sysCfgCmdTbl)/sizeof(*sysCfgCmdTbl), "cfg", ": configuration commands");
+}
+
+void SYS_CFG_Tasks( void )
+{
+    SYS_CFG_OBJ *obj = &gSysCfgObj;
+    uint32_t address;
+
+    if ((obj->initialized == false) || (NVMCTRL_IsBusy() == true))
+    {
+        return;
+    }
+
+    if (obj->operation != SYS_CFG_OPERATION_NONE)
+    {
+        _SYS_CFG_OperationDone(obj);
+    }
+
+    if ((obj->status != SYS_CFG_STATUS_SAVE_PENDING) || (_SYS_CFG_IsQuiet(obj) == false))
+    {
+        return;
+    }
+
+    address = _SYS_CFG_PageAddress(obj, obj->target);
+
+    if (_SYS_CFG_PageIsErased(address) == true)
+    {
+        (void)NVMCTRL_PageWrite(obj->page, address);
+        obj->operation = SYS_CFG_OPERATION_WRITE;
+    }
+    else
+    {
+        (void)NVMCTRL_RowErase(address);
+        obj->operation = SYS_CFG_OPERATION_ERASE;
+    }
+}
+
+bool SYS_CFG_IsIdle( void )
+{
+    SYS_CFG_OBJ *obj = &gSysCfgObj;
+
+    return (obj->operation == SYS_CFG_OPERATION_NONE) &&
+           ((obj->status != SYS_CFG_STATUS_SAVE_PENDING) || (_SYS_CFG_IsQuiet(obj) == false));
+}
+
+bool SYS_CFG_Save( void )
+{
+    SYS_CFG_OBJ *obj = &gSysCfgObj;
+    uint8_t *page = (uint8_t *)obj->page;
+    uint16_t crc;
+    size_t index;
+
+    if ((obj->initialized == false) || (obj->status == SYS_CFG_STATUS_SAVE_PENDING) ||
+        ((obj->init->isValid != NULL) && (obj->init->isValid() == false)))
+    {
+        return false;
+    }
+
+    memset(obj->page, 0xFF, sizeof(obj->page));
+
+    _SYS_CFG_Put32(page, (obj->newest == obj->pageCount) ? 1U : (obj->sequence + 1U));
+    page[4] = obj->init->version;
+    page[5] = (uint8_t)obj->init->numItems;
+    for (index = 0U; index < obj->init->numItems; index++)
+    {
+        _SYS_CFG_Put32(&page[SYS_CFG_PAGE_HEADER_SIZE + (4U * index)], *obj->init->items[index].value);
+    }
+    crc = _SYS_CFG_Crc(page);
+    page[6] = (uint8_t)crc;
+    page[7] = (uint8_t)(crc >> 8);
+
+    obj->target = _SYS_CFG_TargetGet(obj);
+    obj->status = SYS_CFG_STATUS_SAVE_PENDING;
+
+    return true;
+}
+
+SYS_CFG_STATUS SYS_CFG_StatusGet( void )
+{
+    return gSysCfgObj.status;
+}
+
+/*******************************************************************************
+ End of File
+*/
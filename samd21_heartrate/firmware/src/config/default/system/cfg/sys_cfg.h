@@ -0,0 +1,301 @@
+/*******************************************************************************
+  Configuration Record System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_cfg.h
+
+  Summary:
+    Tunables kept in a CRC protected flash record.
+
+  Description:
+    This file contains the interface definition of the configuration record
+    service. The tunables are 32 bit variables of other modules, usually
+    fields of their initialization data, listed in a table of named items.
+    SYS_CFG_Initialize replaces their compile time values by the ones saved
+    in flash, so it must be called before the modules that use them are
+    initialized. Values changed with the "cfg" command take effect at the
+    next reset once saved.
+
+    The record is written to the next page of a region of two rows, the row
+    holding the newest record is never erased, so a reset during a save
+    keeps the previous values. Page layout, all fields little endian:
+
+        sequence(4) version(1) count(1) crc(2) values(4 * count)
+
+    The CRC is a CRC-16/CCITT-FALSE over the page up to the end of the
+    values, the crc field excluded.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_CFG_H
+#define SYS_CFG_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_CFG_PAGE_HEADER_SIZE        8U
+
+/* Values held by one flash page */
+#define SYS_CFG_ITEMS_MAX               14U
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    /* Name used by the "cfg" command */
+    const char *    name;
+
+    uint32_t *      value;
+
+    uint32_t        min;
+
+    uint32_t        max;
+
+} SYS_CFG_ITEM;
+
+typedef bool (*SYS_CFG_IS_VALID)( void );
+
+typedef bool (*SYS_CFG_IS_QUIET)( void );
+
+typedef struct
+{
+    /* Row aligned start of the reserved region */
+    uint32_t                startAddress;
+
+    /* Size of the region, at least two rows */
+    uint32_t                size;
+
+    /* Layout of the values. Change it when items are removed or reordered,
+       items added at the end keep their default with an older record */
+    uint8_t                 version;
+
+    const SYS_CFG_ITEM *    items;
+
+    size_t                  numItems;
+
+    /* Checks combinations of values the item ranges cannot express, NULL if
+       every combination is valid */
+    SYS_CFG_IS_VALID        isValid;
+
+    /* Returns true while flash operations may stall the CPU, NULL if they
+       always may */
+    SYS_CFG_IS_QUIET        isQuiet;
+
+} SYS_CFG_INIT;
+
+typedef enum
+{
+    /* No record found, the items hold their defaults */
+    SYS_CFG_STATUS_DEFAULTS = 0,
+
+    /* The items hold the values of the newest record */
+    SYS_CFG_STATUS_LOADED,
+
+    /* A save was requested and waits for SYS_CFG_Tasks */
+    SYS_CFG_STATUS_SAVE_PENDING,
+
+    SYS_CFG_STATUS_SAVED,
+
+    SYS_CFG_STATUS_SAVE_FAILED,
+
+} SYS_CFG_STATUS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_CFG_Initialize( const SYS_CFG_INIT * const init )
+
+  Summary:
+    Loads the newest valid record into the items.
+
+  Description:
+    The region is read with a single NVMCTRL_Read. A record of another
+    layout version, out of range values or a combination rejected by the
+    isValid callback leave every item at its default.
+
+  Precondition:
+    NVMCTRL_Initialize was called.
+
+  Parameters:
+    init - Region and items, must stay valid
+
+  Returns:
+    false if the region or the item table is not usable.
+
+  Remarks:
+    Registers the "cfg" command group, which does not need the command
+    service to be initialized first.
+*/
+
+bool SYS_CFG_Initialize( const SYS_CFG_INIT * const init );
+
+// *****************************************************************************
+/* Function:
+    void SYS_CFG_Tasks( void )
+
+  Summary:
+    Writes a requested record.
+
+  Description:
+    Erases a row when needed and programs the record page, one flash
+    operation per call and only while the isQuiet callback allows it.
+
+  Precondition:
+    SYS_CFG_Initialize was called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_CFG_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_CFG_IsIdle( void )
+
+  Summary:
+    Returns true when no save is in progress.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_CFG_Initialize was called.
+
+  Parameters:
+    None.
+
+  Returns:
+    See summary.
+
+  Remarks:
+    Used by the power service.
+*/
+
+bool SYS_CFG_IsIdle( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_CFG_Save( void )
+
+  Summary:
+    Requests the current item values to be saved.
+
+  Description:
+    The record is written by SYS_CFG_Tasks.
+
+  Precondition:
+    SYS_CFG_Initialize was called.
+
+  Parameters:
+    None.
+
+  Returns:
+    false if the isValid callback rejects the values.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_CFG_Save( void );
+
+// *****************************************************************************
+/* Function:
+    SYS_CFG_STATUS SYS_CFG_StatusGet( void )
+
+  Summary:
+    Returns the origin of the values or the state of the last save.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_CFG_Initialize was called.
+
+  Parameters:
+    None.
+
+  Returns:
+    See SYS_CFG_STATUS.
+
+  Remarks:
+    None.
+*/
+
+SYS_CFG_STATUS SYS_CFG_StatusGet( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_CFG_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -55,6 +55,7 @@
 #include "configuration.h"
 #include "system/command/sys_command.h"
 #include "system/console/sys_console.h"
+#include "system/fmt/sys_fmt.h"
 #include "system/debug/sys_debug.h"
 #include "system/reset/sys_reset.h"
 #include "osal/osal.h"
@@ -446,7 +447,7 @@ static void RunCmdTask(SYS_CMD_IO_DCPT* pCmdIO)
                 pCmdIO->cmdPnt--; pCmdIO->cmdEnd--;
                 // update the display; erase to the end of line(<ESC>[K) and move cursor backwards (<ESC>[{COUNT}D)
                 *pCmdIO->cmdEnd = '\0';
-                sprintf(pCmdIO->ctrlBuff, "\b\x1b[K%s\x1b[%dD", pCmdIO->cmdPnt, len);
+                SYS_FMT_Snprintf(pCmdIO->ctrlBuff, sizeof(pCmdIO->ctrlBuff), "\b\x1b[K%s\x1b[%dD", pCmdIO->cmdPnt, len);
                 (*pCmdApi->msg)(cmdIoParam, pCmdIO->ctrlBuff);
             }
             else
@@ -470,7 +471,7 @@ static void RunCmdTask(SYS_CMD_IO_DCPT* pCmdIO)
             pCmdIO->cmdEnd--;
             // update the display; erase to the end of line(<ESC>[K) and move cursor backwards (<ESC>[{COUNT}D)
             *pCmdIO->cmdEnd = '\0';
-            sprintf(pCmdIO->ctrlBuff, "\x1b[K%s\x1b[%dD", pCmdIO->cmdPnt, len);
+            SYS_FMT_Snprintf(pCmdIO->ctrlBuff, sizeof(pCmdIO->ctrlBuff), "\x1b[K%s\x1b[%dD", pCmdIO->cmdPnt, len);
             (*pCmdApi->msg)(cmdIoParam, pCmdIO->ctrlBuff);
         }
     }
@@ -492,7 +493,7 @@ static void RunCmdTask(SYS_CMD_IO_DCPT* pCmdIO)
             }
             pCmdIO->cmdEnd++;
             *pCmdIO->cmdEnd = '\0';
-            sprintf(pCmdIO->ctrlBuff + 1, "%s\x1b[%dD", pCmdIO->cmdPnt + 1, n_chars);
+            SYS_FMT_Snprintf(pCmdIO->ctrlBuff + 1, sizeof(pCmdIO->ctrlBuff) - 1U, "%s\x1b[%dD", pCmdIO->cmdPnt + 1, n_chars);
         }
         else
         {
@@ -571,7 +572,7 @@ void SYS_CMD_PRINT(const char* format, ...)
     va_list args = {0};
     va_start( args, format );
 
-    len = vsnprintf(tmpBuf, SYS_CMD_PRINT_BUFFER_SIZE, format, args);
+    len = SYS_FMT_Vsnprintf(tmpBuf, SYS_CMD_PRINT_BUFFER_SIZE, format, args);
 
     va_end( args );
 
@@ -715,7 +716,7 @@ static void SendCommandPrint(const void* cmdIoParam, const char* format, ...)
     va_list args = {0};
     va_start( args, format );
 
-    len = vsnprintf(tmpBuf, SYS_CMD_PRINT_BUFFER_SIZE, format, args);
+    len = SYS_FMT_Vsnprintf(tmpBuf, SYS_CMD_PRINT_BUFFER_SIZE, format, args);
 
     va_end( args );
 
@@ -1062,7 +1063,7 @@ static void _keyHomeProcess(SYS_CMD_IO_DCPT* pCmdIO, const KEY_SEQ_DCPT* pSeqDcp
     {
         // <ESC>[{COUNT}D
         char homeBuff[ 10 + 1];
-        sprintf(homeBuff, "\x1b[%dD", nChars);
+        SYS_FMT_Snprintf(homeBuff, sizeof(homeBuff), "\x1b[%dD", nChars);
         (*pCmdApi->msg)(cmdIoParam, homeBuff);
         pCmdIO->cmdPnt = pCmdIO->cmdBuff;
     }
@@ -1078,7 +1079,7 @@ static void _keyEndProcess(SYS_CMD_IO_DCPT* pCmdIO, const KEY_SEQ_DCPT* pSeqDcpt
     {
         // "<ESC>[{COUNT}C"
         char endBuff[ 10 + 1];
-        sprintf(endBuff, "\x1b[%dC", nChars);
+        SYS_FMT_Snprintf(endBuff, sizeof(endBuff), "\x1b[%dC", nChars);
         (*pCmdApi->msg)(cmdIoParam, endBuff);
         pCmdIO->cmdPnt = pCmdIO->cmdEnd;
     }
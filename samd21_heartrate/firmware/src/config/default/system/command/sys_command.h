@@ -143,7 +143,7 @@
     None.
 
 */
-#define         MAX_CMD_GROUP   8
+#define         MAX_CMD_GROUP   11
 
 
 // *****************************************************************************
@@ -56,6 +56,7 @@
 #include "system/console/sys_console.h"
 #include "configuration.h"
 #include "osal/osal.h"
+#include "system/fmt/sys_fmt.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
@@ -67,6 +68,27 @@ static OSAL_MUTEX_DECLARE(consolePrintBufferMutex);
 
 #define SYS_CONSOLE_GET_INSTANCE(index)    (index >= SYS_CONSOLE_DEVICE_MAX_INSTANCES)? NULL : &consoleDeviceInstance[index]
 
+/* Writes to the device and accounts for the bytes it did not accept */
+static ssize_t _SYS_CONSOLE_DeviceWrite(SYS_CONSOLE_OBJECT_INSTANCE* pConsoleObj, const void* buf, size_t count)
+{
+    ssize_t nBytesWritten = pConsoleObj->devDesc->write(pConsoleObj->devIndex, buf, count);
+
+    if (nBytesWritten < 0)
+    {
+        pConsoleObj->writeDroppedCount += (uint32_t)count;
+    }
+    else if ((size_t)nBytesWritten < count)
+    {
+        pConsoleObj->writeDroppedCount += (uint32_t)(count - (size_t)nBytesWritten);
+    }
+    else
+    {
+        /* All bytes accepted */
+    }
+
+    return nBytesWritten;
+}
+
 SYS_MODULE_OBJ SYS_CONSOLE_Initialize(
     const SYS_MODULE_INDEX index,
     const SYS_MODULE_INIT* const init
@@ -99,6 +121,7 @@ SYS_MODULE_OBJ SYS_CONSOLE_Initialize(
     {
         pConsoleObj->devIndex = initConfig->deviceIndex;
         pConsoleObj->devDesc = initConfig->consDevDesc;
+        pConsoleObj->writeDroppedCount = 0U;
         pConsoleObj->status = SYS_STATUS_READY;
         pConsoleObj->devDesc->init( pConsoleObj->devIndex, initConfig->deviceInitData);
 
@@ -268,7 +291,7 @@ ssize_t SYS_CONSOLE_Write(
             return -1;
         }
 
-        return pConsoleObj->devDesc->write(pConsoleObj->devIndex, buf, count);
+        return _SYS_CONSOLE_DeviceWrite(pConsoleObj, buf, count);
     }
     else
     {
@@ -314,6 +337,18 @@ ssize_t SYS_CONSOLE_WriteCountGet(const SYS_CONSOLE_HANDLE handle)
     }
 }
 
+uint32_t SYS_CONSOLE_WriteDroppedCountGet(const SYS_CONSOLE_HANDLE handle)
+{
+    SYS_CONSOLE_OBJECT_INSTANCE* pConsoleObj = SYS_CONSOLE_GET_INSTANCE(handle);
+
+    if (pConsoleObj == NULL)
+    {
+        return 0U;
+    }
+
+    return pConsoleObj->writeDroppedCount;
+}
+
 void SYS_CONSOLE_Print(const SYS_CONSOLE_HANDLE handle, const char *format, ...)
 {
     size_t len = 0;
@@ -330,24 +365,35 @@ void SYS_CONSOLE_Print(const SYS_CONSOLE_HANDLE handle, const char *format, ...)
         return;
     }
 
-    /* Must protect the common print buffer from multiple threads */
-    if(OSAL_MUTEX_Lock(&consolePrintBufferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_FALSE)
+    /* Get the variable arguments in va_list */
+    va_start( args, format );
+
+    /* Must protect the common print buffer from multiple threads. The print
+       is dropped rather than waiting for another thread to finish. */
+    if(OSAL_MUTEX_Lock(&consolePrintBufferMutex, 0) == OSAL_RESULT_FALSE)
     {
+        pConsoleObj->writeDroppedCount += (uint32_t)SYS_FMT_Vsnprintf(NULL, 0U, format, args);
+
+        va_end( args );
+
         return;
     }
 
-    /* Get the variable arguments in va_list */
-    va_start( args, format );
-
-    len = vsnprintf(consolePrintBuffer, SYS_CONSOLE_PRINT_BUFFER_SIZE, format, args);
+    len = SYS_FMT_Vsnprintf(consolePrintBuffer, SYS_CONSOLE_PRINT_BUFFER_SIZE, format, args);
 
     va_end( args );
 
-    if ((len > 0) && (len < SYS_CONSOLE_PRINT_BUFFER_SIZE))
+    /* Output that did not fit in the print buffer is sent truncated */
+    if (len >= SYS_CONSOLE_PRINT_BUFFER_SIZE)
     {
-        consolePrintBuffer[len] = '\0';
+        pConsoleObj->writeDroppedCount += (uint32_t)(len - (SYS_CONSOLE_PRINT_BUFFER_SIZE - 1U));
+
+        len = SYS_CONSOLE_PRINT_BUFFER_SIZE - 1U;
+    }
 
-        pConsoleObj->devDesc->write(pConsoleObj->devIndex, consolePrintBuffer, len);
+    if (len > 0U)
+    {
+        (void)_SYS_CONSOLE_DeviceWrite(pConsoleObj, consolePrintBuffer, len);
     }
 
     /* Release mutex */
@@ -368,7 +414,7 @@ void SYS_CONSOLE_Message(const SYS_CONSOLE_HANDLE handle, const char *message)
         return;
     }
 
-    pConsoleObj->devDesc->write(pConsoleObj->devIndex, message, strlen(message));
+    (void)_SYS_CONSOLE_DeviceWrite(pConsoleObj, message, strlen(message));
 }
 
 bool SYS_CONSOLE_Flush(const SYS_CONSOLE_HANDLE handle)
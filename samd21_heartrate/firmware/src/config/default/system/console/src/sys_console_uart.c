@@ -91,6 +91,105 @@ static void Console_UART_ResourceUnlock(CONSOLE_UART_DATA* pConsoleUartData)
     OSAL_MUTEX_Unlock(&(pConsoleUartData->mutexTransferObjects));
 }
 
+/* Writers never wait for the mutex, output is refused instead so that the
+   caller is not held up behind a reader or a slow terminal */
+static bool Console_UART_ResourceTryLock(CONSOLE_UART_DATA* pConsoleUartData)
+{
+    if(OSAL_MUTEX_Lock(&(pConsoleUartData->mutexTransferObjects), 0) == OSAL_RESULT_FALSE)
+    {
+        return false;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+static size_t Console_UART_StagingCountGet(CONSOLE_UART_DATA* pConsoleUartData)
+{
+    /* Take a snapshot of indices to avoid creation of critical section */
+    size_t inIndex = pConsoleUartData->stagingInIndex;
+    size_t outIndex = pConsoleUartData->stagingOutIndex;
+
+    if (inIndex >= outIndex)
+    {
+        return inIndex - outIndex;
+    }
+    else
+    {
+        return (pConsoleUartData->stagingSize - outIndex) + inIndex;
+    }
+}
+
+static size_t Console_UART_StagingFreeCountGet(CONSOLE_UART_DATA* pConsoleUartData)
+{
+    if (pConsoleUartData->stagingSize == 0U)
+    {
+        return 0U;
+    }
+
+    return (pConsoleUartData->stagingSize - 1U) - Console_UART_StagingCountGet(pConsoleUartData);
+}
+
+/* Move staged bytes to the PLIB transmit ring for as long as it has room */
+static void Console_UART_StagingDrain(CONSOLE_UART_DATA* pConsoleUartData)
+{
+    size_t inIndex = pConsoleUartData->stagingInIndex;
+    size_t outIndex = pConsoleUartData->stagingOutIndex;
+    size_t nContiguous;
+    size_t nBytesWritten;
+
+    while (outIndex != inIndex)
+    {
+        nContiguous = (inIndex > outIndex) ? (inIndex - outIndex) : (pConsoleUartData->stagingSize - outIndex);
+
+        nBytesWritten = pConsoleUartData->uartPLIB->write(&pConsoleUartData->stagingBuffer[outIndex], nContiguous);
+
+        outIndex += nBytesWritten;
+
+        if (outIndex >= pConsoleUartData->stagingSize)
+        {
+            outIndex = 0U;
+        }
+
+        if (nBytesWritten < nContiguous)
+        {
+            /* PLIB ring is full */
+            break;
+        }
+    }
+
+    pConsoleUartData->stagingOutIndex = outIndex;
+}
+
+static size_t Console_UART_StagingPush(CONSOLE_UART_DATA* pConsoleUartData, const uint8_t* pWrBuffer, size_t count)
+{
+    size_t inIndex = pConsoleUartData->stagingInIndex;
+    size_t nFree = Console_UART_StagingFreeCountGet(pConsoleUartData);
+    size_t nBytesStaged;
+
+    if (count > nFree)
+    {
+        count = nFree;
+    }
+
+    for (nBytesStaged = 0U; nBytesStaged < count; nBytesStaged++)
+    {
+        pConsoleUartData->stagingBuffer[inIndex] = pWrBuffer[nBytesStaged];
+
+        inIndex++;
+
+        if (inIndex >= pConsoleUartData->stagingSize)
+        {
+            inIndex = 0U;
+        }
+    }
+
+    pConsoleUartData->stagingInIndex = inIndex;
+
+    return nBytesStaged;
+}
+
 void Console_UART_Initialize(uint32_t index, const void* initData)
 {
     CONSOLE_UART_DATA* pConsoleUartData = CONSOLE_UART_GET_INSTANCE(index);
@@ -109,6 +208,11 @@ void Console_UART_Initialize(uint32_t index, const void* initData)
     /* Assign the USART PLIB instance APIs to use */
     pConsoleUartData->uartPLIB = consoleUsartInitData->uartPLIB;
 
+    pConsoleUartData->stagingBuffer = consoleUsartInitData->stagingBuffer;
+    pConsoleUartData->stagingSize = (consoleUsartInitData->stagingBuffer != NULL) ? consoleUsartInitData->stagingBufferSize : 0U;
+    pConsoleUartData->stagingInIndex = 0U;
+    pConsoleUartData->stagingOutIndex = 0U;
+
     pConsoleUartData->status = SYS_CONSOLE_STATUS_CONFIGURED;
 }
 
@@ -183,9 +287,12 @@ ssize_t Console_UART_ReadFreeBufferCountGet(uint32_t index)
     return nFreeBufferAvailable;
 }
 
+/* Never blocks. Returns the number of bytes accepted, which is less than count
+   when the PLIB ring and the staging ring are full or another writer holds the
+   console. The caller decides whether the remainder is retried or dropped. */
 ssize_t Console_UART_Write(uint32_t index, const void* pWrBuffer, size_t count )
 {
-    ssize_t nBytesWritten = 0;
+    size_t nBytesWritten = 0U;
 
     CONSOLE_UART_DATA* pConsoleUartData = CONSOLE_UART_GET_INSTANCE(index);
 
@@ -194,16 +301,30 @@ ssize_t Console_UART_Write(uint32_t index, const void* pWrBuffer, size_t count )
         return -1;
     }
 
-    if (Console_UART_ResourceLock(pConsoleUartData) == false)
+    if (Console_UART_ResourceTryLock(pConsoleUartData) == false)
     {
-        return -1;
+        return 0;
     }
 
-    nBytesWritten = pConsoleUartData->uartPLIB->write((uint8_t*)pWrBuffer, count);
+    if (pConsoleUartData->stagingSize != 0U)
+    {
+        Console_UART_StagingDrain(pConsoleUartData);
+    }
+
+    /* Staged bytes go out first to keep the output in order */
+    if (Console_UART_StagingCountGet(pConsoleUartData) == 0U)
+    {
+        nBytesWritten = pConsoleUartData->uartPLIB->write((uint8_t*)pWrBuffer, count);
+    }
+
+    if ((nBytesWritten < count) && (pConsoleUartData->stagingSize != 0U))
+    {
+        nBytesWritten += Console_UART_StagingPush(pConsoleUartData, &((const uint8_t*)pWrBuffer)[nBytesWritten], count - nBytesWritten);
+    }
 
     Console_UART_ResourceUnlock(pConsoleUartData);
 
-    return nBytesWritten;
+    return (ssize_t)nBytesWritten;
 }
 
 ssize_t Console_UART_WriteFreeBufferCountGet(uint32_t index)
@@ -222,7 +343,7 @@ ssize_t Console_UART_WriteFreeBufferCountGet(uint32_t index)
         return -1;
     }
 
-    nFreeBufferAvailable = pConsoleUartData->uartPLIB->writeFreeBufferCountGet();
+    nFreeBufferAvailable = pConsoleUartData->uartPLIB->writeFreeBufferCountGet() + Console_UART_StagingFreeCountGet(pConsoleUartData);
 
     Console_UART_ResourceUnlock(pConsoleUartData);
 
@@ -245,7 +366,7 @@ ssize_t Console_UART_WriteCountGet(uint32_t index)
         return -1;
     }
 
-    nPendingTxBytes = pConsoleUartData->uartPLIB->writeCountGet();
+    nPendingTxBytes = pConsoleUartData->uartPLIB->writeCountGet() + Console_UART_StagingCountGet(pConsoleUartData);
 
     Console_UART_ResourceUnlock(pConsoleUartData);
 
@@ -254,7 +375,23 @@ ssize_t Console_UART_WriteCountGet(uint32_t index)
 
 bool Console_UART_Flush(uint32_t index)
 {
-    /* Data is not buffered, nothing to flush */
+    CONSOLE_UART_DATA* pConsoleUartData = CONSOLE_UART_GET_INSTANCE(index);
+
+    if (pConsoleUartData == NULL)
+    {
+        return false;
+    }
+
+    if (Console_UART_ResourceLock(pConsoleUartData) == false)
+    {
+        return false;
+    }
+
+    /* Discard the staged output, the PLIB ring is left to drain */
+    pConsoleUartData->stagingOutIndex = pConsoleUartData->stagingInIndex;
+
+    Console_UART_ResourceUnlock(pConsoleUartData);
+
     return true;
 }
 
@@ -274,5 +411,24 @@ SYS_CONSOLE_STATUS Console_UART_Status(uint32_t index)
 
 void Console_UART_Tasks(uint32_t index, SYS_MODULE_OBJ object)
 {
-    /* Do nothing. */
+    CONSOLE_UART_DATA* pConsoleUartData = CONSOLE_UART_GET_INSTANCE(index);
+
+    if ((pConsoleUartData == NULL) || (pConsoleUartData->stagingSize == 0U))
+    {
+        return;
+    }
+
+    if (Console_UART_StagingCountGet(pConsoleUartData) == 0U)
+    {
+        return;
+    }
+
+    if (Console_UART_ResourceTryLock(pConsoleUartData) == false)
+    {
+        return;
+    }
+
+    Console_UART_StagingDrain(pConsoleUartData);
+
+    Console_UART_ResourceUnlock(pConsoleUartData);
 }
\ No newline at end of file
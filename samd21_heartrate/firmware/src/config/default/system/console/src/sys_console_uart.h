@@ -75,6 +75,16 @@ typedef struct
 
     SYS_CONSOLE_STATUS status;
 
+    /* Staging ring, written by Console_UART_Write and drained to the PLIB
+       transmit ring by Console_UART_Tasks */
+    uint8_t* stagingBuffer;
+
+    size_t stagingSize;
+
+    volatile size_t stagingInIndex;
+
+    volatile size_t stagingOutIndex;
+
     /* Mutex to protect access to the transfer objects */
     OSAL_MUTEX_DECLARE(mutexTransferObjects);
 
@@ -79,6 +79,12 @@ typedef struct
 typedef struct
 {
     const SYS_CONSOLE_UART_PLIB_INTERFACE* 				uartPLIB;
+
+    /* Optional staging ring used when the PLIB transmit ring is full.
+       Set to NULL and 0 to write straight to the PLIB ring. */
+    uint8_t*                                            stagingBuffer;
+
+    size_t                                              stagingBufferSize;
 	
 } SYS_CONSOLE_UART_INIT_DATA;
 
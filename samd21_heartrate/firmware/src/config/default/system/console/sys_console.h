@@ -329,6 +329,9 @@ typedef struct
 
     CONSOLE_DEVICE_INDEX devIndex;
 
+    /* Bytes the device did not accept from write, print and message calls */
+    volatile uint32_t writeDroppedCount;
+
 } SYS_CONSOLE_OBJECT_INSTANCE;
 
 
@@ -677,6 +680,10 @@ ssize_t SYS_CONSOLE_Read( const SYS_CONSOLE_HANDLE handle, void* buf, size_t cou
     the return value is less than the count value, the application must try to send the
     remaining bytes in next attempt(s). Returns -1 in case of any error.
 
+    The function never blocks. A full transmit path or a concurrent writer makes
+    it accept fewer bytes, possibly none, and the refused bytes are added to the
+    count returned by SYS_CONSOLE_WriteDroppedCountGet().
+
   Example:
     <code>
     ssize_t nr;
@@ -920,6 +927,42 @@ ssize_t SYS_CONSOLE_WriteFreeBufferCountGet(const SYS_CONSOLE_HANDLE handle);
 */
 ssize_t SYS_CONSOLE_WriteCountGet(const SYS_CONSOLE_HANDLE handle);
 
+// *****************************************************************************
+/* Function:
+    uint32_t SYS_CONSOLE_WriteDroppedCountGet(const SYS_CONSOLE_HANDLE handle)
+
+  Summary:
+    Returns the number of output bytes the console could not accept.
+
+  Description:
+    This function returns the number of bytes refused by SYS_CONSOLE_Write,
+    SYS_CONSOLE_Print and SYS_CONSOLE_Message since initialization, either
+    because the transmit and staging buffers were full or because another
+    writer was using the console at the time.
+
+  Preconditions:
+    The SYS_CONSOLE_Initialize function should have been called before calling
+    this function.
+
+  Parameters:
+    handle           - Handle to the console instance
+
+  Returns:
+    Number of dropped bytes. Returns 0 for an invalid handle.
+
+  Example:
+    <code>
+    uint32_t nDropped;
+
+    nDropped = SYS_CONSOLE_WriteDroppedCountGet(myConsoleHandle);
+    </code>
+
+  Remarks:
+    The counter wraps at 2^32. An application that retries a partial
+    SYS_CONSOLE_Write counts the refused part again on each attempt.
+*/
+uint32_t SYS_CONSOLE_WriteDroppedCountGet(const SYS_CONSOLE_HANDLE handle);
+
 // *****************************************************************************
 /* Function:
     void SYS_CONSOLE_Print(const SYS_CONSOLE_HANDLE handle, const char *format, ...)
@@ -963,6 +1006,10 @@ ssize_t SYS_CONSOLE_WriteCountGet(const SYS_CONSOLE_HANDLE handle);
   Remarks:
     The format string and arguments follow the printf convention.
     Call SYS_CONSOLE_PRINT macro to print on the default console instance 0
+
+    The function does not wait for the shared print buffer or for space in the
+    transmit path. Output that cannot be formatted or sent right away is
+    dropped and counted by SYS_CONSOLE_WriteDroppedCountGet().
 */
 
 void SYS_CONSOLE_Print(const SYS_CONSOLE_HANDLE handle, const char *format, ...);
@@ -0,0 +1,672 @@
+/*******************************************************************************
+  Flash Log System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_flashlog.c
+
+  Summary:
+    Flash Log System Service implementation.
+
+  Description:
+    This file contains the source code for the flash log system service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "system/flashlog/sys_flashlog.h"
+#include "system/command/sys_command.h"
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_FLASHLOG_PAGES_PER_ROW      (NVMCTRL_FLASH_ROWSIZE / NVMCTRL_FLASH_PAGESIZE)
+#define SYS_FLASHLOG_PAGE_WORDS         (NVMCTRL_FLASH_PAGESIZE / 4U)
+#define SYS_FLASHLOG_PAYLOAD_SIZE       (NVMCTRL_FLASH_PAGESIZE - SYS_FLASHLOG_PAGE_HEADER_SIZE)
+#define SYS_FLASHLOG_SEQUENCE_ERASED    0xFFFFFFFFU
+
+typedef enum
+{
+    SYS_FLASHLOG_OPERATION_NONE = 0,
+    SYS_FLASHLOG_OPERATION_WRITE,
+    SYS_FLASHLOG_OPERATION_ERASE,
+} SYS_FLASHLOG_OPERATION;
+
+typedef struct
+{
+    const SYS_FLASHLOG_INIT    *init;
+
+    bool                        mounted;
+
+    uint32_t                    pageCount;
+
+    uint8_t                     recordsPerPage;
+
+    /* Next page to write */
+    uint32_t                    head;
+
+    /* Erased pages from head on, they end on a row boundary */
+    uint32_t                    pagesErased;
+
+    /* Oldest page that has not been drained, and pages from there to head */
+    uint32_t                    tail;
+    uint32_t                    pagesUsed;
+
+    uint32_t                    nextSequence;
+
+    SYS_FLASHLOG_OPERATION      operation;
+
+    /* Page being filled and the full page waiting for the flash */
+    uint32_t                    fill[SYS_FLASHLOG_PAGE_WORDS];
+    uint8_t                     fillCount;
+    uint32_t                    pending[SYS_FLASHLOG_PAGE_WORDS];
+    bool                        pendingValid;
+
+    /* The partial page is sealed once the pending page is written */
+    bool                        flushRequested;
+
+    SYS_FLASHLOG_STATISTICS     stats;
+
+} SYS_FLASHLOG_OBJ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_FLASHLOG_OBJ gSysFlashLogObj;
+
+static void _SYS_FLASHLOG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysFlashLogCmdTbl[] =
+{
+    {"flog", _SYS_FLASHLOG_Command, ": show usage, 'flog dump [n]' prints and 'flog drain' releases records"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static const uint8_t *_SYS_FLASHLOG_PageGet(const SYS_FLASHLOG_OBJ *obj, uint32_t page)
+{
+    return (const uint8_t *)(obj->init->startAddress + (page * NVMCTRL_FLASH_PAGESIZE));
+}
+
+static uint32_t _SYS_FLASHLOG_PageAdd(const SYS_FLASHLOG_OBJ *obj, uint32_t page, uint32_t count)
+{
+    page += count;
+
+    return (page >= obj->pageCount) ? (page - obj->pageCount) : page;
+}
+
+static uint32_t _SYS_FLASHLOG_Get32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static uint16_t _SYS_FLASHLOG_Checksum(const uint8_t *page)
+{
+    uint32_t sum1 = 0U;
+    uint32_t sum2 = 0U;
+    size_t size = (size_t)page[4] * page[5];
+    size_t index;
+
+    /* A page holds less than 64 bytes, so the sums are reduced once at the
+       end instead of for every byte. The M0+ has no divider and the per byte
+       modulo made the mount scan of a full log take tens of milliseconds. */
+    for (index = 0U; index < 6U; index++)
+    {
+        sum1 += page[index];
+        sum2 += sum1;
+    }
+
+    for (index = 0U; index < size; index++)
+    {
+        sum1 += page[SYS_FLASHLOG_PAGE_HEADER_SIZE + index];
+        sum2 += sum1;
+    }
+
+    return (uint16_t)(((sum2 % 255U) << 8) | (sum1 % 255U));
+}
+
+/* Returns the page sequence number, SYS_FLASHLOG_SEQUENCE_ERASED if the
+   page does not hold a valid header for this record size */
+static uint32_t _SYS_FLASHLOG_PageSequence(const SYS_FLASHLOG_OBJ *obj, const uint8_t *page)
+{
+    uint32_t sequence = _SYS_FLASHLOG_Get32(page);
+
+    if ((sequence == SYS_FLASHLOG_SEQUENCE_ERASED) || (page[5] != obj->init->recordSize) ||
+        (page[4] == 0U) || (page[4] > obj->recordsPerPage))
+    {
+        return SYS_FLASHLOG_SEQUENCE_ERASED;
+    }
+
+    if (_SYS_FLASHLOG_Checksum(page) != ((uint16_t)page[6] | ((uint16_t)page[7] << 8)))
+    {
+        return SYS_FLASHLOG_SEQUENCE_ERASED;
+    }
+
+    return sequence;
+}
+
+static bool _SYS_FLASHLOG_PageIsErased(const uint8_t *page)
+{
+    const uint32_t *word = (const uint32_t *)page;
+    uint32_t index;
+
+    for (index = 0U; index < SYS_FLASHLOG_PAGE_WORDS; index++)
+    {
+        if (word[index] != 0xFFFFFFFFU)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void _SYS_FLASHLOG_Mount(SYS_FLASHLOG_OBJ *obj)
+{
+    uint32_t oldest = 0U;
+    uint32_t newest = 0U;
+    uint32_t oldestSequence = SYS_FLASHLOG_SEQUENCE_ERASED;
+    uint32_t newestSequence = 0U;
+    uint32_t sequence;
+    uint32_t page;
+    uint32_t limit;
+    uint32_t erased;
+    uint32_t rowLeft;
+
+    for (page = 0U; page < obj->pageCount; page++)
+    {
+        sequence = _SYS_FLASHLOG_PageSequence(obj, _SYS_FLASHLOG_PageGet(obj, page));
+        if (sequence == SYS_FLASHLOG_SEQUENCE_ERASED)
+        {
+            continue;
+        }
+
+        if ((oldestSequence == SYS_FLASHLOG_SEQUENCE_ERASED) || (sequence < oldestSequence))
+        {
+            oldest = page;
+            oldestSequence = sequence;
+        }
+
+        if (sequence >= newestSequence)
+        {
+            newest = page;
+            newestSequence = sequence;
+        }
+    }
+
+    if (oldestSequence == SYS_FLASHLOG_SEQUENCE_ERASED)
+    {
+        obj->head = 0U;
+        obj->tail = 0U;
+        obj->pagesUsed = 0U;
+        obj->nextSequence = 0U;
+    }
+    else
+    {
+        obj->head = _SYS_FLASHLOG_PageAdd(obj, newest, 1U);
+        obj->tail = oldest;
+        obj->pagesUsed = _SYS_FLASHLOG_PageAdd(obj, newest, obj->pageCount - oldest) + 1U;
+        obj->nextSequence = newestSequence + 1U;
+    }
+
+    /* Count the erased pages after head in whole rows */
+    limit = obj->pageCount - obj->pagesUsed;
+    erased = 0U;
+    page = obj->head;
+    while ((erased < limit) && (_SYS_FLASHLOG_PageIsErased(_SYS_FLASHLOG_PageGet(obj, page)) == true))
+    {
+        erased++;
+        page = _SYS_FLASHLOG_PageAdd(obj, page, 1U);
+    }
+
+    rowLeft = SYS_FLASHLOG_PAGES_PER_ROW - (obj->head % SYS_FLASHLOG_PAGES_PER_ROW);
+
+    if ((rowLeft != SYS_FLASHLOG_PAGES_PER_ROW) && (erased < rowLeft))
+    {
+        /* A reset during a write left the rest of the head row programmed,
+           continue on the next row and let the iterator skip the gap */
+        obj->head = _SYS_FLASHLOG_PageAdd(obj, obj->head, rowLeft);
+        if (obj->pagesUsed == 0U)
+        {
+            obj->tail = obj->head;
+        }
+        else if ((obj->pagesUsed + rowLeft) >= obj->pageCount)
+        {
+            obj->tail = obj->head;
+            obj->pagesUsed = obj->pageCount;
+        }
+        else
+        {
+            obj->pagesUsed += rowLeft;
+        }
+        obj->pagesErased = 0U;
+    }
+    else
+    {
+        obj->pagesErased = erased - ((erased + (obj->head % SYS_FLASHLOG_PAGES_PER_ROW)) % SYS_FLASHLOG_PAGES_PER_ROW);
+    }
+}
+
+static bool _SYS_FLASHLOG_IsQuiet(const SYS_FLASHLOG_OBJ *obj)
+{
+    return (obj->init->isQuiet == NULL) || (obj->init->isQuiet() == true);
+}
+
+static void _SYS_FLASHLOG_PageSeal(SYS_FLASHLOG_OBJ *obj)
+{
+    uint8_t *page = (uint8_t *)obj->fill;
+    uint16_t checksum;
+
+    page[4] = obj->fillCount;
+    page[5] = obj->init->recordSize;
+    checksum = _SYS_FLASHLOG_Checksum(page);
+    page[6] = (uint8_t)checksum;
+    page[7] = (uint8_t)(checksum >> 8);
+
+    memcpy(obj->pending, obj->fill, sizeof(obj->pending));
+    obj->pendingValid = true;
+
+    memset(obj->fill, 0xFF, sizeof(obj->fill));
+    obj->fillCount = 0U;
+}
+
+/* Completes the operation started by the previous call */
+static void _SYS_FLASHLOG_OperationDone(SYS_FLASHLOG_OBJ *obj)
+{
+    if (NVMCTRL_ErrorGet() != NVMCTRL_ERROR_NONE)
+    {
+        obj->stats.flashErrors++;
+    }
+
+    if (obj->operation == SYS_FLASHLOG_OPERATION_WRITE)
+    {
+        obj->head = _SYS_FLASHLOG_PageAdd(obj, obj->head, 1U);
+        obj->pagesErased--;
+        obj->pagesUsed++;
+        obj->pendingValid = false;
+        obj->stats.pageWrites++;
+
+        if ((obj->flushRequested == true) && (obj->fillCount != 0U))
+        {
+            _SYS_FLASHLOG_PageSeal(obj);
+        }
+        obj->flushRequested = false;
+    }
+    else
+    {
+        obj->pagesErased += SYS_FLASHLOG_PAGES_PER_ROW;
+        obj->stats.rowErases++;
+    }
+
+    NVMCTRL_CacheInvalidate();
+
+    obj->operation = SYS_FLASHLOG_OPERATION_NONE;
+}
+
+/* Erases the row after the erased pages, dropping the oldest row if the
+   region is full */
+static void _SYS_FLASHLOG_RowErase(SYS_FLASHLOG_OBJ *obj)
+{
+    uint32_t row = _SYS_FLASHLOG_PageAdd(obj, obj->head, obj->pagesErased);
+    uint32_t stale = obj->pageCount - obj->pagesUsed - obj->pagesErased;
+    uint32_t dropped;
+    const uint8_t *page;
+
+    if (stale < SYS_FLASHLOG_PAGES_PER_ROW)
+    {
+        /* The row holds the oldest pages, row - tail of them were drained */
+        dropped = SYS_FLASHLOG_PAGES_PER_ROW - stale;
+        while (dropped > 0U)
+        {
+            page = _SYS_FLASHLOG_PageGet(obj, obj->tail);
+            if (_SYS_FLASHLOG_PageSequence(obj, page) != SYS_FLASHLOG_SEQUENCE_ERASED)
+            {
+                obj->stats.recordsOverwritten += page[4];
+            }
+            obj->tail = _SYS_FLASHLOG_PageAdd(obj, obj->tail, 1U);
+            obj->pagesUsed--;
+            dropped--;
+        }
+    }
+
+    (void)NVMCTRL_RowErase(obj->init->startAddress + (row * NVMCTRL_FLASH_PAGESIZE));
+    obj->operation = SYS_FLASHLOG_OPERATION_ERASE;
+}
+
+static bool _SYS_FLASHLOG_WorkPending(const SYS_FLASHLOG_OBJ *obj, bool quiet)
+{
+    if (obj->mounted == false)
+    {
+        return false;
+    }
+
+    if (obj->operation != SYS_FLASHLOG_OPERATION_NONE)
+    {
+        return true;
+    }
+
+    if (obj->pendingValid == true)
+    {
+        /* Both page buffers full forces the write out, the next record
+           would be dropped */
+        return (quiet == true) || (obj->fillCount >= obj->recordsPerPage);
+    }
+
+    /* Keep a row erased ahead, and erase released rows */
+    return (quiet == true) &&
+           ((obj->pagesErased < SYS_FLASHLOG_PAGES_PER_ROW) ||
+            ((obj->pageCount - obj->pagesUsed - obj->pagesErased) >= SYS_FLASHLOG_PAGES_PER_ROW));
+}
+
+static void _SYS_FLASHLOG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_FLASHLOG_STATISTICS stats;
+    SYS_FLASHLOG_ITERATOR iterator;
+    uint8_t record[SYS_FLASHLOG_PAYLOAD_SIZE];
+    uint32_t count = 0U;
+    uint32_t limit;
+    uint8_t index;
+
+    if ((argc > 1) && (strcmp(argv[1], "dump") == 0))
+    {
+        limit = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 0xFFFFFFFFU;
+
+        SYS_FLASHLOG_IteratorInit(&iterator);
+        while ((count < limit) && (SYS_FLASHLOG_IteratorNext(&iterator, record) == true))
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%lu:", count);
+            for (index = 0U; index < gSysFlashLogObj.init->recordSize; index++)
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, " %02x", record[index]);
+            }
+            count++;
+        }
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+        return;
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "drain") == 0))
+    {
+        SYS_FLASHLOG_IteratorInit(&iterator);
+        while (SYS_FLASHLOG_IteratorNext(&iterator, record) == true)
+        {
+            count++;
+        }
+        SYS_FLASHLOG_Consume(&iterator);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%lu records released\r\n", count);
+        return;
+    }
+
+    if (argc > 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: flog [dump [n]|drain]\r\n");
+        return;
+    }
+
+    SYS_FLASHLOG_StatisticsGet(&stats);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\npages: %lu of %lu used, %lu erased ahead\r\n",
+        stats.pagesUsed, stats.pagesTotal, gSysFlashLogObj.pagesErased);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "records: %lu appended, %lu dropped, %lu overwritten\r\n",
+        stats.recordsAppended, stats.recordsDropped, stats.recordsOverwritten);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "flash: %lu page writes, %lu row erases, %lu errors\r\n",
+        stats.pageWrites, stats.rowErases, stats.flashErrors);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_FLASHLOG_Initialize( const SYS_FLASHLOG_INIT * const init )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+
+    memset(obj, 0, sizeof(*obj));
+    memset(obj->fill, 0xFF, sizeof(obj->fill));
+
+    obj->init = init;
+
+    if ((init->recordSize == 0U) || (init->recordSize > SYS_FLASHLOG_PAYLOAD_SIZE) ||
+        ((init->startAddress % NVMCTRL_FLASH_ROWSIZE) != 0U) || ((init->size % NVMCTRL_FLASH_ROWSIZE) != 0U) ||
+        (init->size < (2U * NVMCTRL_FLASH_ROWSIZE)))
+    {
+        return false;
+    }
+
+    obj->pageCount = init->size / NVMCTRL_FLASH_PAGESIZE;
+    obj->recordsPerPage = (uint8_t)(SYS_FLASHLOG_PAYLOAD_SIZE / init->recordSize);
+
+    return SYS_CMD_ADDGRP(sysFlashLogCmdTbl, sizeof(sysFlashLogCmdTbl)/sizeof(*sysFlashLogCmdTbl), "flog", ": flash log commands");
+}
+
+void SYS_FLASHLOG_Tasks( void )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+    bool quiet;
+
+    /* The mount scan reads the whole region, it is left to the first task
+       call so that it does not delay the sensor start in SYS_Initialize */
+    if ((obj->mounted == false) && (obj->pageCount != 0U))
+    {
+        _SYS_FLASHLOG_Mount(obj);
+        obj->mounted = true;
+        return;
+    }
+
+    if ((obj->mounted == false) || (NVMCTRL_IsBusy() == true))
+    {
+        return;
+    }
+
+    if (obj->operation != SYS_FLASHLOG_OPERATION_NONE)
+    {
+        _SYS_FLASHLOG_OperationDone(obj);
+    }
+
+    quiet = _SYS_FLASHLOG_IsQuiet(obj);
+
+    if (_SYS_FLASHLOG_WorkPending(obj, quiet) == false)
+    {
+        return;
+    }
+
+    if ((obj->pendingValid == true) && (obj->pagesErased != 0U))
+    {
+        (void)NVMCTRL_PageWrite(obj->pending, obj->init->startAddress + (obj->head * NVMCTRL_FLASH_PAGESIZE));
+        obj->operation = SYS_FLASHLOG_OPERATION_WRITE;
+    }
+    else
+    {
+        _SYS_FLASHLOG_RowErase(obj);
+    }
+}
+
+bool SYS_FLASHLOG_IsIdle( void )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+
+    return (_SYS_FLASHLOG_WorkPending(obj, _SYS_FLASHLOG_IsQuiet(obj)) == false);
+}
+
+bool SYS_FLASHLOG_Append( const void * record )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+    uint8_t *page = (uint8_t *)obj->fill;
+
+    if (obj->mounted == false)
+    {
+        return false;
+    }
+
+    if (obj->fillCount >= obj->recordsPerPage)
+    {
+        if (obj->pendingValid == true)
+        {
+            obj->stats.recordsDropped++;
+            return false;
+        }
+        _SYS_FLASHLOG_PageSeal(obj);
+    }
+
+    if (obj->fillCount == 0U)
+    {
+        page[0] = (uint8_t)obj->nextSequence;
+        page[1] = (uint8_t)(obj->nextSequence >> 8);
+        page[2] = (uint8_t)(obj->nextSequence >> 16);
+        page[3] = (uint8_t)(obj->nextSequence >> 24);
+        obj->nextSequence++;
+    }
+
+    memcpy(&page[SYS_FLASHLOG_PAGE_HEADER_SIZE + ((size_t)obj->fillCount * obj->init->recordSize)], record, obj->init->recordSize);
+    obj->fillCount++;
+    obj->stats.recordsAppended++;
+
+    if ((obj->fillCount >= obj->recordsPerPage) && (obj->pendingValid == false))
+    {
+        _SYS_FLASHLOG_PageSeal(obj);
+    }
+
+    return true;
+}
+
+void SYS_FLASHLOG_Flush( void )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+
+    if (obj->fillCount == 0U)
+    {
+        return;
+    }
+
+    if (obj->pendingValid == false)
+    {
+        _SYS_FLASHLOG_PageSeal(obj);
+    }
+    else
+    {
+        obj->flushRequested = true;
+    }
+}
+
+void SYS_FLASHLOG_IteratorInit( SYS_FLASHLOG_ITERATOR * iterator )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+
+    iterator->page = obj->tail;
+    iterator->pagesLeft = obj->pagesUsed;
+    iterator->sequenceEnd = obj->nextSequence;
+    iterator->record = 0U;
+}
+
+bool SYS_FLASHLOG_IteratorNext( SYS_FLASHLOG_ITERATOR * iterator, void * record )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+    const uint8_t *page;
+    uint32_t sequence;
+
+    while (iterator->pagesLeft != 0U)
+    {
+        page = _SYS_FLASHLOG_PageGet(obj, iterator->page);
+        sequence = _SYS_FLASHLOG_PageSequence(obj, page);
+
+        /* Pages written since the iterator was initialized end the walk */
+        if ((sequence != SYS_FLASHLOG_SEQUENCE_ERASED) && (sequence >= iterator->sequenceEnd))
+        {
+            iterator->pagesLeft = 0U;
+            break;
+        }
+
+        if ((sequence != SYS_FLASHLOG_SEQUENCE_ERASED) && (iterator->record < page[4]))
+        {
+            memcpy(record, &page[SYS_FLASHLOG_PAGE_HEADER_SIZE + ((size_t)iterator->record * obj->init->recordSize)], obj->init->recordSize);
+            iterator->record++;
+            if (iterator->record >= page[4])
+            {
+                iterator->record = 0U;
+                iterator->page = _SYS_FLASHLOG_PageAdd(obj, iterator->page, 1U);
+                iterator->pagesLeft--;
+            }
+            return true;
+        }
+
+        iterator->record = 0U;
+        iterator->page = _SYS_FLASHLOG_PageAdd(obj, iterator->page, 1U);
+        iterator->pagesLeft--;
+    }
+
+    return false;
+}
+
+void SYS_FLASHLOG_Consume( const SYS_FLASHLOG_ITERATOR * iterator )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+    uint32_t released = _SYS_FLASHLOG_PageAdd(obj, iterator->page, obj->pageCount - obj->tail);
+
+    /* Nothing to do if the oldest row was overwritten past the iterator */
+    if (released <= obj->pagesUsed)
+    {
+        obj->tail = iterator->page;
+        obj->pagesUsed -= released;
+    }
+}
+
+void SYS_FLASHLOG_StatisticsGet( SYS_FLASHLOG_STATISTICS * stats )
+{
+    SYS_FLASHLOG_OBJ *obj = &gSysFlashLogObj;
+
+    *stats = obj->stats;
+    stats->pagesUsed = obj->pagesUsed;
+    stats->pagesTotal = obj->pageCount;
+}
+
+/*******************************************************************************
+ End of File
+*/
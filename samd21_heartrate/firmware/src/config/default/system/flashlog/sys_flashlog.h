@@ -0,0 +1,393 @@
+/*******************************************************************************
+  Flash Log System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_flashlog.h
+
+  Summary:
+    Circular record log in a reserved region of the main flash.
+
+  Description:
+    This file contains the interface definition for the flash log system
+    service. Fixed size records are collected in RAM and written one flash
+    page at a time to a region reserved by the linker script. Every page
+    starts with a header carrying a sequence number, so the newest and the
+    oldest page are found by a single pass over the headers at start-up.
+
+    Page layout, all fields little endian:
+
+        sequence(4) count(1) recordSize(1) checksum(2) records...
+
+    The checksum is a Fletcher-16 over the first six header bytes and the
+    records. Erased pages read as 0xFF and are never valid.
+
+    Rows are erased ahead of the write position from SYS_FLASHLOG_Tasks.
+    The flash does not answer reads while it is erased or programmed, so
+    both operations wait until the isQuiet callback allows them, unless the
+    RAM buffers would otherwise overflow. Once the region is full the oldest
+    row is erased and its records are lost.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_FLASHLOG_H
+#define SYS_FLASHLOG_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_FLASHLOG_PAGE_HEADER_SIZE           8U
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef bool (*SYS_FLASHLOG_IS_QUIET)( void );
+
+typedef struct
+{
+    /* Row aligned start of the reserved region */
+    uint32_t                startAddress;
+
+    /* Size of the region, a multiple of the row size */
+    uint32_t                size;
+
+    /* Size of one record, at most a page minus the page header */
+    uint8_t                 recordSize;
+
+    /* Returns true while flash operations may stall the CPU, NULL if they
+       always may */
+    SYS_FLASHLOG_IS_QUIET   isQuiet;
+
+} SYS_FLASHLOG_INIT;
+
+typedef struct
+{
+    uint32_t recordsAppended;
+
+    /* Records refused because both page buffers were waiting for the flash */
+    uint32_t recordsDropped;
+
+    /* Records lost because their row was erased before they were drained */
+    uint32_t recordsOverwritten;
+
+    uint32_t pageWrites;
+
+    uint32_t rowErases;
+
+    uint32_t flashErrors;
+
+    /* Pages holding records that have not been drained */
+    uint32_t pagesUsed;
+
+    uint32_t pagesTotal;
+
+} SYS_FLASHLOG_STATISTICS;
+
+// *****************************************************************************
+/* Flash Log Iterator
+
+  Summary:
+    Position of a reader in the log.
+
+  Description:
+    Initialized at the oldest record by SYS_FLASHLOG_IteratorInit. The fields
+    are private to the service.
+
+  Remarks:
+    Records appended after the iterator was initialized are not visited.
+*/
+
+typedef struct
+{
+    uint32_t    page;
+
+    uint32_t    pagesLeft;
+
+    /* Pages written after the iterator was initialized are not visited */
+    uint32_t    sequenceEnd;
+
+    uint8_t     record;
+
+} SYS_FLASHLOG_ITERATOR;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_FLASHLOG_Initialize( const SYS_FLASHLOG_INIT * const init )
+
+  Summary:
+    Checks the log region and registers the "flog" command group.
+
+  Description:
+    The log is mounted by the first SYS_FLASHLOG_Tasks call, which reads
+    every page header of the region to find the newest and oldest pages and
+    the erased space after the newest one. Records from earlier runs are
+    kept and visited by the iterator.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    init - Initialization data, must stay valid
+
+  Returns:
+    true if the region is valid and the command group registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_FLASHLOG_Initialize( const SYS_FLASHLOG_INIT * const init );
+
+// *****************************************************************************
+/* Function:
+    void SYS_FLASHLOG_Tasks( void )
+
+  Summary:
+    Writes full pages and erases rows ahead of the write position.
+
+  Description:
+    Starts at most one flash operation per call and returns without waiting
+    for it.
+
+  Precondition:
+    SYS_FLASHLOG_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_FLASHLOG_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_FLASHLOG_IsIdle( void )
+
+  Summary:
+    Returns false while a flash operation is running or may be started.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_FLASHLOG_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if SYS_FLASHLOG_Tasks has nothing to do right now.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_FLASHLOG_IsIdle( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_FLASHLOG_Append( const void * record )
+
+  Summary:
+    Adds a record to the page being filled in RAM.
+
+  Description:
+    Never touches the flash. The page is written by SYS_FLASHLOG_Tasks once
+    it is full or SYS_FLASHLOG_Flush was called.
+
+  Precondition:
+    SYS_FLASHLOG_Initialize must have been called.
+
+  Parameters:
+    record - recordSize bytes
+
+  Returns:
+    false if the record was dropped because the page buffers are full or
+    the log is not mounted yet.
+
+  Remarks:
+    Call from task context only.
+*/
+
+bool SYS_FLASHLOG_Append( const void * record );
+
+// *****************************************************************************
+/* Function:
+    void SYS_FLASHLOG_Flush( void )
+
+  Summary:
+    Queues the partially filled page for writing.
+
+  Description:
+    Use when no records are expected for a while, for example at the end of
+    a measurement window, so that they survive a reset.
+
+  Precondition:
+    SYS_FLASHLOG_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Every flush uses a whole flash page.
+*/
+
+void SYS_FLASHLOG_Flush( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_FLASHLOG_IteratorInit( SYS_FLASHLOG_ITERATOR * iterator )
+
+  Summary:
+    Positions an iterator at the oldest record in flash.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_FLASHLOG_Initialize must have been called.
+
+  Parameters:
+    iterator - Iterator to initialize
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_FLASHLOG_IteratorInit( SYS_FLASHLOG_ITERATOR * iterator );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_FLASHLOG_IteratorNext( SYS_FLASHLOG_ITERATOR * iterator, void * record )
+
+  Summary:
+    Copies the next record and advances the iterator.
+
+  Description:
+    Pages that fail their checksum are skipped.
+
+  Precondition:
+    The iterator was initialized with SYS_FLASHLOG_IteratorInit.
+
+  Parameters:
+    iterator - Reader position
+    record   - Receives recordSize bytes
+
+  Returns:
+    false once all records have been visited.
+
+  Remarks:
+    Rows the service erased or rewrote since the iterator was initialized
+    are skipped.
+*/
+
+bool SYS_FLASHLOG_IteratorNext( SYS_FLASHLOG_ITERATOR * iterator, void * record );
+
+// *****************************************************************************
+/* Function:
+    void SYS_FLASHLOG_Consume( const SYS_FLASHLOG_ITERATOR * iterator )
+
+  Summary:
+    Releases all pages the iterator has completely visited.
+
+  Description:
+    The released rows are erased in the background. Records of a page that
+    was only partly visited are kept.
+
+  Precondition:
+    The iterator was initialized with SYS_FLASHLOG_IteratorInit.
+
+  Parameters:
+    iterator - Reader position
+
+  Returns:
+    None.
+
+  Remarks:
+    Released pages that have not been erased yet are visited again after a
+    reset.
+*/
+
+void SYS_FLASHLOG_Consume( const SYS_FLASHLOG_ITERATOR * iterator );
+
+void SYS_FLASHLOG_StatisticsGet( SYS_FLASHLOG_STATISTICS * stats );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_FLASHLOG_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,418 @@
+/*******************************************************************************
+  Formatted Output System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_fmt.c
+
+  Summary:
+    Integer only string formatting.
+
+  Description:
+    This file contains the source code of the integer only formatter used in
+    place of vsnprintf by the console and command services.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "system/fmt/sys_fmt.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    char *      buffer;
+
+    size_t      size;
+
+    /* Characters produced so far, including the ones that did not fit */
+    size_t      length;
+
+} SYS_FMT_OUTPUT;
+
+/* Digits of a 32 bit value in base 10 or 16 */
+#define SYS_FMT_DIGITS_MAX      (12U)
+
+/* Two decimal digits per division, halves the divisions of a conversion */
+static const char sysFmtDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void _SYS_FMT_Put(SYS_FMT_OUTPUT *out, char c)
+{
+    if ((out->length + 1U) < out->size)
+    {
+        out->buffer[out->length] = c;
+    }
+
+    out->length++;
+}
+
+/* Room left before the terminating zero */
+static size_t _SYS_FMT_Room(const SYS_FMT_OUTPUT *out, size_t len)
+{
+    size_t room = ((out->length + 1U) < out->size) ? (out->size - 1U - out->length) : 0U;
+
+    return (len < room) ? len : room;
+}
+
+/* Byte loops, the runs are a few characters long, shorter than what a
+ * memcpy call pays off for */
+static void _SYS_FMT_Write(SYS_FMT_OUTPUT *out, const char *str, size_t len)
+{
+    size_t n = _SYS_FMT_Room(out, len);
+    char *dst;
+    size_t i;
+
+    if (n > 0U)
+    {
+        dst = &out->buffer[out->length];
+        for (i = 0U; i < n; i++)
+        {
+            dst[i] = str[i];
+        }
+    }
+
+    out->length += len;
+}
+
+static void _SYS_FMT_Pad(SYS_FMT_OUTPUT *out, char c, uint32_t count)
+{
+    size_t n = _SYS_FMT_Room(out, count);
+    char *dst;
+    size_t i;
+
+    if (n > 0U)
+    {
+        dst = &out->buffer[out->length];
+        for (i = 0U; i < n; i++)
+        {
+            dst[i] = c;
+        }
+    }
+
+    out->length += count;
+}
+
+static void _SYS_FMT_Field(SYS_FMT_OUTPUT *out, const char *str, uint32_t len, uint32_t width, bool leftAlign)
+{
+    uint32_t padding = (width > len) ? (width - len) : 0U;
+
+    if (leftAlign == false)
+    {
+        _SYS_FMT_Pad(out, ' ', padding);
+    }
+
+    _SYS_FMT_Write(out, str, len);
+
+    if (leftAlign == true)
+    {
+        _SYS_FMT_Pad(out, ' ', padding);
+    }
+}
+
+/* Writes the digits right aligned at the end of text, returns their count */
+static uint32_t _SYS_FMT_Digits(char *text, uint32_t value, uint32_t base, bool upper)
+{
+    const char *digits = (upper == true) ? "0123456789ABCDEF" : "0123456789abcdef";
+    uint32_t pos = SYS_FMT_DIGITS_MAX;
+    uint32_t pair;
+
+    if (base == 16U)
+    {
+        do
+        {
+            pos--;
+            text[pos] = digits[value & 0xFU];
+            value = value >> 4;
+        } while (value != 0U);
+    }
+    else
+    {
+        while (value >= 100U)
+        {
+            pair = (value % 100U) * 2U;
+            value = value / 100U;
+            pos -= 2U;
+            text[pos] = sysFmtDigitPairs[pair];
+            text[pos + 1U] = sysFmtDigitPairs[pair + 1U];
+        }
+
+        if (value >= 10U)
+        {
+            pos -= 2U;
+            text[pos] = sysFmtDigitPairs[value * 2U];
+            text[pos + 1U] = sysFmtDigitPairs[(value * 2U) + 1U];
+        }
+        else
+        {
+            pos--;
+            text[pos] = (char)('0' + value);
+        }
+    }
+
+    return SYS_FMT_DIGITS_MAX - pos;
+}
+
+static void _SYS_FMT_Number(SYS_FMT_OUTPUT *out, uint32_t value, bool negative, uint32_t base, bool upper,
+                            uint32_t width, bool leftAlign, bool zeroPad)
+{
+    char text[SYS_FMT_DIGITS_MAX];
+    uint32_t len = _SYS_FMT_Digits(text, value, base, upper);
+    uint32_t signLen = (negative == true) ? 1U : 0U;
+    uint32_t padding;
+
+    /* No field width, the common case of the console messages */
+    if (width <= (len + signLen))
+    {
+        if (negative == true)
+        {
+            _SYS_FMT_Put(out, '-');
+        }
+        _SYS_FMT_Write(out, &text[SYS_FMT_DIGITS_MAX - len], len);
+        return;
+    }
+
+    padding = width - len - signLen;
+
+    if ((leftAlign == false) && (zeroPad == false))
+    {
+        _SYS_FMT_Pad(out, ' ', padding);
+    }
+
+    if (negative == true)
+    {
+        _SYS_FMT_Put(out, '-');
+    }
+
+    if ((leftAlign == false) && (zeroPad == true))
+    {
+        _SYS_FMT_Pad(out, '0', padding);
+    }
+
+    _SYS_FMT_Write(out, &text[SYS_FMT_DIGITS_MAX - len], len);
+
+    if (leftAlign == true)
+    {
+        _SYS_FMT_Pad(out, ' ', padding);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+size_t SYS_FMT_Vsnprintf( char * buffer, size_t size, const char * format, va_list args )
+{
+    SYS_FMT_OUTPUT out = { buffer, size, 0U };
+    const char *spec;
+    const char *str;
+    uint32_t width;
+    uint32_t len;
+    uint32_t uvalue;
+    int32_t svalue;
+    bool leftAlign;
+    bool zeroPad;
+    bool isLong;
+    char c;
+
+    while (*format != '\0')
+    {
+        /* Plain text up to the next specification in one copy */
+        if (*format != '%')
+        {
+            for (len = 1U; (format[len] != '%') && (format[len] != '\0'); len++)
+            {
+            }
+            _SYS_FMT_Write(&out, format, len);
+            format += len;
+            continue;
+        }
+
+        spec = format;
+        format++;
+
+        /* Flags */
+        leftAlign = false;
+        zeroPad = false;
+        while ((*format == '-') || (*format == '0'))
+        {
+            if (*format == '-')
+            {
+                leftAlign = true;
+            }
+            else
+            {
+                zeroPad = true;
+            }
+            format++;
+        }
+
+        /* Field width */
+        width = 0;
+        if (*format == '*')
+        {
+            svalue = va_arg(args, int);
+            if (svalue < 0)
+            {
+                leftAlign = true;
+                svalue = -svalue;
+            }
+            width = (uint32_t)svalue;
+            format++;
+        }
+        else
+        {
+            while ((*format >= '0') && (*format <= '9'))
+            {
+                width = (width * 10U) + (uint32_t)(*format - '0');
+                format++;
+            }
+        }
+
+        /* Length modifiers. Values are formatted as 32 bit, short types are
+         * promoted to int when passed */
+        isLong = false;
+        while ((*format == 'h') || (*format == 'l') || (*format == 'z'))
+        {
+            isLong = isLong || (*format != 'h');
+            format++;
+        }
+
+        switch (*format)
+        {
+            case 'd':
+            case 'i':
+                svalue = (isLong == true) ? (int32_t)va_arg(args, long) : (int32_t)va_arg(args, int);
+                uvalue = (svalue < 0) ? (0U - (uint32_t)svalue) : (uint32_t)svalue;
+                _SYS_FMT_Number(&out, uvalue, (svalue < 0), 10U, false, width, leftAlign, zeroPad);
+                break;
+
+            case 'u':
+                uvalue = (isLong == true) ? (uint32_t)va_arg(args, unsigned long) : (uint32_t)va_arg(args, unsigned int);
+                _SYS_FMT_Number(&out, uvalue, false, 10U, false, width, leftAlign, zeroPad);
+                break;
+
+            case 'x':
+            case 'X':
+                uvalue = (isLong == true) ? (uint32_t)va_arg(args, unsigned long) : (uint32_t)va_arg(args, unsigned int);
+                _SYS_FMT_Number(&out, uvalue, false, 16U, (*format == 'X'), width, leftAlign, zeroPad);
+                break;
+
+            case 'p':
+                _SYS_FMT_Put(&out, '0');
+                _SYS_FMT_Put(&out, 'x');
+                _SYS_FMT_Number(&out, (uint32_t)(uintptr_t)va_arg(args, void *), false, 16U, false, 0U, false, false);
+                break;
+
+            case 'c':
+                c = (char)va_arg(args, int);
+                _SYS_FMT_Field(&out, &c, 1U, width, leftAlign);
+                break;
+
+            case 's':
+                str = va_arg(args, const char *);
+                if (str == NULL)
+                {
+                    str = "(null)";
+                }
+                for (len = 0; str[len] != '\0'; len++)
+                {
+                }
+                _SYS_FMT_Field(&out, str, len, width, leftAlign);
+                break;
+
+            case '%':
+                _SYS_FMT_Put(&out, '%');
+                break;
+
+            default:
+                /* Not supported, copy the specification as it is */
+                while (spec < format)
+                {
+                    _SYS_FMT_Put(&out, *spec);
+                    spec++;
+                }
+                if (*format == '\0')
+                {
+                    continue;
+                }
+                _SYS_FMT_Put(&out, *format);
+                break;
+        }
+
+        format++;
+    }
+
+    if (size > 0U)
+    {
+        buffer[(out.length < size) ? out.length : (size - 1U)] = '\0';
+    }
+
+    return out.length;
+}
+
+size_t SYS_FMT_Snprintf( char * buffer, size_t size, const char * format, ... )
+{
+    size_t len;
+    va_list args;
+
+    va_start(args, format);
+    len = SYS_FMT_Vsnprintf(buffer, size, format, args);
+    va_end(args);
+
+    return len;
+}
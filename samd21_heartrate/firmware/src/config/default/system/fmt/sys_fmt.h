@@ -0,0 +1,137 @@
+/*******************************************************************************
+  Formatted Output System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_fmt.h
+
+  Summary:
+    Integer only string formatting.
+
+  Description:
+    This file contains the interface definition of a small replacement for
+    vsnprintf used by the console and command services. It supports the
+    conversions %d %i %u %x %X %c %s %p and %%, the flags '-' and '0', a
+    field width given as a number or '*', and the length modifiers h, hh, l
+    and z. Floating point conversions are not supported. No heap is used.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_FMT_H
+#define SYS_FMT_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <stdarg.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    size_t SYS_FMT_Vsnprintf( char * buffer, size_t size, const char * format, va_list args )
+
+  Summary:
+    Formats a string into a buffer.
+
+  Description:
+    Writes at most size - 1 characters followed by a terminating zero.
+    Unsupported conversion specifications are copied to the output unchanged.
+
+  Precondition:
+    None.
+
+  Parameters:
+    buffer - Output buffer, may be NULL if size is 0
+    size   - Size of the output buffer in bytes
+    format - printf style format string
+    args   - Arguments
+
+  Returns:
+    The length of the complete formatted string, not counting the
+    terminating zero. The output was truncated if this is size or larger.
+
+  Remarks:
+    None.
+*/
+
+size_t SYS_FMT_Vsnprintf( char * buffer, size_t size, const char * format, va_list args );
+
+// *****************************************************************************
+/* Function:
+    size_t SYS_FMT_Snprintf( char * buffer, size_t size, const char * format, ... )
+
+  Summary:
+    Variable argument version of SYS_FMT_Vsnprintf.
+
+  Description:
+    None.
+
+  Precondition:
+    None.
+
+  Parameters:
+    See SYS_FMT_Vsnprintf.
+
+  Returns:
+    See SYS_FMT_Vsnprintf.
+
+  Remarks:
+    None.
+*/
+
+size_t SYS_FMT_Snprintf( char * buffer, size_t size, const char * format, ... );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_FMT_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,375 @@
+/*******************************************************************************
+  Heart Rate Series Codec Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_hrcodec.c
+
+  Summary:
+    Streaming compression of timestamped heart rate series.
+
+  Description:
+    This file contains the source code of the block encoder and decoder.
+    See sys_hrcodec.h for the block layout.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "system/hrcodec/sys_hrcodec.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_HRCODEC_TOKEN_RUN           0U
+#define SYS_HRCODEC_TOKEN_VALUE         1U
+#define SYS_HRCODEC_TOKEN_DELTA         2U
+#define SYS_HRCODEC_TOKEN_ESCAPE        3U
+#define SYS_HRCODEC_TOKEN_MASK          3U
+
+/* Largest argument that fits a 32 bit token next to the tag */
+#define SYS_HRCODEC_ARGUMENT_MAX        0x3FFFFFFFUL
+
+#define SYS_HRCODEC_VARINT_SIZE_MAX     5U
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t _SYS_HRCODEC_ZigZag(uint32_t value)
+{
+    return (value << 1) ^ (((value & 0x80000000UL) != 0U) ? 0xFFFFFFFFUL : 0U);
+}
+
+static uint32_t _SYS_HRCODEC_UnZigZag(uint32_t value)
+{
+    return (value >> 1) ^ (((value & 1U) != 0U) ? 0xFFFFFFFFUL : 0U);
+}
+
+static size_t _SYS_HRCODEC_VarintPut(uint8_t *out, uint32_t value)
+{
+    size_t n = 0U;
+
+    while (value >= 0x80U)
+    {
+        out[n++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+
+    return n;
+}
+
+static size_t _SYS_HRCODEC_VarintSize(uint32_t value)
+{
+    size_t n = 1U;
+
+    while (value >= 0x80U)
+    {
+        value >>= 7;
+        n++;
+    }
+
+    return n;
+}
+
+static bool _SYS_HRCODEC_VarintGet(SYS_HRCODEC_DECODER *decoder, uint32_t *value)
+{
+    uint32_t result = 0U;
+    uint32_t shift = 0U;
+    uint8_t byte;
+
+    do
+    {
+        if ((decoder->offset >= decoder->size) || (shift > 28U))
+        {
+            return false;
+        }
+        byte = decoder->block[decoder->offset++];
+        result |= (uint32_t)(byte & 0x7FU) << shift;
+        shift += 7U;
+    } while ((byte & 0x80U) != 0U);
+
+    *value = result;
+
+    return true;
+}
+
+/* Size of the token describing a run of the given length */
+static size_t _SYS_HRCODEC_RunSize(uint16_t run)
+{
+    return (run == 0U) ? 0U : _SYS_HRCODEC_VarintSize(((uint32_t)run - 1U) << 2);
+}
+
+static void _SYS_HRCODEC_RunWrite(SYS_HRCODEC_ENCODER *encoder)
+{
+    if (encoder->run != 0U)
+    {
+        encoder->length += _SYS_HRCODEC_VarintPut(&encoder->block[encoder->length],
+            (((uint32_t)encoder->run - 1U) << 2) | SYS_HRCODEC_TOKEN_RUN);
+        encoder->run = 0U;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_HRCODEC_EncoderInit( SYS_HRCODEC_ENCODER * encoder, uint8_t * block, size_t capacity )
+{
+    (void)memset(encoder, 0, sizeof(*encoder));
+
+    encoder->block = block;
+    encoder->capacity = capacity;
+    encoder->length = SYS_HRCODEC_BLOCK_HEADER_SIZE;
+}
+
+bool SYS_HRCODEC_EncoderPut( SYS_HRCODEC_ENCODER * encoder, const SYS_HRCODEC_SAMPLE * sample )
+{
+    uint8_t token[SYS_HRCODEC_SAMPLE_SIZE_MAX];
+    uint32_t delta;
+    uint32_t deltaChange;
+    uint32_t valueChange;
+    size_t n;
+
+    if (encoder->count == 0U)
+    {
+        n = _SYS_HRCODEC_VarintPut(token, _SYS_HRCODEC_ZigZag((uint32_t)sample->value));
+        if ((encoder->length + n) > encoder->capacity)
+        {
+            return false;
+        }
+        (void)memcpy(&encoder->block[encoder->length], token, n);
+        encoder->length += n;
+
+        encoder->block[2] = (uint8_t)sample->timestamp;
+        encoder->block[3] = (uint8_t)(sample->timestamp >> 8);
+        encoder->block[4] = (uint8_t)(sample->timestamp >> 16);
+        encoder->block[5] = (uint8_t)(sample->timestamp >> 24);
+    }
+    else if (encoder->count == SYS_HRCODEC_BLOCK_SAMPLES_MAX)
+    {
+        return false;
+    }
+    else
+    {
+        delta = sample->timestamp - encoder->timestamp;
+        deltaChange = _SYS_HRCODEC_ZigZag(delta - encoder->delta);
+        valueChange = _SYS_HRCODEC_ZigZag((uint32_t)sample->value - (uint32_t)encoder->value);
+
+        if ((deltaChange == 0U) && (valueChange == 0U))
+        {
+            /* Only the run token grows, and only now and then */
+            if ((encoder->length + _SYS_HRCODEC_RunSize(encoder->run + 1U)) > encoder->capacity)
+            {
+                return false;
+            }
+            encoder->run++;
+        }
+        else
+        {
+            if ((deltaChange == 0U) && (valueChange <= SYS_HRCODEC_ARGUMENT_MAX))
+            {
+                n = _SYS_HRCODEC_VarintPut(token, (valueChange << 2) | SYS_HRCODEC_TOKEN_VALUE);
+            }
+            else if (deltaChange <= SYS_HRCODEC_ARGUMENT_MAX)
+            {
+                n = _SYS_HRCODEC_VarintPut(token, (deltaChange << 2) | SYS_HRCODEC_TOKEN_DELTA);
+                n += _SYS_HRCODEC_VarintPut(&token[n], valueChange);
+            }
+            else
+            {
+                token[0] = SYS_HRCODEC_TOKEN_ESCAPE;
+                n = 1U;
+                n += _SYS_HRCODEC_VarintPut(&token[n], deltaChange);
+                n += _SYS_HRCODEC_VarintPut(&token[n], valueChange);
+            }
+
+            if ((encoder->length + _SYS_HRCODEC_RunSize(encoder->run) + n) > encoder->capacity)
+            {
+                return false;
+            }
+            _SYS_HRCODEC_RunWrite(encoder);
+            (void)memcpy(&encoder->block[encoder->length], token, n);
+            encoder->length += n;
+        }
+
+        encoder->delta = delta;
+    }
+
+    encoder->timestamp = sample->timestamp;
+    encoder->value = sample->value;
+    encoder->count++;
+
+    return true;
+}
+
+size_t SYS_HRCODEC_EncoderFinish( SYS_HRCODEC_ENCODER * encoder )
+{
+    if (encoder->count == 0U)
+    {
+        return 0U;
+    }
+
+    _SYS_HRCODEC_RunWrite(encoder);
+
+    encoder->block[0] = (uint8_t)encoder->count;
+    encoder->block[1] = (uint8_t)(encoder->count >> 8);
+
+    return encoder->length;
+}
+
+bool SYS_HRCODEC_DecoderInit( SYS_HRCODEC_DECODER * decoder, const uint8_t * block, size_t size )
+{
+    (void)memset(decoder, 0, sizeof(*decoder));
+
+    if (size < SYS_HRCODEC_BLOCK_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    decoder->block = block;
+    decoder->size = size;
+    decoder->offset = SYS_HRCODEC_BLOCK_HEADER_SIZE;
+    decoder->remaining = SYS_HRCODEC_BlockCount(block);
+    decoder->timestamp = SYS_HRCODEC_BlockTimestamp(block);
+
+    return true;
+}
+
+SYS_HRCODEC_DECODE_STATUS SYS_HRCODEC_DecoderGet( SYS_HRCODEC_DECODER * decoder, SYS_HRCODEC_SAMPLE * sample )
+{
+    uint32_t token;
+    uint32_t valueChange = 0U;
+
+    if (decoder->remaining == 0U)
+    {
+        return SYS_HRCODEC_DECODE_END;
+    }
+
+    if (decoder->offset == SYS_HRCODEC_BLOCK_HEADER_SIZE)
+    {
+        /* First sample, the timestamp comes from the header */
+        if (!_SYS_HRCODEC_VarintGet(decoder, &token))
+        {
+            decoder->remaining = 0U;
+            return SYS_HRCODEC_DECODE_ERROR;
+        }
+        decoder->value = (int32_t)_SYS_HRCODEC_UnZigZag(token);
+    }
+    else
+    {
+        if (decoder->run != 0U)
+        {
+            decoder->run--;
+        }
+        else
+        {
+            if (!_SYS_HRCODEC_VarintGet(decoder, &token))
+            {
+                decoder->remaining = 0U;
+                return SYS_HRCODEC_DECODE_ERROR;
+            }
+
+            switch (token & SYS_HRCODEC_TOKEN_MASK)
+            {
+                case SYS_HRCODEC_TOKEN_RUN:
+                    /* This sample is the first of the run */
+                    if ((token >> 2) >= decoder->remaining)
+                    {
+                        decoder->remaining = 0U;
+                        return SYS_HRCODEC_DECODE_ERROR;
+                    }
+                    decoder->run = (uint16_t)(token >> 2);
+                    break;
+
+                case SYS_HRCODEC_TOKEN_VALUE:
+                    valueChange = token >> 2;
+                    break;
+
+                case SYS_HRCODEC_TOKEN_DELTA:
+                    decoder->delta += _SYS_HRCODEC_UnZigZag(token >> 2);
+                    if (!_SYS_HRCODEC_VarintGet(decoder, &valueChange))
+                    {
+                        decoder->remaining = 0U;
+                        return SYS_HRCODEC_DECODE_ERROR;
+                    }
+                    break;
+
+                default:
+                    if ((token != SYS_HRCODEC_TOKEN_ESCAPE)
+                        || !_SYS_HRCODEC_VarintGet(decoder, &token)
+                        || !_SYS_HRCODEC_VarintGet(decoder, &valueChange))
+                    {
+                        decoder->remaining = 0U;
+                        return SYS_HRCODEC_DECODE_ERROR;
+                    }
+                    decoder->delta += _SYS_HRCODEC_UnZigZag(token);
+                    break;
+            }
+        }
+
+        decoder->timestamp += decoder->delta;
+        decoder->value = (int32_t)((uint32_t)decoder->value + _SYS_HRCODEC_UnZigZag(valueChange));
+    }
+
+    decoder->remaining--;
+
+    sample->timestamp = decoder->timestamp;
+    sample->value = decoder->value;
+
+    return SYS_HRCODEC_DECODE_SAMPLE;
+}
+
+uint16_t SYS_HRCODEC_BlockCount( const uint8_t * block )
+{
+    return (uint16_t)((uint16_t)block[0] | ((uint16_t)block[1] << 8));
+}
+
+uint32_t SYS_HRCODEC_BlockTimestamp( const uint8_t * block )
+{
+    return (uint32_t)block[2] | ((uint32_t)block[3] << 8)
+        | ((uint32_t)block[4] << 16) | ((uint32_t)block[5] << 24);
+}
+
+/*******************************************************************************
+ End of File
+*/
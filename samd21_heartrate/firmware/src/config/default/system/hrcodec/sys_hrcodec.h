@@ -0,0 +1,389 @@
+/*******************************************************************************
+  Heart Rate Series Codec Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_hrcodec.h
+
+  Summary:
+    Streaming compression of timestamped heart rate series.
+
+  Description:
+    This file contains the interface definition of a block codec for slowly
+    changing sample series. Timestamps are stored as delta of delta, values
+    as zigzag varint deltas and runs of identical samples as a single
+    token. Every block starts with a fixed header holding the sample count
+    and the first timestamp, so a block can be located by time and decoded
+    without the blocks before it. Blocks are built in a buffer owned by the
+    caller, which stores or sends them as it likes.
+
+    Block layout, all fields little endian:
+
+        count(2) timestamp(4) value(varint) tokens...
+
+    Each later sample is described by a varint token whose two low bits
+    select its meaning, the remaining bits hold the argument:
+
+        0  argument + 1 repeats of the previous sample, same interval
+        1  same interval, value changed by zigzag(argument)
+        2  interval changed by zigzag(argument), value delta follows as a
+           zigzag varint
+        3  interval change and value delta follow as zigzag varints
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_HRCODEC_H
+#define SYS_HRCODEC_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+/* Block header: sample count (2 bytes) and first timestamp (4 bytes),
+   little endian */
+#define SYS_HRCODEC_BLOCK_HEADER_SIZE       6U
+
+/* Largest encoding of one sample, a block of this many bytes after the
+   header always accepts at least one sample */
+#define SYS_HRCODEC_SAMPLE_SIZE_MAX         11U
+
+#define SYS_HRCODEC_BLOCK_SAMPLES_MAX       0xFFFFU
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    uint32_t timestamp;
+
+    int32_t value;
+
+} SYS_HRCODEC_SAMPLE;
+
+// *****************************************************************************
+/* Encoder State
+
+  Summary:
+    State of a block being built.
+
+  Description:
+    Managed by the SYS_HRCODEC_Encoder routines, the fields are not meant to
+    be accessed by the caller.
+
+  Remarks:
+    Repeated samples are counted in run and only written when the run ends
+    or the block is finished.
+ */
+
+typedef struct
+{
+    uint8_t *   block;
+
+    size_t      capacity;
+
+    /* Bytes written, header included */
+    size_t      length;
+
+    uint16_t    count;
+
+    /* Pending repeats of the previous sample */
+    uint16_t    run;
+
+    uint32_t    timestamp;
+
+    uint32_t    delta;
+
+    int32_t     value;
+
+} SYS_HRCODEC_ENCODER;
+
+typedef struct
+{
+    const uint8_t * block;
+
+    size_t          size;
+
+    size_t          offset;
+
+    /* Samples left in the block */
+    uint16_t        remaining;
+
+    /* Repeats of the previous sample still to be returned */
+    uint16_t        run;
+
+    uint32_t        timestamp;
+
+    uint32_t        delta;
+
+    int32_t         value;
+
+} SYS_HRCODEC_DECODER;
+
+typedef enum
+{
+    /* A sample was returned */
+    SYS_HRCODEC_DECODE_SAMPLE = 0,
+
+    /* All the samples of the block were returned */
+    SYS_HRCODEC_DECODE_END,
+
+    /* The block is truncated or does not hold an encoded series */
+    SYS_HRCODEC_DECODE_ERROR,
+
+} SYS_HRCODEC_DECODE_STATUS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    void SYS_HRCODEC_EncoderInit( SYS_HRCODEC_ENCODER * encoder, uint8_t * block, size_t capacity )
+
+  Summary:
+    Starts a new, empty block.
+
+  Description:
+    The block is built in place in the buffer given, which must stay valid
+    until SYS_HRCODEC_EncoderFinish is called.
+
+  Precondition:
+    None.
+
+  Parameters:
+    encoder  - Encoder state
+    block    - Block buffer
+    capacity - Size of the buffer in bytes, at least
+               SYS_HRCODEC_BLOCK_HEADER_SIZE + SYS_HRCODEC_SAMPLE_SIZE_MAX
+
+  Returns:
+    None.
+
+  Remarks:
+    The same buffer may be passed again once the finished block was stored.
+*/
+
+void SYS_HRCODEC_EncoderInit( SYS_HRCODEC_ENCODER * encoder, uint8_t * block, size_t capacity );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_HRCODEC_EncoderPut( SYS_HRCODEC_ENCODER * encoder, const SYS_HRCODEC_SAMPLE * sample )
+
+  Summary:
+    Adds a sample to the block.
+
+  Description:
+    Timestamps are expected to increase, wrap around of the 32 bit counter
+    is handled.
+
+  Precondition:
+    SYS_HRCODEC_EncoderInit was called.
+
+  Parameters:
+    encoder - Encoder state
+    sample  - Sample to add
+
+  Returns:
+    true if the sample was added, false if the block is full. The sample is
+    not consumed in that case, finish the block, start a new one and add
+    the sample again.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_HRCODEC_EncoderPut( SYS_HRCODEC_ENCODER * encoder, const SYS_HRCODEC_SAMPLE * sample );
+
+// *****************************************************************************
+/* Function:
+    size_t SYS_HRCODEC_EncoderFinish( SYS_HRCODEC_ENCODER * encoder )
+
+  Summary:
+    Completes the block.
+
+  Description:
+    Writes the pending run and the block header.
+
+  Precondition:
+    SYS_HRCODEC_EncoderInit was called.
+
+  Parameters:
+    encoder - Encoder state
+
+  Returns:
+    Length of the block in bytes, 0 if no sample was added.
+
+  Remarks:
+    Bytes of the buffer past the returned length are left unchanged, the
+    decoder stops after the number of samples in the header.
+*/
+
+size_t SYS_HRCODEC_EncoderFinish( SYS_HRCODEC_ENCODER * encoder );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_HRCODEC_DecoderInit( SYS_HRCODEC_DECODER * decoder, const uint8_t * block, size_t size )
+
+  Summary:
+    Prepares the decoding of a block.
+
+  Description:
+    None.
+
+  Precondition:
+    None.
+
+  Parameters:
+    decoder - Decoder state
+    block   - Block as returned by the encoder
+    size    - Bytes available at block, may include padding
+
+  Returns:
+    false if size is smaller than the block header.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_HRCODEC_DecoderInit( SYS_HRCODEC_DECODER * decoder, const uint8_t * block, size_t size );
+
+// *****************************************************************************
+/* Function:
+    SYS_HRCODEC_DECODE_STATUS SYS_HRCODEC_DecoderGet( SYS_HRCODEC_DECODER * decoder, SYS_HRCODEC_SAMPLE * sample )
+
+  Summary:
+    Returns the next sample of the block.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_HRCODEC_DecoderInit returned true.
+
+  Parameters:
+    decoder - Decoder state
+    sample  - Receives the sample
+
+  Returns:
+    See SYS_HRCODEC_DECODE_STATUS.
+
+  Remarks:
+    After an error the remaining samples of the block are lost, the next
+    block decodes normally.
+*/
+
+SYS_HRCODEC_DECODE_STATUS SYS_HRCODEC_DecoderGet( SYS_HRCODEC_DECODER * decoder, SYS_HRCODEC_SAMPLE * sample );
+
+// *****************************************************************************
+/* Function:
+    uint16_t SYS_HRCODEC_BlockCount( const uint8_t * block )
+
+  Summary:
+    Returns the number of samples in a block.
+
+  Description:
+    Reads the block header only.
+
+  Precondition:
+    None.
+
+  Parameters:
+    block - Block, at least SYS_HRCODEC_BLOCK_HEADER_SIZE bytes
+
+  Returns:
+    Sample count.
+
+  Remarks:
+    None.
+*/
+
+uint16_t SYS_HRCODEC_BlockCount( const uint8_t * block );
+
+// *****************************************************************************
+/* Function:
+    uint32_t SYS_HRCODEC_BlockTimestamp( const uint8_t * block )
+
+  Summary:
+    Returns the timestamp of the first sample of a block.
+
+  Description:
+    Reads the block header only. Used to find the block holding a given
+    time without decoding the blocks before it.
+
+  Precondition:
+    None.
+
+  Parameters:
+    block - Block, at least SYS_HRCODEC_BLOCK_HEADER_SIZE bytes
+
+  Returns:
+    First timestamp.
+
+  Remarks:
+    None.
+*/
+
+uint32_t SYS_HRCODEC_BlockTimestamp( const uint8_t * block );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_HRCODEC_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,249 @@
+/*******************************************************************************
+  Log System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_log.c
+
+  Summary:
+    Log System Service implementation.
+
+  Description:
+    This file contains the source code for the log system service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdarg.h>
+#include <string.h>
+#include "configuration.h"
+#include "system/log/sys_log.h"
+#include "system/fmt/sys_fmt.h"
+#include "system/console/sys_console.h"
+#include "system/command/sys_command.h"
+#include "osal/osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+uint8_t gSysLogThreshold[SYS_LOG_MODULE_MAX];
+
+static char gSysLogBuffer[SYS_LOG_BUFFER_SIZE];
+
+static OSAL_MUTEX_DECLARE(gSysLogBufferMutex);
+
+static const char * const gSysLogModuleNames[SYS_LOG_MODULE_MAX] =
+{
+    "app",
+    "hr",
+};
+
+static const char * const gSysLogLevelNames[SYS_LOG_LEVEL_DEBUG + 1] =
+{
+    "none",
+    "error",
+    "warn",
+    "info",
+    "debug",
+};
+
+/* Message prefix, one character per level */
+static const char gSysLogLevelTags[SYS_LOG_LEVEL_DEBUG + 1] = { '-', 'E', 'W', 'I', 'D' };
+
+static void _SYS_LOG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysLogCmdTbl[] =
+{
+    {"log", _SYS_LOG_Command, ": show levels, 'log <module|all> <none|error|warn|info|debug>' sets one"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static bool _SYS_LOG_NameFind(const char * const * names, uint32_t count, const char *name, uint32_t *index)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if (strcmp(names[i], name) == 0)
+        {
+            *index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void _SYS_LOG_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    uint32_t module;
+    uint32_t level;
+
+    if (argc == 3)
+    {
+        if (strcmp(argv[1], "all") == 0)
+        {
+            module = (uint32_t)SYS_LOG_MODULE_MAX;
+        }
+        else if (_SYS_LOG_NameFind(gSysLogModuleNames, (uint32_t)SYS_LOG_MODULE_MAX, argv[1], &module) == false)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nunknown module %s\r\n", argv[1]);
+            return;
+        }
+
+        if (_SYS_LOG_NameFind(gSysLogLevelNames, SYS_LOG_LEVEL_DEBUG + 1U, argv[2], &level) == false)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nunknown level %s\r\n", argv[2]);
+            return;
+        }
+
+        SYS_LOG_ThresholdSet((SYS_LOG_MODULE)module, (uint8_t)level);
+    }
+    else if (argc != 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: log [<module|all> <level>]\r\n");
+        return;
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\ncompiled up to %s", gSysLogLevelNames[SYS_LOG_LEVEL_MAX]);
+
+    for (module = 0U; module < (uint32_t)SYS_LOG_MODULE_MAX; module++)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s: %s", gSysLogModuleNames[module], gSysLogLevelNames[gSysLogThreshold[module]]);
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_LOG_Initialize( void )
+{
+    if (OSAL_MUTEX_Create(&gSysLogBufferMutex) != OSAL_RESULT_TRUE)
+    {
+        return false;
+    }
+
+    SYS_LOG_ThresholdSet(SYS_LOG_MODULE_MAX, SYS_LOG_LEVEL_DEFAULT);
+
+    return SYS_CMD_ADDGRP(sysLogCmdTbl, sizeof(sysLogCmdTbl)/sizeof(*sysLogCmdTbl), "log", ": log level commands");
+}
+
+void SYS_LOG_Print( SYS_LOG_MODULE module, uint8_t level, const char * format, ... )
+{
+    va_list args;
+    size_t len;
+
+    if ((module >= SYS_LOG_MODULE_MAX) || (level > SYS_LOG_LEVEL_DEBUG))
+    {
+        return;
+    }
+
+    /* A message from an interrupt that preempts another one is dropped */
+    if (OSAL_MUTEX_Lock(&gSysLogBufferMutex, 0) == OSAL_RESULT_FALSE)
+    {
+        return;
+    }
+
+    len = SYS_FMT_Snprintf(gSysLogBuffer, SYS_LOG_BUFFER_SIZE, "%c %s: ", gSysLogLevelTags[level], gSysLogModuleNames[module]);
+
+    /* Keep room for the line break */
+    if (len < (SYS_LOG_BUFFER_SIZE - 3U))
+    {
+        va_start(args, format);
+        len += SYS_FMT_Vsnprintf(&gSysLogBuffer[len], SYS_LOG_BUFFER_SIZE - 2U - len, format, args);
+        va_end(args);
+    }
+
+    /* Long messages are truncated */
+    if (len > (SYS_LOG_BUFFER_SIZE - 3U))
+    {
+        len = SYS_LOG_BUFFER_SIZE - 3U;
+    }
+
+    gSysLogBuffer[len] = '\r';
+    gSysLogBuffer[len + 1U] = '\n';
+
+    (void)SYS_CONSOLE_Write(SYS_LOG_CONSOLE_INDEX, gSysLogBuffer, len + 2U);
+
+    OSAL_MUTEX_Unlock(&gSysLogBufferMutex);
+}
+
+void SYS_LOG_ThresholdSet( SYS_LOG_MODULE module, uint8_t level )
+{
+    uint32_t i;
+
+    if (level > SYS_LOG_LEVEL_DEBUG)
+    {
+        level = SYS_LOG_LEVEL_DEBUG;
+    }
+
+    if (module < SYS_LOG_MODULE_MAX)
+    {
+        gSysLogThreshold[module] = level;
+        return;
+    }
+
+    for (i = 0U; i < (uint32_t)SYS_LOG_MODULE_MAX; i++)
+    {
+        gSysLogThreshold[i] = level;
+    }
+}
+
+uint8_t SYS_LOG_ThresholdGet( SYS_LOG_MODULE module )
+{
+    if (module >= SYS_LOG_MODULE_MAX)
+    {
+        return SYS_LOG_LEVEL_NONE;
+    }
+
+    return gSysLogThreshold[module];
+}
+
+/*******************************************************************************
+ End of File
+*/
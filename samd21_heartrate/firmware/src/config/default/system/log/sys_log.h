@@ -0,0 +1,260 @@
+/*******************************************************************************
+  Log System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_log.h
+
+  Summary:
+    Leveled log system service interface.
+
+  Description:
+    This file contains the interface definition for the log system service.
+    Messages carry a module and a level. Levels above SYS_LOG_LEVEL_MAX are
+    removed by the preprocessor, the remaining ones are compared against a
+    per-module threshold that is set at run time with the "log" command.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_LOG_H
+#define SYS_LOG_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Log Levels
+
+  Summary:
+    Message levels, from the most to the least important.
+
+  Description:
+    The values match SYS_ERROR_LEVEL from sys_debug.h. They are macros rather
+    than an enumeration so that SYS_LOG_LEVEL_MAX can be tested by the
+    preprocessor. A threshold of SYS_LOG_LEVEL_NONE silences a module.
+
+  Remarks:
+    None.
+*/
+
+#define SYS_LOG_LEVEL_NONE          0
+#define SYS_LOG_LEVEL_ERROR         1
+#define SYS_LOG_LEVEL_WARN          2
+#define SYS_LOG_LEVEL_INFO          3
+#define SYS_LOG_LEVEL_DEBUG         4
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Log Modules
+
+  Summary:
+    Identifies the source of a message.
+
+  Description:
+    Every module has its own run-time threshold.
+
+  Remarks:
+    Add the module name to gSysLogModuleNames in sys_log.c as well.
+*/
+
+typedef enum
+{
+    SYS_LOG_MODULE_APP = 0,
+
+    SYS_LOG_MODULE_HEARTRATE,
+
+    SYS_LOG_MODULE_MAX
+
+} SYS_LOG_MODULE;
+
+// DOM-IGNORE-BEGIN
+/* Do not use this array directly, it is only exposed so that the threshold
+   check is done inline before any argument is evaluated */
+extern uint8_t gSysLogThreshold[SYS_LOG_MODULE_MAX];
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_LOG_Initialize( void )
+
+  Summary:
+    Sets every module to SYS_LOG_LEVEL_DEFAULT and registers the "log"
+    command group.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_CMD_Initialize and SYS_CONSOLE_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_LOG_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_LOG_Print( SYS_LOG_MODULE module, uint8_t level, const char * format, ... )
+
+  Summary:
+    Formats a message and writes it to the log console.
+
+  Description:
+    The message is prefixed with the level and the module name and terminated
+    with a line break. Use the SYS_LOG_ERROR, SYS_LOG_WARN, SYS_LOG_INFO and
+    SYS_LOG_DEBUG macros instead, they apply the compile-time and the run-time
+    filters.
+
+  Precondition:
+    SYS_LOG_Initialize must have been called.
+
+  Parameters:
+    module - Source of the message
+    level  - Message level
+    format - Format string, see SYS_FMT_Vsnprintf for the supported conversions
+    ...    - Format arguments
+
+  Returns:
+    None.
+
+  Remarks:
+    The function does not block. A message is dropped if the log buffer is in
+    use by another context or the console has no room for it.
+*/
+
+void SYS_LOG_Print( SYS_LOG_MODULE module, uint8_t level, const char * format, ... );
+
+// *****************************************************************************
+/* Function:
+    void SYS_LOG_ThresholdSet( SYS_LOG_MODULE module, uint8_t level )
+
+  Summary:
+    Sets the most verbose level printed for a module.
+
+  Description:
+    None.
+
+  Precondition:
+    None.
+
+  Parameters:
+    module - Module to change, SYS_LOG_MODULE_MAX changes all modules
+    level  - SYS_LOG_LEVEL_NONE to SYS_LOG_LEVEL_DEBUG
+
+  Returns:
+    None.
+
+  Remarks:
+    Levels above SYS_LOG_LEVEL_MAX are accepted but print nothing, they were
+    removed at compile time.
+*/
+
+void SYS_LOG_ThresholdSet( SYS_LOG_MODULE module, uint8_t level );
+
+uint8_t SYS_LOG_ThresholdGet( SYS_LOG_MODULE module );
+
+// DOM-IGNORE-BEGIN
+#define _SYS_LOG(module, level, format, ...) \
+    do { if (gSysLogThreshold[(module)] >= (uint8_t)(level)) { SYS_LOG_Print((module), (uint8_t)(level), (format), ##__VA_ARGS__); } } while (0)
+// DOM-IGNORE-END
+
+#if (SYS_LOG_LEVEL_MAX >= SYS_LOG_LEVEL_ERROR)
+#define SYS_LOG_ERROR(module, format, ...)  _SYS_LOG(module, SYS_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#else
+#define SYS_LOG_ERROR(module, format, ...)  do { } while (0)
+#endif
+
+#if (SYS_LOG_LEVEL_MAX >= SYS_LOG_LEVEL_WARN)
+#define SYS_LOG_WARN(module, format, ...)   _SYS_LOG(module, SYS_LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#else
+#define SYS_LOG_WARN(module, format, ...)   do { } while (0)
+#endif
+
+#if (SYS_LOG_LEVEL_MAX >= SYS_LOG_LEVEL_INFO)
+#define SYS_LOG_INFO(module, format, ...)   _SYS_LOG(module, SYS_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#else
+#define SYS_LOG_INFO(module, format, ...)   do { } while (0)
+#endif
+
+#if (SYS_LOG_LEVEL_MAX >= SYS_LOG_LEVEL_DEBUG)
+#define SYS_LOG_DEBUG(module, format, ...)  _SYS_LOG(module, SYS_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#else
+#define SYS_LOG_DEBUG(module, format, ...)  do { } while (0)
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_LOG_H
+
+/*******************************************************************************
+ End of File
+*/
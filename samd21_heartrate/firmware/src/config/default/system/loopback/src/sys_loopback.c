@@ -0,0 +1,667 @@
+/*******************************************************************************
+  Loopback Self-Test System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_loopback.c
+
+  Summary:
+    Loopback self-test system service implementation.
+
+  Description:
+    This file contains the source code for the loopback self-test, which
+    raises the sensor baud rate until the receive path loses data.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "system/loopback/sys_loopback.h"
+#include "system/command/sys_command.h"
+#include "system/log/sys_log.h"
+#include "system/power/sys_power.h"
+#include "system/telemetry/sys_telemetry.h"
+#include "driver/heartrate/drv_heartrate.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/rtc/plib_rtc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Synthetic frame, the sequence and RTC fields are written before sending */
+#define SYS_LOOPBACK_FRAME                      "15;000000;000000;14500;72;\r\n"
+#define SYS_LOOPBACK_FRAME_SIZE                 (sizeof(SYS_LOOPBACK_FRAME) - 1U)
+#define SYS_LOOPBACK_SEQUENCE_OFFSET            3U
+#define SYS_LOOPBACK_TIME_OFFSET                10U
+#define SYS_LOOPBACK_FIELD_DIGITS               6U
+#define SYS_LOOPBACK_FIELD_MODULUS              1000000U
+
+/* Third channel of every synthetic frame */
+#define SYS_LOOPBACK_MARKER                     14500U
+
+/* Line feeds sent after the last frame of a step, so that its tail reaches
+   the read threshold and is handed to the driver */
+#define SYS_LOOPBACK_PAD_SIZE                   32U
+
+typedef enum
+{
+    SYS_LOOPBACK_STATE_IDLE = 0,
+
+    /* Waiting for telemetry to finish and for the clock to be locked */
+    SYS_LOOPBACK_STATE_LOCK,
+
+    SYS_LOOPBACK_STATE_SETUP,
+
+    /* Frames are sent back to back from the transmit interrupt */
+    SYS_LOOPBACK_STATE_SEND,
+
+    /* Waiting for the last frame to leave the transmitter */
+    SYS_LOOPBACK_STATE_FLUSH,
+
+    /* Waiting for the driver to report the last frames */
+    SYS_LOOPBACK_STATE_DRAIN,
+
+    /* Waiting for the transmitter before the USARTs are set up again */
+    SYS_LOOPBACK_STATE_RESTORE,
+
+} SYS_LOOPBACK_STATE;
+
+typedef enum
+{
+    SYS_LOOPBACK_END_NONE = 0,
+
+    /* A step lost data */
+    SYS_LOOPBACK_END_SATURATED,
+
+    /* The next baud rate is above a third of the USART clock */
+    SYS_LOOPBACK_END_UNREACHABLE,
+
+    /* Every step completed without loss */
+    SYS_LOOPBACK_END_COMPLETE,
+
+    SYS_LOOPBACK_END_STOPPED,
+
+} SYS_LOOPBACK_END;
+
+typedef struct
+{
+    const SYS_LOOPBACK_INIT *   init;
+
+    SYS_LOOPBACK_STATE          state;
+
+    SYS_LOOPBACK_END            end;
+
+    CLOCK_MODE                  clockMode;
+
+    /* Telemetry state restored when the test ends */
+    bool                        telemetryEnabled;
+
+    DRV_HANDLE                  heartRateHandle;
+
+    /* Cleared to stop the frames chained by the transmit interrupt */
+    volatile bool               sending;
+
+    volatile uint32_t           framesSent;
+
+    uint8_t                     frame[SYS_LOOPBACK_FRAME_SIZE];
+
+    uint8_t                     pad[SYS_LOOPBACK_PAD_SIZE];
+
+    /* Step being measured and its RTC deadline */
+    uint32_t                    step;
+
+    uint32_t                    deadline;
+
+    uint32_t                    stepStart;
+
+    /* Time a frame takes on the wire at the step baud rate */
+    uint32_t                    frameUs;
+
+    uint32_t                    framesReceived;
+
+    uint32_t                    framesCorrupt;
+
+    uint32_t                    latencyCount;
+
+    uint64_t                    latencySumUs;
+
+    uint32_t                    latencyMaxUs;
+
+    /* Counters at the start of the step */
+    SERCOM_USART_STATS          sinkStats;
+
+    uint32_t                    sleepTicks;
+
+    /* Share of the sending time the CPU slept */
+    uint32_t                    idlePermille;
+
+    SYS_LOOPBACK_STEP_RESULT    results[SYS_LOOPBACK_STEPS_MAX];
+
+    uint32_t                    resultCount;
+
+} SYS_LOOPBACK_OBJ;
+
+static SYS_LOOPBACK_OBJ gSysLoopbackObj;
+
+static void _SYS_LOOPBACK_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysLoopbackCmdTbl[] =
+{
+    {"loopback", _SYS_LOOPBACK_Command, ": sensor rate self-test, 'loopback start [8|48]' or 'loopback stop'"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_MODULE_OBJ _SYS_LOOPBACK_HeartRateObject(const SYS_LOOPBACK_OBJ *obj)
+{
+    /* The heart rate driver object is its instance index */
+    return (SYS_MODULE_OBJ)obj->init->heartRateIndex;
+}
+
+/* Wrap safe check whether the RTC counter has reached the deadline */
+static inline bool _SYS_LOOPBACK_Due(uint32_t now, uint32_t deadline)
+{
+    return ((int32_t)(now - deadline) >= 0);
+}
+
+static void _SYS_LOOPBACK_FieldPut(uint8_t *field, uint32_t value)
+{
+    uint32_t i;
+
+    for (i = SYS_LOOPBACK_FIELD_DIGITS; i != 0U; i--)
+    {
+        field[i - 1U] = (uint8_t)('0' + (value % 10U));
+        value /= 10U;
+    }
+}
+
+/* Called from task context to start a step and from the transmit interrupt
+   for every following frame */
+static void _SYS_LOOPBACK_FrameSend(SYS_LOOPBACK_OBJ *obj)
+{
+    _SYS_LOOPBACK_FieldPut(&obj->frame[SYS_LOOPBACK_SEQUENCE_OFFSET], obj->framesSent);
+    _SYS_LOOPBACK_FieldPut(&obj->frame[SYS_LOOPBACK_TIME_OFFSET], RTC_Timer32CounterGet());
+
+    if (obj->init->source->write(obj->frame, SYS_LOOPBACK_FRAME_SIZE) == true)
+    {
+        obj->framesSent++;
+    }
+}
+
+static void _SYS_LOOPBACK_TransmitCallback(uintptr_t context)
+{
+    SYS_LOOPBACK_OBJ *obj = (SYS_LOOPBACK_OBJ *)context;
+
+    if (obj->sending == true)
+    {
+        _SYS_LOOPBACK_FrameSend(obj);
+    }
+}
+
+static void _SYS_LOOPBACK_SampleCallback(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+    uint32_t ticks;
+    uint32_t latencyUs;
+
+    if ((obj->state != SYS_LOOPBACK_STATE_SEND) && (obj->state != SYS_LOOPBACK_STATE_FLUSH) &&
+        (obj->state != SYS_LOOPBACK_STATE_DRAIN))
+    {
+        return;
+    }
+
+    if (((sample->frame.quality & DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT) != 0U) ||
+        (sample->frame.channel[2] != SYS_LOOPBACK_MARKER) ||
+        (sample->frame.channel[1] >= SYS_LOOPBACK_FIELD_MODULUS))
+    {
+        obj->framesCorrupt++;
+        return;
+    }
+
+    obj->framesReceived++;
+
+    /* The frame carries its start time modulo the field width */
+    ticks = ((sample->timestamp % SYS_LOOPBACK_FIELD_MODULUS) + SYS_LOOPBACK_FIELD_MODULUS - sample->frame.channel[1]) % SYS_LOOPBACK_FIELD_MODULUS;
+    latencyUs = (uint32_t)(((uint64_t)ticks * 1000000U) / RTC_Timer32FrequencyGet());
+    latencyUs = (latencyUs > obj->frameUs) ? (latencyUs - obj->frameUs) : 0U;
+
+    obj->latencyCount++;
+    obj->latencySumUs += latencyUs;
+    if (latencyUs > obj->latencyMaxUs)
+    {
+        obj->latencyMaxUs = latencyUs;
+    }
+}
+
+/* Programs both USARTs for the step and starts sending, returns false if
+   the baud rate cannot be reached from the current clock */
+static bool _SYS_LOOPBACK_StepStart(SYS_LOOPBACK_OBJ *obj)
+{
+    const SYS_LOOPBACK_INIT *init = obj->init;
+    USART_SERIAL_SETUP setup = init->setup;
+    SYS_POWER_STATISTICS powerStats;
+    uint32_t frequency = CLOCK_GCLK0FrequencyGet();
+
+    setup.baudRate = init->baudRates[obj->step];
+
+    /* The USARTs accept any rate, with less than 3 samples per bit the
+       receiver cannot work */
+    if (frequency < (3U * setup.baudRate))
+    {
+        return false;
+    }
+
+    (void)init->sink->serialSetup(&setup, frequency);
+    (void)init->source->serialSetup(&setup, frequency);
+
+    init->sink->statsGet(&obj->sinkStats);
+    SYS_POWER_StatisticsGet(&powerStats);
+    obj->sleepTicks = powerStats.sleepTicks;
+
+    obj->frameUs = (uint32_t)(((uint64_t)SYS_LOOPBACK_FRAME_SIZE * 10U * 1000000U) / setup.baudRate);
+    obj->framesSent = 0U;
+    obj->framesReceived = 0U;
+    obj->framesCorrupt = 0U;
+    obj->latencyCount = 0U;
+    obj->latencySumUs = 0U;
+    obj->latencyMaxUs = 0U;
+
+    obj->stepStart = RTC_Timer32CounterGet();
+    obj->deadline = obj->stepStart + init->stepTicks;
+    obj->sending = true;
+    _SYS_LOOPBACK_FrameSend(obj);
+
+    return true;
+}
+
+/* Stores the step result, the sleep time was taken when sending stopped */
+static void _SYS_LOOPBACK_StepEnd(SYS_LOOPBACK_OBJ *obj)
+{
+    SYS_LOOPBACK_STEP_RESULT *result = &obj->results[obj->resultCount];
+    SERCOM_USART_STATS sinkStats;
+    uint32_t received;
+
+    obj->init->sink->statsGet(&sinkStats);
+
+    received = obj->framesReceived + obj->framesCorrupt;
+
+    result->baudRate        = obj->init->baudRates[obj->step];
+    result->framesSent      = obj->framesSent;
+    result->framesLost      = (obj->framesSent > received) ? (obj->framesSent - received) : 0U;
+    result->framesCorrupt   = obj->framesCorrupt;
+    result->overrunCount    = sinkStats.overrunCount - obj->sinkStats.overrunCount;
+    result->overflowCount   = sinkStats.rx.overflowCount - obj->sinkStats.rx.overflowCount;
+    result->idlePermille    = obj->idlePermille;
+    result->latencyAverageUs = (obj->latencyCount != 0U) ? (uint32_t)(obj->latencySumUs / obj->latencyCount) : 0U;
+    result->latencyMaxUs    = obj->latencyMaxUs;
+
+    obj->resultCount++;
+
+    SYS_LOG_INFO(SYS_LOG_MODULE_HEARTRATE, "Loopback %lu baud: %lu frames, %lu lost, %lu corrupt, %lu overruns, idle %lu.%lu%%, latency %lu/%lu us",
+        result->baudRate, result->framesSent, result->framesLost, result->framesCorrupt, result->overrunCount,
+        result->idlePermille / 10U, result->idlePermille % 10U, result->latencyAverageUs, result->latencyMaxUs);
+}
+
+static bool _SYS_LOOPBACK_StepIsClean(const SYS_LOOPBACK_STEP_RESULT *result)
+{
+    return (result->framesLost == 0U) && (result->framesCorrupt == 0U) &&
+           (result->overrunCount == 0U) && (result->overflowCount == 0U);
+}
+
+/* Returns the highest baud rate that lost no data, 0 if there was none */
+static uint32_t _SYS_LOOPBACK_SustainedGet(const SYS_LOOPBACK_OBJ *obj)
+{
+    uint32_t baudRate = 0U;
+    uint32_t i;
+
+    for (i = 0U; (i < obj->resultCount) && (_SYS_LOOPBACK_StepIsClean(&obj->results[i]) == true); i++)
+    {
+        baudRate = obj->results[i].baudRate;
+    }
+
+    return baudRate;
+}
+
+static void _SYS_LOOPBACK_End(SYS_LOOPBACK_OBJ *obj, SYS_LOOPBACK_END end)
+{
+    obj->sending = false;
+    obj->end = end;
+    obj->state = SYS_LOOPBACK_STATE_RESTORE;
+}
+
+static void _SYS_LOOPBACK_Restore(SYS_LOOPBACK_OBJ *obj)
+{
+    const SYS_LOOPBACK_INIT *init = obj->init;
+    USART_SERIAL_SETUP setup = init->setup;
+    uint32_t frequency = CLOCK_GCLK0FrequencyGet();
+
+    init->source->writeCallbackRegister(NULL, 0U);
+
+    (void)init->sink->serialSetup(&setup, frequency);
+    setup = init->setup;
+    (void)init->source->serialSetup(&setup, frequency);
+
+    (void)DRV_HEARTRATE_LoopbackEnable(_SYS_LOOPBACK_HeartRateObject(obj), false);
+    SYS_POWER_ClockUnlock();
+    SYS_TELEMETRY_Enable(obj->telemetryEnabled);
+
+    SYS_LOG_INFO(SYS_LOG_MODULE_HEARTRATE, "Loopback at %lu MHz sustained %lu baud", frequency / 1000000U, _SYS_LOOPBACK_SustainedGet(obj));
+
+    obj->state = SYS_LOOPBACK_STATE_IDLE;
+}
+
+static void _SYS_LOOPBACK_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+    const SYS_LOOPBACK_STEP_RESULT *result;
+    CLOCK_MODE clockMode = CLOCK_ModeGet();
+    uint32_t i;
+
+    if ((argc > 1) && (strcmp(argv[1], "start") == 0))
+    {
+        if (argc > 2)
+        {
+            clockMode = (strcmp(argv[2], "48") == 0) ? CLOCK_MODE_HIGH_PERFORMANCE : CLOCK_MODE_LOW_POWER;
+        }
+
+        if (SYS_LOOPBACK_Start(clockMode) == false)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nnot started, test running, driver not ready or capture on\r\n");
+            return;
+        }
+
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nstarted, wire SERCOM2 TX to SERCOM0 RX\r\n");
+        return;
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "stop") == 0))
+    {
+        SYS_LOOPBACK_Stop();
+    }
+    else if (argc > 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: loopback [start [8|48]|stop]\r\n");
+        return;
+    }
+    else
+    {
+        /* Show the results */
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n    baud    frames  lost corrupt overrun  ring  idle%  lat avg  lat max");
+
+    for (i = 0U; i < obj->resultCount; i++)
+    {
+        result = &obj->results[i];
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%8lu %9lu %5lu %7lu %7lu %5lu %4lu.%lu %6lu us %6lu us",
+            result->baudRate, result->framesSent, result->framesLost, result->framesCorrupt, result->overrunCount,
+            result->overflowCount, result->idlePermille / 10U, result->idlePermille % 10U,
+            result->latencyAverageUs, result->latencyMaxUs);
+    }
+
+    if (SYS_LOOPBACK_IsRunning() == true)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nrunning step %lu\r\n", obj->step + 1U);
+        return;
+    }
+
+    switch (obj->end)
+    {
+        case SYS_LOOPBACK_END_SATURATED:
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nsustained %lu baud, saturated at %lu baud\r\n",
+                _SYS_LOOPBACK_SustainedGet(obj), obj->results[obj->resultCount - 1U].baudRate);
+            break;
+
+        case SYS_LOOPBACK_END_UNREACHABLE:
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nsustained %lu baud, %lu baud not reachable at this clock\r\n",
+                _SYS_LOOPBACK_SustainedGet(obj), obj->init->baudRates[obj->step]);
+            break;
+
+        case SYS_LOOPBACK_END_COMPLETE:
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nsustained %lu baud, the highest step\r\n", _SYS_LOOPBACK_SustainedGet(obj));
+            break;
+
+        case SYS_LOOPBACK_END_STOPPED:
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nstopped\r\n");
+            break;
+
+        case SYS_LOOPBACK_END_NONE:
+        default:
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nnot run\r\n");
+            break;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_LOOPBACK_Initialize( const SYS_LOOPBACK_INIT * const init )
+{
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+
+    memset(obj, 0, sizeof(*obj));
+
+    obj->init               = init;
+    obj->heartRateHandle    = DRV_HANDLE_INVALID;
+
+    memcpy(obj->frame, SYS_LOOPBACK_FRAME, SYS_LOOPBACK_FRAME_SIZE);
+    memset(obj->pad, '\n', sizeof(obj->pad));
+
+    return SYS_CMD_ADDGRP(sysLoopbackCmdTbl, sizeof(sysLoopbackCmdTbl)/sizeof(*sysLoopbackCmdTbl), "loopback", ": loopback self-test commands");
+}
+
+void SYS_LOOPBACK_Tasks( void )
+{
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+    const SYS_LOOPBACK_INIT *init = obj->init;
+    SYS_POWER_STATISTICS powerStats;
+    uint32_t now;
+    uint32_t elapsed;
+
+    switch (obj->state)
+    {
+        case SYS_LOOPBACK_STATE_LOCK:
+            /* Telemetry frames would be received as line noise */
+            if ((SYS_TELEMETRY_IsIdle() == true) && (init->source->writeIsBusy() == false) &&
+                (init->source->transmitComplete() == true) && (SYS_POWER_ClockLock(obj->clockMode) == true))
+            {
+                (void)DRV_HEARTRATE_LoopbackEnable(_SYS_LOOPBACK_HeartRateObject(obj), true);
+                init->source->writeCallbackRegister(_SYS_LOOPBACK_TransmitCallback, (uintptr_t)obj);
+                obj->state = SYS_LOOPBACK_STATE_SETUP;
+            }
+            break;
+
+        case SYS_LOOPBACK_STATE_SETUP:
+            if (_SYS_LOOPBACK_StepStart(obj) == false)
+            {
+                _SYS_LOOPBACK_End(obj, SYS_LOOPBACK_END_UNREACHABLE);
+                break;
+            }
+            obj->state = SYS_LOOPBACK_STATE_SEND;
+            break;
+
+        case SYS_LOOPBACK_STATE_SEND:
+            if (_SYS_LOOPBACK_Due(RTC_Timer32CounterGet(), obj->deadline) == true)
+            {
+                obj->sending = false;
+                obj->state = SYS_LOOPBACK_STATE_FLUSH;
+            }
+            break;
+
+        case SYS_LOOPBACK_STATE_FLUSH:
+            if ((init->source->writeIsBusy() == true) || (init->source->transmitComplete() == false))
+            {
+                break;
+            }
+
+            now = RTC_Timer32CounterGet();
+            elapsed = now - obj->stepStart;
+            SYS_POWER_StatisticsGet(&powerStats);
+            obj->idlePermille = (elapsed != 0U) ? (((powerStats.sleepTicks - obj->sleepTicks) * 1000U) / elapsed) : 0U;
+
+            (void)init->source->write(obj->pad, sizeof(obj->pad));
+            obj->deadline = now + init->drainTicks;
+            obj->state = SYS_LOOPBACK_STATE_DRAIN;
+            break;
+
+        case SYS_LOOPBACK_STATE_DRAIN:
+            if ((_SYS_LOOPBACK_Due(RTC_Timer32CounterGet(), obj->deadline) == false) ||
+                (init->source->writeIsBusy() == true) || (DRV_HEARTRATE_IsIdle(_SYS_LOOPBACK_HeartRateObject(obj)) == false))
+            {
+                break;
+            }
+
+            _SYS_LOOPBACK_StepEnd(obj);
+
+            if (_SYS_LOOPBACK_StepIsClean(&obj->results[obj->resultCount - 1U]) == false)
+            {
+                _SYS_LOOPBACK_End(obj, SYS_LOOPBACK_END_SATURATED);
+            }
+            else if (((obj->step + 1U) >= init->numBaudRates) || ((obj->step + 1U) >= SYS_LOOPBACK_STEPS_MAX))
+            {
+                _SYS_LOOPBACK_End(obj, SYS_LOOPBACK_END_COMPLETE);
+            }
+            else
+            {
+                obj->step++;
+                obj->state = SYS_LOOPBACK_STATE_SETUP;
+            }
+            break;
+
+        case SYS_LOOPBACK_STATE_RESTORE:
+            if ((init->source->writeIsBusy() == false) && (init->source->transmitComplete() == true))
+            {
+                _SYS_LOOPBACK_Restore(obj);
+            }
+            break;
+
+        case SYS_LOOPBACK_STATE_IDLE:
+        default:
+            break;
+    }
+}
+
+bool SYS_LOOPBACK_Start( CLOCK_MODE clockMode )
+{
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+
+    if ((obj->state != SYS_LOOPBACK_STATE_IDLE) || (DRV_HEARTRATE_CaptureIsEnabled(_SYS_LOOPBACK_HeartRateObject(obj)) == true))
+    {
+        return false;
+    }
+
+    if (obj->heartRateHandle == DRV_HANDLE_INVALID)
+    {
+        obj->heartRateHandle = DRV_HEARTRATE_Open(obj->init->heartRateIndex, DRV_IO_INTENT_READ);
+
+        if (obj->heartRateHandle == DRV_HANDLE_INVALID)
+        {
+            return false;
+        }
+
+        DRV_HEARTRATE_SampleEventHandlerSet(obj->heartRateHandle, _SYS_LOOPBACK_SampleCallback);
+    }
+
+    obj->clockMode          = clockMode;
+    obj->telemetryEnabled   = SYS_TELEMETRY_IsEnabled();
+    obj->step               = 0U;
+    obj->resultCount        = 0U;
+    obj->end                = SYS_LOOPBACK_END_NONE;
+    obj->state              = SYS_LOOPBACK_STATE_LOCK;
+
+    SYS_TELEMETRY_Enable(false);
+
+    return true;
+}
+
+void SYS_LOOPBACK_Stop( void )
+{
+    SYS_LOOPBACK_OBJ *obj = &gSysLoopbackObj;
+
+    if (obj->state == SYS_LOOPBACK_STATE_LOCK)
+    {
+        /* Nothing was changed yet apart from telemetry */
+        SYS_TELEMETRY_Enable(obj->telemetryEnabled);
+        obj->end = SYS_LOOPBACK_END_STOPPED;
+        obj->state = SYS_LOOPBACK_STATE_IDLE;
+    }
+    else if ((obj->state != SYS_LOOPBACK_STATE_IDLE) && (obj->state != SYS_LOOPBACK_STATE_RESTORE))
+    {
+        _SYS_LOOPBACK_End(obj, SYS_LOOPBACK_END_STOPPED);
+    }
+    else
+    {
+        /* Not running or already ending */
+    }
+}
+
+bool SYS_LOOPBACK_IsIdle( void )
+{
+    SYS_LOOPBACK_STATE state = gSysLoopbackObj.state;
+
+    return (state == SYS_LOOPBACK_STATE_IDLE) || (state == SYS_LOOPBACK_STATE_SEND);
+}
+
+bool SYS_LOOPBACK_IsRunning( void )
+{
+    return (gSysLoopbackObj.state != SYS_LOOPBACK_STATE_IDLE);
+}
+
+bool SYS_LOOPBACK_StepGet( uint32_t index, SYS_LOOPBACK_STEP_RESULT * result )
+{
+    if (index >= gSysLoopbackObj.resultCount)
+    {
+        return false;
+    }
+
+    *result = gSysLoopbackObj.results[index];
+
+    return true;
+}
+
+/*******************************************************************************
+ End of File
+*/
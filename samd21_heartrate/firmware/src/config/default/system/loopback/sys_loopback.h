@@ -0,0 +1,367 @@
+/*******************************************************************************
+  Loopback Self-Test System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_loopback.h
+
+  Summary:
+    Sensor receive path saturation test.
+
+  Description:
+    This file contains the interface definition for the loopback self-test.
+    Synthetic sensor frames are sent back to back from a spare USART
+    transmitter wired to the sensor USART receiver, while the sensor is held
+    in reset. The baud rate of both USARTs is raised step by step and every
+    step records the frames lost, the receive overruns, the time the CPU
+    spent asleep and the latency from the end of a frame on the wire to its
+    sample callback. The test stops at the first step that loses data, the
+    step before it is the highest sensor rate the receive path sustains at
+    the selected CPU clock.
+
+    Frames have the sensor layout, the first channel carries a sequence
+    number and the second the RTC counter when the frame was started:
+
+        15;<sequence>;<rtc>;14500;72;\r\n
+
+    The transmit interrupt runs on the same CPU, so the result is a lower
+    bound of what a real sensor at the same rate would allow.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_LOOPBACK_H
+#define SYS_LOOPBACK_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+#include "system/system.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/sercom/usart/plib_sercom_usart_common.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef bool (*SYS_LOOPBACK_PLIB_SERIAL_SETUP)( USART_SERIAL_SETUP * setup, uint32_t clkFrequency );
+
+typedef bool (*SYS_LOOPBACK_PLIB_WRITE)( void * buffer, const size_t size );
+
+typedef bool (*SYS_LOOPBACK_PLIB_IS_BUSY)( void );
+
+typedef void (*SYS_LOOPBACK_PLIB_WRITE_CALLBACK_REGISTER)( SERCOM_USART_CALLBACK callback, uintptr_t context );
+
+typedef void (*SYS_LOOPBACK_PLIB_STATS_GET)( SERCOM_USART_STATS * stats );
+
+// *****************************************************************************
+/* Loopback Source PLIB Interface
+
+  Summary:
+    Non-blocking USART transmitter that feeds the sensor receiver.
+
+  Description:
+    write must start an interrupt driven transfer of the whole buffer. The
+    write callback is called from the interrupt once the last byte has been
+    handed to the peripheral, the next frame is started from there.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SYS_LOOPBACK_PLIB_SERIAL_SETUP              serialSetup;
+
+    SYS_LOOPBACK_PLIB_WRITE                     write;
+
+    SYS_LOOPBACK_PLIB_IS_BUSY                   writeIsBusy;
+
+    SYS_LOOPBACK_PLIB_IS_BUSY                   transmitComplete;
+
+    SYS_LOOPBACK_PLIB_WRITE_CALLBACK_REGISTER   writeCallbackRegister;
+
+} SYS_LOOPBACK_SOURCE_PLIB_INTERFACE;
+
+// *****************************************************************************
+/* Loopback Sink PLIB Interface
+
+  Summary:
+    The sensor USART, reprogrammed for every step.
+
+  Description:
+    None.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SYS_LOOPBACK_PLIB_SERIAL_SETUP  serialSetup;
+
+    SYS_LOOPBACK_PLIB_STATS_GET     statsGet;
+
+} SYS_LOOPBACK_SINK_PLIB_INTERFACE;
+
+typedef struct
+{
+    const SYS_LOOPBACK_SOURCE_PLIB_INTERFACE *  source;
+
+    const SYS_LOOPBACK_SINK_PLIB_INTERFACE *    sink;
+
+    /* Heart rate driver instance under test */
+    SYS_MODULE_INDEX                            heartRateIndex;
+
+    /* Baud rates in increasing order, one step each */
+    const uint32_t *                            baudRates;
+
+    size_t                                      numBaudRates;
+
+    /* Setup of both USARTs restored when the test ends */
+    USART_SERIAL_SETUP                          setup;
+
+    /* Duration of a step and the time allowed to receive its last frames,
+       in RTC ticks */
+    uint32_t                                    stepTicks;
+
+    uint32_t                                    drainTicks;
+
+} SYS_LOOPBACK_INIT;
+
+// *****************************************************************************
+/* Loopback Step Result
+
+  Summary:
+    Measurements of one baud rate step.
+
+  Description:
+    framesLost counts frames sent but never reported, framesCorrupt frames
+    reported with a non-digit field. overrunCount and overflowCount are the
+    sensor USART overruns and the bytes rejected by its full receive ring
+    during the step. idlePermille is the share of the step the CPU slept.
+    The latencies are measured with the RTC, about one millisecond
+    resolution, from the end of a frame on the wire to its sample callback.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t baudRate;
+
+    uint32_t framesSent;
+
+    uint32_t framesLost;
+
+    uint32_t framesCorrupt;
+
+    uint32_t overrunCount;
+
+    uint32_t overflowCount;
+
+    uint32_t idlePermille;
+
+    uint32_t latencyAverageUs;
+
+    uint32_t latencyMaxUs;
+
+} SYS_LOOPBACK_STEP_RESULT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_LOOPBACK_Initialize( const SYS_LOOPBACK_INIT * const init )
+
+  Summary:
+    Initializes the service and registers the "loopback" command group.
+
+  Description:
+    The heart rate driver is opened when a test starts.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    init - Initialization data, must stay valid
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_LOOPBACK_Initialize( const SYS_LOOPBACK_INIT * const init );
+
+// *****************************************************************************
+/* Function:
+    void SYS_LOOPBACK_Tasks( void )
+
+  Summary:
+    Runs the steps of a started test.
+
+  Description:
+    Prepares every step once the previous one has been received, and logs
+    its result. When the test ends the USARTs, the sensor, telemetry and the
+    clock governor are restored.
+
+  Precondition:
+    SYS_LOOPBACK_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_LOOPBACK_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_LOOPBACK_Start( CLOCK_MODE clockMode )
+
+  Summary:
+    Starts a test at a CPU clock.
+
+  Description:
+    Telemetry is paused, as its USART is the frame source, and the clock is
+    locked in clockMode until the test ends.
+
+  Precondition:
+    SYS_LOOPBACK_Initialize must have been called. The source transmitter
+    must be wired to the sensor receiver.
+
+  Parameters:
+    clockMode - CPU clock the test runs at
+
+  Returns:
+    true if the test was started, false if one is running, the driver is not
+    ready or the driver captures received bytes.
+
+  Remarks:
+    The results of the previous test are cleared.
+*/
+
+bool SYS_LOOPBACK_Start( CLOCK_MODE clockMode );
+
+void SYS_LOOPBACK_Stop( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_LOOPBACK_IsIdle( void )
+
+  Summary:
+    Returns false while SYS_LOOPBACK_Tasks has work to do.
+
+  Description:
+    While frames are sent the transmit interrupts wake the device, so a
+    running step does not keep it awake.
+
+  Precondition:
+    SYS_LOOPBACK_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if no test runs or a step is sending frames.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_LOOPBACK_IsIdle( void );
+
+bool SYS_LOOPBACK_IsRunning( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_LOOPBACK_StepGet( uint32_t index, SYS_LOOPBACK_STEP_RESULT * result )
+
+  Summary:
+    Returns the result of a completed step of the last test.
+
+  Description:
+    Steps are numbered in the order they ran. The last step of a test that
+    ran to the end is the first that lost data.
+
+  Precondition:
+    SYS_LOOPBACK_Initialize must have been called.
+
+  Parameters:
+    index  - Step number, from 0
+    result - Receives the step result
+
+  Returns:
+    true if the step has completed.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_LOOPBACK_StepGet( uint32_t index, SYS_LOOPBACK_STEP_RESULT * result );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_LOOPBACK_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,351 @@
+/*******************************************************************************
+  Power Management System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_power.c
+
+  Summary:
+    Power Management System Service implementation.
+
+  Description:
+    This file contains the source code for the Power Management system
+    service. The device is put into IDLE or STANDBY sleep from the super loop
+    whenever none of the registered clients has pending work.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "system/power/sys_power.h"
+#include "system/command/sys_command.h"
+#include "peripheral/pm/plib_pm.h"
+#include "peripheral/nvic/plib_nvic.h"
+#include "peripheral/clock/plib_clock.h"
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+#include "peripheral/systick/plib_systick.h"
+#include "peripheral/rtc/plib_rtc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_POWER_INIT gSysPowerInit;
+
+static SYS_POWER_STATISTICS gSysPowerStats;
+
+/* Task passes the backlog has stayed below the low threshold */
+static uint32_t gSysPowerLowLoadCount;
+
+/* Set by SYS_POWER_ClockLock, the governor leaves the clock alone */
+static bool gSysPowerClockLocked;
+
+static void _SYS_POWER_CommandStats(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysPowerCmdTbl[] =
+{
+    {"pwrstat", _SYS_POWER_CommandStats, ": show sleep mode counters"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_POWER_MODE _SYS_POWER_ModeSelect(void)
+{
+    SYS_POWER_MODE mode = gSysPowerInit.deepestMode;
+    SYS_POWER_MODE clientMode;
+    size_t i;
+
+    for (i = 0; (i < gSysPowerInit.numClients) && (mode != SYS_POWER_MODE_READY); i++)
+    {
+        clientMode = gSysPowerInit.clients[i]();
+
+        if (clientMode < mode)
+        {
+            mode = clientMode;
+        }
+    }
+
+    return mode;
+}
+
+static uint32_t _SYS_POWER_BacklogGet(void)
+{
+    uint32_t backlog = 0;
+    size_t i;
+
+    for (i = 0; i < gSysPowerInit.numBacklogClients; i++)
+    {
+        backlog += gSysPowerInit.backlogClients[i]();
+    }
+
+    return backlog;
+}
+
+static bool _SYS_POWER_ClockModeApply(CLOCK_MODE mode)
+{
+    USART_SERIAL_SETUP setup;
+    uint32_t frequency;
+    bool interruptState;
+    size_t i;
+
+    /* Checked with interrupts off, so that the switch follows right after */
+    interruptState = NVIC_INT_Disable();
+
+    for (i = 0; i < gSysPowerInit.numSerialPorts; i++)
+    {
+        if (gSysPowerInit.serialPorts[i].isIdle() == false)
+        {
+            NVIC_INT_Restore(interruptState);
+            gSysPowerStats.clockDeferredCount++;
+            return false;
+        }
+    }
+
+    /* Flash needs one wait state above 24 MHz. Add it before speeding up
+     * and remove it only after slowing down */
+    if (mode == CLOCK_MODE_HIGH_PERFORMANCE)
+    {
+        NVMCTRL_WaitStatesSet(1U);
+        CLOCK_ModeSet(mode);
+    }
+    else
+    {
+        CLOCK_ModeSet(mode);
+        NVMCTRL_WaitStatesSet(0U);
+    }
+
+    frequency = CLOCK_GCLK0FrequencyGet();
+
+    for (i = 0; i < gSysPowerInit.numSerialPorts; i++)
+    {
+        setup = gSysPowerInit.serialPorts[i].setup;
+        (void)gSysPowerInit.serialPorts[i].serialSetup(&setup, frequency);
+    }
+
+    SYSTICK_TimerFrequencySet(frequency);
+
+    NVIC_INT_Restore(interruptState);
+
+    return true;
+}
+
+static void _SYS_POWER_ClockGovernor(void)
+{
+    uint32_t backlog = _SYS_POWER_BacklogGet();
+
+    if (CLOCK_ModeGet() == CLOCK_MODE_LOW_POWER)
+    {
+        if ((backlog >= gSysPowerInit.backlogHighThreshold) && (_SYS_POWER_ClockModeApply(CLOCK_MODE_HIGH_PERFORMANCE) == true))
+        {
+            gSysPowerStats.clockUpCount++;
+        }
+        gSysPowerLowLoadCount = 0;
+    }
+    else if (backlog > gSysPowerInit.backlogLowThreshold)
+    {
+        gSysPowerLowLoadCount = 0;
+    }
+    else if (gSysPowerLowLoadCount < gSysPowerInit.lowPowerDelay)
+    {
+        gSysPowerLowLoadCount++;
+    }
+    else if (_SYS_POWER_ClockModeApply(CLOCK_MODE_LOW_POWER) == true)
+    {
+        gSysPowerStats.clockDownCount++;
+        gSysPowerLowLoadCount = 0;
+    }
+    else
+    {
+        /* Retry on the next pass */
+    }
+}
+
+/* SERCOM0 wakes from STANDBY on the start of a frame, which needs GCLK0 on
+ * OSC8M: the DFLL does not start up in time. The governor may still have
+ * the 48 MHz mode on for its hysteresis window, so the clock comes down
+ * here. Returns false if it cannot, the caller then sleeps in IDLE. */
+static bool _SYS_POWER_StandbyClockSet(void)
+{
+    if (CLOCK_ModeGet() == CLOCK_MODE_LOW_POWER)
+    {
+        return true;
+    }
+
+    if ((gSysPowerClockLocked == true) || (_SYS_POWER_ClockModeApply(CLOCK_MODE_LOW_POWER) == false))
+    {
+        return false;
+    }
+
+    gSysPowerStats.clockDownCount++;
+    gSysPowerLowLoadCount = 0;
+
+    return true;
+}
+
+static void _SYS_POWER_CommandStats(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_POWER_STATISTICS stats;
+
+    SYS_POWER_StatisticsGet(&stats);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nready   : %lu", stats.readyCount);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nidle    : %lu entered, %lu exited", stats.idleEntryCount, stats.idleExitCount);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nstandby : %lu entered, %lu exited", stats.standbyEntryCount, stats.standbyExitCount);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nasleep  : %lu ms", (uint32_t)(((uint64_t)stats.sleepTicks * 1000U) / RTC_Timer32FrequencyGet()));
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nclock   : %lu Hz, %lu up, %lu down, %lu deferred%s\r\n", CLOCK_GCLK0FrequencyGet(), stats.clockUpCount, stats.clockDownCount, stats.clockDeferredCount,
+        gSysPowerClockLocked ? ", locked" : "");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_POWER_Initialize( const SYS_POWER_INIT * const init )
+{
+    if (init == NULL)
+    {
+        return false;
+    }
+
+    gSysPowerInit = *init;
+
+    memset(&gSysPowerStats, 0, sizeof(gSysPowerStats));
+
+    gSysPowerLowLoadCount = 0;
+
+    gSysPowerClockLocked = false;
+
+    PM_Initialize();
+
+    return SYS_CMD_ADDGRP(sysPowerCmdTbl, sizeof(sysPowerCmdTbl)/sizeof(*sysPowerCmdTbl), "power", ": power management commands");
+}
+
+void SYS_POWER_Tasks( void )
+{
+    bool interruptState;
+    uint32_t sleepStart;
+    SYS_POWER_MODE mode;
+
+    if (gSysPowerClockLocked == false)
+    {
+        _SYS_POWER_ClockGovernor();
+    }
+
+    /* Interrupts stay masked between the client check and WFI so that an
+     * event arriving in between is not missed. A pending interrupt still
+     * wakes the core, and it is serviced once the mask is restored. */
+    interruptState = NVIC_INT_Disable();
+
+    mode = _SYS_POWER_ModeSelect();
+
+    if ((mode == SYS_POWER_MODE_STANDBY) && (_SYS_POWER_StandbyClockSet() == false))
+    {
+        mode = SYS_POWER_MODE_IDLE;
+    }
+
+    switch (mode)
+    {
+        case SYS_POWER_MODE_IDLE:
+            gSysPowerStats.idleEntryCount++;
+            sleepStart = RTC_Timer32CounterGet();
+            PM_IdleModeEnter(PM_IDLE_MODE_IDLE0);
+            gSysPowerStats.sleepTicks += RTC_Timer32CounterGet() - sleepStart;
+            gSysPowerStats.idleExitCount++;
+            break;
+
+        case SYS_POWER_MODE_STANDBY:
+            gSysPowerStats.standbyEntryCount++;
+            sleepStart = RTC_Timer32CounterGet();
+            PM_StandbyModeEnter();
+            gSysPowerStats.sleepTicks += RTC_Timer32CounterGet() - sleepStart;
+            gSysPowerStats.standbyExitCount++;
+            break;
+
+        case SYS_POWER_MODE_READY:
+        default:
+            gSysPowerStats.readyCount++;
+            break;
+    }
+
+    NVIC_INT_Restore(interruptState);
+}
+
+void SYS_POWER_StatisticsGet( SYS_POWER_STATISTICS * stats )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    *stats = gSysPowerStats;
+
+    NVIC_INT_Restore(interruptState);
+}
+
+bool SYS_POWER_ClockLock( CLOCK_MODE mode )
+{
+    if (CLOCK_ModeGet() != mode)
+    {
+        if (_SYS_POWER_ClockModeApply(mode) == false)
+        {
+            return false;
+        }
+
+        if (mode == CLOCK_MODE_HIGH_PERFORMANCE)
+        {
+            gSysPowerStats.clockUpCount++;
+        }
+        else
+        {
+            gSysPowerStats.clockDownCount++;
+        }
+    }
+
+    gSysPowerClockLocked = true;
+    gSysPowerLowLoadCount = 0;
+
+    return true;
+}
+
+void SYS_POWER_ClockUnlock( void )
+{
+    gSysPowerClockLocked = false;
+}
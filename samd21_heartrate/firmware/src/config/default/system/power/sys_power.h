@@ -0,0 +1,399 @@
+/*******************************************************************************
+  Power Management System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_power.h
+
+  Summary:
+    Power Management System Service interface.
+
+  Description:
+    This file contains the interface definition for the Power Management
+    system service. The service runs at the end of every super loop pass,
+    asks its clients how deep the device may sleep and then enters the
+    deepest sleep mode that every client allows.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_POWER_H
+#define SYS_POWER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "system/system.h"
+#include "peripheral/sercom/usart/plib_sercom_usart_common.h"
+#include "peripheral/clock/plib_clock.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Power Mode
+
+  Summary:
+    Identifies how deep the device is allowed to sleep.
+
+  Description:
+    The modes are ordered from the shallowest to the deepest, so the mode
+    applied by the service is the minimum of the modes reported by all
+    clients.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* Work is pending, the super loop must run again immediately */
+    SYS_POWER_MODE_READY = 0,
+
+    /* CPU clock may be stopped, all peripherals keep running (IDLE0) */
+    SYS_POWER_MODE_IDLE,
+
+    /* All clocks may be stopped except the ones requested on demand by
+       peripherals configured to run in standby */
+    SYS_POWER_MODE_STANDBY
+
+} SYS_POWER_MODE;
+
+// *****************************************************************************
+/* Power Client Mode Query
+
+  Summary:
+    Returns the deepest mode a client can tolerate right now.
+
+  Description:
+    Called with interrupts disabled right before the device goes to sleep, so
+    implementations must be short and must not block.
+
+  Remarks:
+    None.
+*/
+
+typedef SYS_POWER_MODE (*SYS_POWER_CLIENT_MODE_GET)( void );
+
+// *****************************************************************************
+/* Power Client Backlog Query
+
+  Summary:
+    Returns the number of bytes a client still has to process.
+
+  Description:
+    The sum over all clients decides whether the CPU clock runs from the
+    8 MHz or the 48 MHz source.
+
+  Remarks:
+    None.
+*/
+
+typedef uint32_t (*SYS_POWER_CLIENT_BACKLOG_GET)( void );
+
+typedef bool (*SYS_POWER_SERIAL_SETUP)( USART_SERIAL_SETUP * setup, uint32_t clkFrequency );
+
+typedef bool (*SYS_POWER_SERIAL_IS_IDLE)( void );
+
+// *****************************************************************************
+/* Power Service Serial Port
+
+  Summary:
+    Describes a USART clocked from GCLK0.
+
+  Description:
+    Every port is reprogrammed with setup through serialSetup when the CPU
+    clock changes. The change is postponed while isIdle returns false for
+    any port, because a character in flight would be corrupted.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SYS_POWER_SERIAL_SETUP      serialSetup;
+
+    SYS_POWER_SERIAL_IS_IDLE    isIdle;
+
+    USART_SERIAL_SETUP          setup;
+
+} SYS_POWER_SERIAL_PORT;
+
+// *****************************************************************************
+/* Power Service Initialization Data
+
+  Summary:
+    Defines the data required to initialize the power service.
+
+  Description:
+    clients lists the mode query callbacks of all modules that can hold the
+    device awake. deepestMode caps the mode the service will ever enter, which
+    allows standby to be disabled while debugging.
+
+    The CPU clock is raised to 48 MHz as soon as the summed backlog reaches
+    backlogHighThreshold and lowered to 8 MHz once it stayed at or below
+    backlogLowThreshold for lowPowerDelay consecutive task passes.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    const SYS_POWER_CLIENT_MODE_GET *   clients;
+
+    size_t                              numClients;
+
+    SYS_POWER_MODE                      deepestMode;
+
+    const SYS_POWER_CLIENT_BACKLOG_GET *backlogClients;
+
+    size_t                              numBacklogClients;
+
+    const SYS_POWER_SERIAL_PORT *       serialPorts;
+
+    size_t                              numSerialPorts;
+
+    uint32_t                            backlogHighThreshold;
+
+    uint32_t                            backlogLowThreshold;
+
+    uint32_t                            lowPowerDelay;
+
+} SYS_POWER_INIT;
+
+// *****************************************************************************
+/* Power Service Statistics
+
+  Summary:
+    Counts how often each power mode was selected.
+
+  Description:
+    readyCount counts the super loop passes that skipped sleeping because a
+    client had pending work. Entry counts are incremented right before WFI and
+    exit counts right after the device resumed. clockDeferredCount counts
+    clock changes postponed because a serial port was busy.
+
+    sleepTicks is the RTC time spent in IDLE or STANDBY. Sleeps shorter than
+    a tick add one tick or none, which averages out to the time asleep.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t readyCount;
+
+    uint32_t idleEntryCount;
+
+    uint32_t idleExitCount;
+
+    uint32_t standbyEntryCount;
+
+    uint32_t standbyExitCount;
+
+    uint32_t clockUpCount;
+
+    uint32_t clockDownCount;
+
+    uint32_t clockDeferredCount;
+
+    uint32_t sleepTicks;
+
+} SYS_POWER_STATISTICS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_POWER_Initialize( const SYS_POWER_INIT * const init )
+
+  Summary:
+    Initializes the power service.
+
+  Description:
+    Saves the client list, clears the statistics and registers the "power"
+    command group with the command processor.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    init - Pointer to the initialization data.
+
+  Returns:
+    true if the service was initialized, false otherwise.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_POWER_Initialize( const SYS_POWER_INIT * const init );
+
+// *****************************************************************************
+/* Function:
+    void SYS_POWER_Tasks( void )
+
+  Summary:
+    Puts the device to sleep when all clients allow it.
+
+  Description:
+    First selects the CPU clock source from the backlog reported by the
+    clients. Then queries every client with interrupts disabled and enters
+    IDLE or STANDBY sleep according to the shallowest mode reported.
+    STANDBY is entered with GCLK0 on OSC8M only, the clock is brought down
+    first and IDLE is used instead while it cannot be, or is locked by
+    SYS_POWER_ClockLock. Any enabled interrupt wakes the device, after which
+    the function returns to the super loop.
+
+  Precondition:
+    SYS_POWER_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Must be called last in SYS_Tasks so that sleep is only entered after all
+    other tasks had a chance to run.
+*/
+
+void SYS_POWER_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_POWER_StatisticsGet( SYS_POWER_STATISTICS * stats )
+
+  Summary:
+    Returns a copy of the power mode counters.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_POWER_Initialize must have been called.
+
+  Parameters:
+    stats - Pointer to the structure that receives the counters.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_POWER_StatisticsGet( SYS_POWER_STATISTICS * stats );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_POWER_ClockLock( CLOCK_MODE mode )
+
+  Summary:
+    Switches the CPU clock to a mode and keeps it there.
+
+  Description:
+    The clock governor is suspended until SYS_POWER_ClockUnlock is called,
+    so that a measurement runs at a known clock and serial ports set up
+    for it are not reprogrammed.
+
+  Precondition:
+    SYS_POWER_Initialize must have been called.
+
+  Parameters:
+    mode - Clock mode to hold.
+
+  Returns:
+    true if the clock runs in mode, false if the change was postponed
+    because a serial port was busy. Retry later in that case.
+
+  Remarks:
+    Switching reprograms every serial port with its initial setup.
+*/
+
+bool SYS_POWER_ClockLock( CLOCK_MODE mode );
+
+// *****************************************************************************
+/* Function:
+    void SYS_POWER_ClockUnlock( void )
+
+  Summary:
+    Hands the CPU clock back to the governor.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_POWER_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_POWER_ClockUnlock( void );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // SYS_POWER_H
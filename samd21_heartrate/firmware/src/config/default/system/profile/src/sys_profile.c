@@ -0,0 +1,163 @@
+/*******************************************************************************
+  Cycle Profiling System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_profile.c
+
+  Summary:
+    Cycle Profiling System Service implementation.
+
+  Description:
+    This file contains the source code for the cycle profiling system service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "system/profile/sys_profile.h"
+#include "system/command/sys_command.h"
+#include "peripheral/nvic/plib_nvic.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_PROFILE_COUNTER gSysProfileCounters[SYS_PROFILE_ID_MAX];
+
+static const char * const gSysProfileNames[SYS_PROFILE_ID_MAX] =
+{
+    "sercom0 isr",
+    "hr parse",
+    "hr encode",
+};
+
+static void _SYS_PROFILE_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysProfileCmdTbl[] =
+{
+    {"prof", _SYS_PROFILE_Command, ": show cycle counts, 'prof reset' clears them"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void _SYS_PROFILE_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_PROFILE_COUNTER counter;
+    bool interruptState;
+    uint32_t id;
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0))
+    {
+        interruptState = NVIC_INT_Disable();
+        memset(gSysProfileCounters, 0, sizeof(gSysProfileCounters));
+        NVIC_INT_Restore(interruptState);
+        return;
+    }
+
+#if (SYS_PROFILE_ENABLE == 1)
+#ifdef RAMFUNC_DISABLE
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nhot paths in flash");
+#else
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nhot paths in SRAM");
+#endif
+#else
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nprofiling disabled, set SYS_PROFILE_ENABLE to 1");
+#endif
+
+    for (id = 0; id < (uint32_t)SYS_PROFILE_ID_MAX; id++)
+    {
+        SYS_PROFILE_CounterGet((SYS_PROFILE_ID)id, &counter);
+
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\n%s: %lu calls, avg %lu, max %lu cycles", gSysProfileNames[id],
+            counter.count, (counter.count != 0U) ? (counter.totalCycles / counter.count) : 0U, counter.maxCycles);
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_PROFILE_Initialize( void )
+{
+    memset(gSysProfileCounters, 0, sizeof(gSysProfileCounters));
+
+    return SYS_CMD_ADDGRP(sysProfileCmdTbl, sizeof(sysProfileCmdTbl)/sizeof(*sysProfileCmdTbl), "prof", ": cycle profiling commands");
+}
+
+void SYS_PROFILE_Record( SYS_PROFILE_ID id, uint32_t start )
+{
+    SYS_PROFILE_COUNTER *counter = &gSysProfileCounters[id];
+    uint32_t end = SysTick->VAL;
+    uint32_t cycles;
+
+    /* SysTick counts down and reloads from LOAD */
+    if (start >= end)
+    {
+        cycles = start - end;
+    }
+    else
+    {
+        cycles = start + (SysTick->LOAD + 1U) - end;
+    }
+
+    counter->count++;
+    counter->totalCycles += cycles;
+
+    if (cycles > counter->maxCycles)
+    {
+        counter->maxCycles = cycles;
+    }
+}
+
+void SYS_PROFILE_CounterGet( SYS_PROFILE_ID id, SYS_PROFILE_COUNTER * counter )
+{
+    bool interruptState = NVIC_INT_Disable();
+
+    *counter = gSysProfileCounters[id];
+
+    NVIC_INT_Restore(interruptState);
+}
@@ -0,0 +1,209 @@
+/*******************************************************************************
+  Cycle Profiling System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_profile.h
+
+  Summary:
+    Cycle Profiling System Service interface.
+
+  Description:
+    This file contains the interface definition for the cycle profiling
+    system service. Code sections are measured in CPU cycles with the SysTick
+    counter and the count, average and maximum of every section are printed
+    by the "prof" command.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_PROFILE_H
+#define SYS_PROFILE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+#include "device.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Profiled Code Sections
+
+  Summary:
+    Identifies the measured code sections.
+
+  Description:
+    Every section has one counter. A section must only be measured from one
+    execution context, either an interrupt or the super loop.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* SERCOM0 interrupt, sensor bytes into the ring buffer */
+    SYS_PROFILE_ID_SERCOM0_ISR = 0,
+
+    /* Heart rate frame parser, one call per read threshold notification */
+    SYS_PROFILE_ID_HEARTRATE_PARSE,
+
+    /* Heart rate series codec, one call per sample logged */
+    SYS_PROFILE_ID_HRCODEC_ENCODE,
+
+    SYS_PROFILE_ID_MAX
+
+} SYS_PROFILE_ID;
+
+// *****************************************************************************
+/* Profile Counter
+
+  Summary:
+    Cycle statistics of one code section.
+
+  Description:
+    None.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t count;
+
+    uint32_t totalCycles;
+
+    uint32_t maxCycles;
+
+} SYS_PROFILE_COUNTER;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_PROFILE_Initialize( void )
+
+  Summary:
+    Clears the counters and registers the "prof" command group.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    SysTick must be running for the measurements to be valid. It clocks from
+    the CPU clock, so the results are in CPU cycles in either clock mode.
+*/
+
+bool SYS_PROFILE_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_PROFILE_Record( SYS_PROFILE_ID id, uint32_t start )
+
+  Summary:
+    Adds the cycles elapsed since start to the counter of a section.
+
+  Description:
+    Use the SYS_PROFILE_START and SYS_PROFILE_STOP macros instead, they
+    compile to nothing unless SYS_PROFILE_ENABLE is 1.
+
+  Precondition:
+    None.
+
+  Parameters:
+    id    - Measured section
+    start - Value returned by SYS_PROFILE_START
+
+  Returns:
+    None.
+
+  Remarks:
+    Sections longer than one SysTick period are reported too short.
+*/
+
+void SYS_PROFILE_Record( SYS_PROFILE_ID id, uint32_t start );
+
+void SYS_PROFILE_CounterGet( SYS_PROFILE_ID id, SYS_PROFILE_COUNTER * counter );
+
+static inline uint32_t SYS_PROFILE_TimestampGet( void )
+{
+    return SysTick->VAL;
+}
+
+#if (SYS_PROFILE_ENABLE == 1)
+#define SYS_PROFILE_START()             SYS_PROFILE_TimestampGet()
+#define SYS_PROFILE_STOP(id, start)     SYS_PROFILE_Record((id), (start))
+#else
+#define SYS_PROFILE_START()             (0U)
+#define SYS_PROFILE_STOP(id, start)     ((void)(start))
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_PROFILE_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,146 @@
+/*******************************************************************************
+  Stack Usage System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_stack.c
+
+  Summary:
+    Stack Usage System Service implementation.
+
+  Description:
+    This file contains the source code for the stack usage system service.
+    The stack is painted by Reset_Handler in startup_xc32.c.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include "configuration.h"
+#include "device.h"
+#include "system/stack/sys_stack.h"
+#include "system/command/sys_command.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Linker defined stack limit and top */
+extern uint32_t _splim;
+extern uint32_t _stack;
+
+/* Lowest word found overwritten, NULL before the first scan */
+static uint32_t *gSysStackMark;
+
+static void _SYS_STACK_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysStackCmdTbl[] =
+{
+    {"stack", _SYS_STACK_Command, ": show the stack size, high-water mark and depth"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void _SYS_STACK_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_STACK_USAGE usage;
+
+    SYS_STACK_UsageGet(&usage);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nstack    : %lu bytes at 0x%08lx", usage.size, (uint32_t)&_splim);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nnow      : %lu bytes", usage.used);
+
+    if (usage.maxUsed == 0U)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nmax used : unknown, stack not painted\r\n");
+        return;
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\nmax used : %lu bytes (%lu%%), headroom %lu bytes",
+        usage.maxUsed, (usage.maxUsed * 100U) / usage.size, usage.size - usage.maxUsed);
+
+    if (usage.maxUsed >= usage.size)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\npattern gone at the limit, the stack has overflowed");
+    }
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_STACK_Initialize( void )
+{
+    gSysStackMark = NULL;
+
+    return SYS_CMD_ADDGRP(sysStackCmdTbl, sizeof(sysStackCmdTbl)/sizeof(*sysStackCmdTbl), "stack", ": stack usage commands");
+}
+
+void SYS_STACK_UsageGet( SYS_STACK_USAGE * usage )
+{
+#if (SYS_STACK_PAINT_ENABLE == 1)
+    uint32_t *word = &_splim;
+    uint32_t *end = (gSysStackMark != NULL) ? gSysStackMark : &_stack;
+
+    /* Words above the mark are used already, the mark only moves down */
+    while ((word < end) && (*word == SYS_STACK_PAINT_PATTERN))
+    {
+        word++;
+    }
+
+    gSysStackMark = word;
+    usage->maxUsed = (uint32_t)&_stack - (uint32_t)word;
+#else
+    usage->maxUsed = 0U;
+#endif
+
+    usage->size = (uint32_t)&_stack - (uint32_t)&_splim;
+    usage->used = (uint32_t)&_stack - __get_MSP();
+}
+
+/*******************************************************************************
+ End of File
+*/
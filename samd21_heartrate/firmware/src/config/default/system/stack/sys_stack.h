@@ -0,0 +1,174 @@
+/*******************************************************************************
+  Stack Usage System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_stack.h
+
+  Summary:
+    Stack Usage System Service interface.
+
+  Description:
+    This file contains the interface definition for the stack usage system
+    service. Reset_Handler in startup_xc32.c fills the stack with
+    SYS_STACK_PAINT_PATTERN before main is called, the deepest word that no
+    longer holds the pattern is the high-water mark of the stack. The
+    "stack" command prints it.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_STACK_H
+#define SYS_STACK_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "configuration.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types and Constants
+// *****************************************************************************
+// *****************************************************************************
+
+/* Word written over the stack by Reset_Handler */
+#define SYS_STACK_PAINT_PATTERN             0xA5C3A5C3U
+
+// *****************************************************************************
+/* Stack Usage
+
+  Summary:
+    Size and depth of the main stack in bytes.
+
+  Description:
+    The stack spans from the linker symbol _splim up to _stack, where
+    Reset_Handler sets the stack pointer. Interrupt handlers run on the
+    same stack, maxUsed includes the deepest handler nesting seen so far.
+
+  Remarks:
+    maxUsed equal to size means the pattern is gone at the limit, the stack
+    has most likely overflowed into the data below it.
+*/
+
+typedef struct
+{
+    uint32_t size;
+
+    /* High-water mark since reset */
+    uint32_t maxUsed;
+
+    /* Depth at the call of SYS_STACK_UsageGet */
+    uint32_t used;
+
+} SYS_STACK_USAGE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_STACK_Initialize( void )
+
+  Summary:
+    Registers the "stack" command group.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    With SYS_STACK_PAINT_ENABLE set to 0 the stack is not painted and the
+    command reports the high-water mark as unknown.
+*/
+
+bool SYS_STACK_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_STACK_UsageGet( SYS_STACK_USAGE * usage )
+
+  Summary:
+    Gets the stack size, the high-water mark and the current depth.
+
+  Description:
+    The painted words are scanned upwards from the limit up to the
+    high-water mark of the previous call, the mark only moves down, so
+    only the first call scans the whole unused stack.
+
+  Precondition:
+    None.
+
+  Parameters:
+    usage - Receives the stack usage
+
+  Returns:
+    None.
+
+  Remarks:
+    Call it from the super loop only. usage->maxUsed is 0 when the stack
+    was not painted.
+*/
+
+void SYS_STACK_UsageGet( SYS_STACK_USAGE * usage );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_STACK_H
+
+/*******************************************************************************
+ End of File
+*/
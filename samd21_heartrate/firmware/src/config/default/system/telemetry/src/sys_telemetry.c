@@ -0,0 +1,554 @@
+/*******************************************************************************
+  Telemetry System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_telemetry.c
+
+  Summary:
+    Telemetry System Service implementation.
+
+  Description:
+    This file contains the source code for the telemetry system service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "configuration.h"
+#include "system/telemetry/sys_telemetry.h"
+#include "system/command/sys_command.h"
+#include "driver/heartrate/drv_heartrate.h"
+#include "peripheral/rtc/plib_rtc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_TELEMETRY_FRAME_SIZE        (SYS_TELEMETRY_HEADER_SIZE + (SYS_TELEMETRY_SAMPLES_PER_FRAME * SYS_TELEMETRY_RECORD_SIZE) + SYS_TELEMETRY_CRC_SIZE)
+
+#define SYS_TELEMETRY_CAPTURE_FRAME_SIZE    (SYS_TELEMETRY_HEADER_SIZE + SYS_TELEMETRY_CAPTURE_PAYLOAD_SIZE + SYS_TELEMETRY_CRC_SIZE)
+
+#if (SYS_TELEMETRY_CAPTURE_PAYLOAD_SIZE < (SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE + DRV_HEARTRATE_CAPTURE_CHUNK_MAX))
+#error "SYS_TELEMETRY_CAPTURE_PAYLOAD_SIZE does not hold the longest capture record"
+#endif
+
+#define SYS_TELEMETRY_MAX_FRAME_SIZE    ((SYS_TELEMETRY_CAPTURE_FRAME_SIZE > SYS_TELEMETRY_FRAME_SIZE) ? SYS_TELEMETRY_CAPTURE_FRAME_SIZE : SYS_TELEMETRY_FRAME_SIZE)
+
+/* COBS adds one byte per 254 data bytes plus one, the delimiter one more */
+#define SYS_TELEMETRY_TX_BUFFER_SIZE    (SYS_TELEMETRY_MAX_FRAME_SIZE + (SYS_TELEMETRY_MAX_FRAME_SIZE / 254U) + 2U)
+
+typedef struct
+{
+    const SYS_TELEMETRY_INIT       *init;
+
+    DRV_HANDLE                      heartRateHandle;
+
+    bool                            enabled;
+
+    /* Set when the measurement window closed, the partial batch is sent */
+    bool                            flushRequested;
+
+    /* Captured sensor chunks are sent as they arrive, otherwise they are
+       held in the driver capture buffer */
+    bool                            captureSending;
+
+    /* Records in the batch being filled */
+    uint8_t                         count;
+
+    uint32_t                        baseTime;
+
+    uint8_t                         frame[SYS_TELEMETRY_FRAME_SIZE];
+
+    uint8_t                         captureFrame[SYS_TELEMETRY_CAPTURE_FRAME_SIZE];
+
+    /* Encoded frame owned by the USART while a transfer is in progress */
+    uint8_t                         txBuffer[SYS_TELEMETRY_TX_BUFFER_SIZE];
+
+    SYS_TELEMETRY_STATISTICS        stats;
+
+} SYS_TELEMETRY_OBJ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_TELEMETRY_OBJ gSysTelemetryObj;
+
+/* CRC-16/CCITT-FALSE, one nibble at a time */
+static const uint16_t gSysTelemetryCrcTable[16] =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+};
+
+static void _SYS_TELEMETRY_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+
+static const SYS_CMD_DESCRIPTOR sysTelemetryCmdTbl[] =
+{
+    {"telem", _SYS_TELEMETRY_Command, ": show statistics, 'telem on|off' starts or stops the stream, 'telem capture on|hold|send|off' captures the raw sensor bytes"},
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void _SYS_TELEMETRY_Put16(uint8_t *dst, uint16_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+}
+
+static void _SYS_TELEMETRY_Put24(uint8_t *dst, uint32_t value)
+{
+    if (value > 0xFFFFFFU)
+    {
+        value = 0xFFFFFFU;
+    }
+
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+}
+
+static void _SYS_TELEMETRY_Put32(uint8_t *dst, uint32_t value)
+{
+    _SYS_TELEMETRY_Put16(dst, (uint16_t)value);
+    _SYS_TELEMETRY_Put16(&dst[2], (uint16_t)(value >> 16));
+}
+
+static bool _SYS_TELEMETRY_FlushDue(SYS_TELEMETRY_OBJ *obj)
+{
+    if (obj->count == 0U)
+    {
+        return false;
+    }
+
+    if ((obj->count >= SYS_TELEMETRY_SAMPLES_PER_FRAME) || (obj->flushRequested == true))
+    {
+        return true;
+    }
+
+    return ((RTC_Timer32CounterGet() - obj->baseTime) >= obj->init->flushTicks);
+}
+
+/* Encodes the batch and hands it to the USART, false if it is still busy */
+static bool _SYS_TELEMETRY_Send(SYS_TELEMETRY_OBJ *obj)
+{
+    size_t size;
+    size_t encoded;
+
+    if (obj->init->plib->writeIsBusy() == true)
+    {
+        return false;
+    }
+
+    obj->frame[0] = SYS_TELEMETRY_FRAME_TYPE_SAMPLES;
+    obj->frame[1] = obj->count;
+    _SYS_TELEMETRY_Put32(&obj->frame[2], obj->baseTime);
+
+    size = SYS_TELEMETRY_HEADER_SIZE + ((size_t)obj->count * SYS_TELEMETRY_RECORD_SIZE);
+    _SYS_TELEMETRY_Put16(&obj->frame[size], SYS_TELEMETRY_Crc16(obj->frame, size));
+    size += SYS_TELEMETRY_CRC_SIZE;
+
+    encoded = SYS_TELEMETRY_CobsEncode(obj->frame, size, obj->txBuffer);
+    obj->txBuffer[encoded] = 0U;
+
+    if (obj->init->plib->write(obj->txBuffer, encoded + 1U) == false)
+    {
+        return false;
+    }
+
+    obj->stats.framesSent++;
+    obj->stats.samplesSent += obj->count;
+    obj->count = 0U;
+    obj->flushRequested = false;
+
+    return true;
+}
+
+static SYS_MODULE_OBJ _SYS_TELEMETRY_HeartRateObject(SYS_TELEMETRY_OBJ *obj)
+{
+    /* The heart rate driver object is its instance index */
+    return (SYS_MODULE_OBJ)obj->init->heartRateIndex;
+}
+
+static bool _SYS_TELEMETRY_CapturePending(SYS_TELEMETRY_OBJ *obj)
+{
+    DRV_HEARTRATE_CAPTURE_STATISTICS stats;
+
+    if (obj->captureSending == false)
+    {
+        return false;
+    }
+
+    DRV_HEARTRATE_CaptureStatisticsGet(_SYS_TELEMETRY_HeartRateObject(obj), &stats);
+
+    return (stats.pendingBytes != 0U);
+}
+
+/* Moves as many captured chunks as fit into one frame and sends it, false
+   if the USART is busy or nothing was captured */
+static bool _SYS_TELEMETRY_CaptureSend(SYS_TELEMETRY_OBJ *obj)
+{
+    DRV_HEARTRATE_CAPTURE_RECORD record;
+    uint8_t *frame = obj->captureFrame;
+    size_t size = SYS_TELEMETRY_HEADER_SIZE;
+    size_t room;
+    size_t encoded;
+    uint8_t count = 0U;
+
+    if (obj->init->plib->writeIsBusy() == true)
+    {
+        return false;
+    }
+
+    while (count < 0xFFU)
+    {
+        room = (SYS_TELEMETRY_HEADER_SIZE + SYS_TELEMETRY_CAPTURE_PAYLOAD_SIZE) - size;
+        if (room <= SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE)
+        {
+            break;
+        }
+
+        if (DRV_HEARTRATE_CaptureRead(_SYS_TELEMETRY_HeartRateObject(obj), &record,
+                &frame[size + SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE], room - SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE) == false)
+        {
+            break;
+        }
+
+        if (count == 0U)
+        {
+            _SYS_TELEMETRY_Put32(&frame[2], record.timestamp);
+        }
+
+        _SYS_TELEMETRY_Put16(&frame[size], record.sequence);
+        _SYS_TELEMETRY_Put32(&frame[size + 2U], record.timestamp);
+        frame[size + 6U] = record.length;
+        frame[size + 7U] = record.flags;
+
+        size += SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE + record.length;
+        count++;
+    }
+
+    if (count == 0U)
+    {
+        return false;
+    }
+
+    frame[0] = SYS_TELEMETRY_FRAME_TYPE_CAPTURE;
+    frame[1] = count;
+
+    _SYS_TELEMETRY_Put16(&frame[size], SYS_TELEMETRY_Crc16(frame, size));
+    size += SYS_TELEMETRY_CRC_SIZE;
+
+    encoded = SYS_TELEMETRY_CobsEncode(frame, size, obj->txBuffer);
+    obj->txBuffer[encoded] = 0U;
+
+    /* Not busy, checked above */
+    (void)obj->init->plib->write(obj->txBuffer, encoded + 1U);
+
+    obj->stats.captureFramesSent++;
+    obj->stats.captureRecordsSent += count;
+
+    return true;
+}
+
+static void _SYS_TELEMETRY_CaptureCommand(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_TELEMETRY_OBJ *obj = &gSysTelemetryObj;
+    SYS_MODULE_OBJ heartRate = _SYS_TELEMETRY_HeartRateObject(obj);
+    DRV_HEARTRATE_CAPTURE_STATISTICS stats;
+    bool status = true;
+
+    if (argc > 2)
+    {
+        if (strcmp(argv[2], "on") == 0)
+        {
+            status = DRV_HEARTRATE_CaptureEnable(heartRate, true);
+            obj->captureSending = true;
+        }
+        else if (strcmp(argv[2], "hold") == 0)
+        {
+            status = DRV_HEARTRATE_CaptureEnable(heartRate, true);
+            obj->captureSending = false;
+        }
+        else if (strcmp(argv[2], "send") == 0)
+        {
+            obj->captureSending = true;
+        }
+        else if (strcmp(argv[2], "off") == 0)
+        {
+            /* What is still held is sent if sending is on */
+            status = DRV_HEARTRATE_CaptureEnable(heartRate, false);
+        }
+        else
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: telem capture [on|hold|send|off]\r\n");
+            return;
+        }
+
+        if (status == false)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\ncapture not available\r\n");
+            return;
+        }
+    }
+
+    DRV_HEARTRATE_CaptureStatisticsGet(heartRate, &stats);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\ncapture %s, %s: %lu chunks, %lu bytes, %lu chunks dropped, %lu/%u bytes held, peak %lu\r\n",
+        DRV_HEARTRATE_CaptureIsEnabled(heartRate) ? "on" : "off", obj->captureSending ? "sending" : "holding",
+        stats.recordCount, stats.byteCount, stats.droppedRecordCount, stats.pendingBytes,
+        (unsigned int)DRV_HEARTRATE_CAPTURE_BUFFER_SIZE, stats.peakUsage);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "%lu capture frames, %lu chunks sent\r\n",
+        obj->stats.captureFramesSent, obj->stats.captureRecordsSent);
+}
+
+static void _SYS_TELEMETRY_SampleCallback(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    SYS_TELEMETRY_OBJ *obj = &gSysTelemetryObj;
+    uint8_t *record;
+    uint32_t timeDelta;
+    uint32_t channel;
+
+    if (obj->enabled == false)
+    {
+        return;
+    }
+
+    /* The full batch waits for the previous frame to leave the USART */
+    if ((obj->count >= SYS_TELEMETRY_SAMPLES_PER_FRAME) && (_SYS_TELEMETRY_Send(obj) == false))
+    {
+        obj->stats.samplesDropped++;
+        return;
+    }
+
+    if (obj->count == 0U)
+    {
+        obj->baseTime = sample->timestamp;
+    }
+
+    timeDelta = sample->timestamp - obj->baseTime;
+
+    record = &obj->frame[SYS_TELEMETRY_HEADER_SIZE + ((size_t)obj->count * SYS_TELEMETRY_RECORD_SIZE)];
+
+    _SYS_TELEMETRY_Put16(&record[0], (uint16_t)sample->sequence);
+    _SYS_TELEMETRY_Put16(&record[2], (timeDelta > 0xFFFFU) ? 0xFFFFU : (uint16_t)timeDelta);
+    record[4] = sample->frame.heartRate;
+    record[5] = sample->frame.quality;
+
+    for (channel = 0U; channel < DRV_HEARTRATE_FRAME_CHANNELS; channel++)
+    {
+        _SYS_TELEMETRY_Put24(&record[6U + (channel * 3U)], sample->frame.channel[channel]);
+    }
+
+    obj->count++;
+
+    if (obj->count >= SYS_TELEMETRY_SAMPLES_PER_FRAME)
+    {
+        (void)_SYS_TELEMETRY_Send(obj);
+    }
+}
+
+static void _SYS_TELEMETRY_SessionCallback(DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary)
+{
+    /* The sensor is off until the next window, do not hold back the tail */
+    gSysTelemetryObj.flushRequested = true;
+}
+
+static void _SYS_TELEMETRY_Command(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    SYS_TELEMETRY_STATISTICS stats;
+
+    if ((argc > 1) && (strcmp(argv[1], "capture") == 0))
+    {
+        _SYS_TELEMETRY_CaptureCommand(pCmdIO, argc, argv);
+        return;
+    }
+
+    if (argc > 1)
+    {
+        if (strcmp(argv[1], "on") == 0)
+        {
+            SYS_TELEMETRY_Enable(true);
+        }
+        else if (strcmp(argv[1], "off") == 0)
+        {
+            SYS_TELEMETRY_Enable(false);
+        }
+        else
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\nusage: telem [on|off|capture]\r\n");
+            return;
+        }
+    }
+
+    SYS_TELEMETRY_StatisticsGet(&stats);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\r\ntelemetry %s: %lu frames, %lu samples sent, %lu dropped\r\n",
+        gSysTelemetryObj.enabled ? "on" : "off", stats.framesSent, stats.samplesSent, stats.samplesDropped);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+bool SYS_TELEMETRY_Initialize( const SYS_TELEMETRY_INIT * const init )
+{
+    SYS_TELEMETRY_OBJ *obj = &gSysTelemetryObj;
+
+    memset(obj, 0, sizeof(*obj));
+
+    obj->init               = init;
+    obj->heartRateHandle    = DRV_HANDLE_INVALID;
+    obj->enabled            = (SYS_TELEMETRY_START_ENABLED == 1);
+
+    return SYS_CMD_ADDGRP(sysTelemetryCmdTbl, sizeof(sysTelemetryCmdTbl)/sizeof(*sysTelemetryCmdTbl), "telem", ": telemetry stream commands");
+}
+
+void SYS_TELEMETRY_Tasks( void )
+{
+    SYS_TELEMETRY_OBJ *obj = &gSysTelemetryObj;
+
+    if (obj->heartRateHandle == DRV_HANDLE_INVALID)
+    {
+        /* Retried until the driver is ready and has a free client slot */
+        obj->heartRateHandle = DRV_HEARTRATE_Open(obj->init->heartRateIndex, DRV_IO_INTENT_READ);
+
+        if (obj->heartRateHandle == DRV_HANDLE_INVALID)
+        {
+            return;
+        }
+
+        DRV_HEARTRATE_SampleEventHandlerSet(obj->heartRateHandle, _SYS_TELEMETRY_SampleCallback);
+        DRV_HEARTRATE_SessionEventHandlerSet(obj->heartRateHandle, _SYS_TELEMETRY_SessionCallback);
+    }
+
+    if (_SYS_TELEMETRY_FlushDue(obj) == true)
+    {
+        (void)_SYS_TELEMETRY_Send(obj);
+    }
+
+    /* Samples go first, captured chunks take the USART when it is free */
+    if (obj->captureSending == true)
+    {
+        (void)_SYS_TELEMETRY_CaptureSend(obj);
+    }
+}
+
+bool SYS_TELEMETRY_IsIdle( void )
+{
+    SYS_TELEMETRY_OBJ *obj = &gSysTelemetryObj;
+
+    return (_SYS_TELEMETRY_FlushDue(obj) == false) && (_SYS_TELEMETRY_CapturePending(obj) == false);
+}
+
+void SYS_TELEMETRY_Enable( bool enable )
+{
+    gSysTelemetryObj.enabled = enable;
+
+    if (enable == false)
+    {
+        gSysTelemetryObj.flushRequested = true;
+    }
+}
+
+bool SYS_TELEMETRY_IsEnabled( void )
+{
+    return gSysTelemetryObj.enabled;
+}
+
+void SYS_TELEMETRY_StatisticsGet( SYS_TELEMETRY_STATISTICS * stats )
+{
+    *stats = gSysTelemetryObj.stats;
+}
+
+size_t SYS_TELEMETRY_CobsEncode( const uint8_t * src, size_t size, uint8_t * dst )
+{
+    size_t codeIndex = 0U;
+    size_t outIndex = 1U;
+    size_t inIndex;
+    uint8_t code = 1U;
+
+    for (inIndex = 0U; inIndex < size; inIndex++)
+    {
+        if (src[inIndex] != 0U)
+        {
+            dst[outIndex] = src[inIndex];
+            outIndex++;
+            code++;
+        }
+
+        if ((src[inIndex] == 0U) || (code == 0xFFU))
+        {
+            dst[codeIndex] = code;
+            codeIndex = outIndex;
+            outIndex++;
+            code = 1U;
+        }
+    }
+
+    dst[codeIndex] = code;
+
+    return outIndex;
+}
+
+uint16_t SYS_TELEMETRY_Crc16( const uint8_t * data, size_t size )
+{
+    uint16_t crc = 0xFFFFU;
+    size_t index;
+
+    for (index = 0U; index < size; index++)
+    {
+        crc = (uint16_t)(crc << 4) ^ gSysTelemetryCrcTable[(crc >> 12) ^ (data[index] >> 4)];
+        crc = (uint16_t)(crc << 4) ^ gSysTelemetryCrcTable[(crc >> 12) ^ (data[index] & 0x0FU)];
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,300 @@
+/*******************************************************************************
+  Telemetry System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_telemetry.h
+
+  Summary:
+    Binary sample stream system service interface.
+
+  Description:
+    This file contains the interface definition for the telemetry system
+    service. Every heart rate sensor frame is packed into a compact binary
+    record, several records are batched into one frame protected by a CRC-16
+    and the frame is COBS encoded and sent on a dedicated USART without ever
+    waiting for the transmitter.
+
+    Frame layout before COBS encoding, all fields little endian:
+
+        type (1) count (1) baseTime (4)
+        count x record: sequence (2) timeDelta (2) heartRate (1) quality (1)
+                        channel[3] (3 each)
+        crc (2)
+
+    baseTime is the RTC counter of the first record, timeDelta the RTC ticks
+    since baseTime. sequence is the low half of DRV_HEARTRATE_SAMPLE.sequence,
+    channels saturate at 0xFFFFFF. The CRC is CRC-16/CCITT-FALSE over type up
+    to the last record. Encoded frames are terminated with a 0x00 byte.
+
+    With "telem capture on" the raw sensor chunks captured by the heart rate
+    driver are sent in capture frames between the sample frames, same
+    header and CRC with type 2:
+
+        count x record: sequence (2) timestamp (4) length (1) flags (1)
+                        data (length)
+
+    The fields are those of DRV_HEARTRATE_CAPTURE_RECORD, timestamp is the
+    full RTC counter so that records far apart fit in one frame.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_TELEMETRY_H
+#define SYS_TELEMETRY_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+#include "system/system.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_TELEMETRY_FRAME_TYPE_SAMPLES        0x01U
+
+#define SYS_TELEMETRY_FRAME_TYPE_CAPTURE        0x02U
+
+#define SYS_TELEMETRY_HEADER_SIZE               6U
+
+#define SYS_TELEMETRY_RECORD_SIZE               15U
+
+/* Capture record: sequence, timestamp, length and flags, then the chunk */
+#define SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE    8U
+
+#define SYS_TELEMETRY_CRC_SIZE                  2U
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef bool (*SYS_TELEMETRY_PLIB_WRITE)( void * buffer, const size_t size );
+
+typedef bool (*SYS_TELEMETRY_PLIB_WRITE_IS_BUSY)( void );
+
+// *****************************************************************************
+/* Telemetry PLIB Interface
+
+  Summary:
+    Non-blocking USART transmit functions used by the service.
+
+  Description:
+    write must start an interrupt driven transfer of the whole buffer and
+    return false without waiting if a transfer is already in progress.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    SYS_TELEMETRY_PLIB_WRITE            write;
+
+    SYS_TELEMETRY_PLIB_WRITE_IS_BUSY    writeIsBusy;
+
+} SYS_TELEMETRY_PLIB_INTERFACE;
+
+typedef struct
+{
+    const SYS_TELEMETRY_PLIB_INTERFACE *plib;
+
+    /* Heart rate driver instance the samples are taken from */
+    SYS_MODULE_INDEX                    heartRateIndex;
+
+    /* A partial batch is sent once its first record is this many RTC ticks old */
+    uint32_t                            flushTicks;
+
+} SYS_TELEMETRY_INIT;
+
+typedef struct
+{
+    uint32_t framesSent;
+
+    uint32_t samplesSent;
+
+    /* Samples lost because the batch was full while the previous frame was
+       still being transmitted */
+    uint32_t samplesDropped;
+
+    uint32_t captureFramesSent;
+
+    uint32_t captureRecordsSent;
+
+} SYS_TELEMETRY_STATISTICS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool SYS_TELEMETRY_Initialize( const SYS_TELEMETRY_INIT * const init )
+
+  Summary:
+    Initializes the service and registers the "telem" command group.
+
+  Description:
+    The heart rate driver is opened from SYS_TELEMETRY_Tasks once it accepts
+    clients.
+
+  Precondition:
+    SYS_CMD_Initialize must have been called.
+
+  Parameters:
+    init - Initialization data, must stay valid
+
+  Returns:
+    true if the command group was registered.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_TELEMETRY_Initialize( const SYS_TELEMETRY_INIT * const init );
+
+// *****************************************************************************
+/* Function:
+    void SYS_TELEMETRY_Tasks( void )
+
+  Summary:
+    Opens the heart rate driver and sends completed or expired batches.
+
+  Description:
+    None.
+
+  Precondition:
+    SYS_TELEMETRY_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Call from SYS_Tasks after the heart rate driver tasks.
+*/
+
+void SYS_TELEMETRY_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_TELEMETRY_IsIdle( void )
+
+  Summary:
+    Returns false while a batch or captured sensor bytes are due to be sent.
+
+  Description:
+    A partial batch that has not reached its flush time does not keep the
+    device awake, it is sent when the next sample arrives or the measurement
+    window closes. Held captures do not keep it awake either.
+
+  Precondition:
+    SYS_TELEMETRY_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if SYS_TELEMETRY_Tasks has nothing to do right now.
+
+  Remarks:
+    None.
+*/
+
+bool SYS_TELEMETRY_IsIdle( void );
+
+void SYS_TELEMETRY_Enable( bool enable );
+
+bool SYS_TELEMETRY_IsEnabled( void );
+
+void SYS_TELEMETRY_StatisticsGet( SYS_TELEMETRY_STATISTICS * stats );
+
+// *****************************************************************************
+/* Function:
+    size_t SYS_TELEMETRY_CobsEncode( const uint8_t * src, size_t size, uint8_t * dst )
+
+  Summary:
+    COBS encodes a buffer.
+
+  Description:
+    dst receives at most size + size / 254 + 1 bytes, the 0x00 delimiter is
+    not added.
+
+  Precondition:
+    None.
+
+  Parameters:
+    src  - Data to encode
+    size - Number of bytes in src
+    dst  - Encoded output
+
+  Returns:
+    Number of encoded bytes.
+
+  Remarks:
+    None.
+*/
+
+size_t SYS_TELEMETRY_CobsEncode( const uint8_t * src, size_t size, uint8_t * dst );
+
+uint16_t SYS_TELEMETRY_Crc16( const uint8_t * data, size_t size );
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_TELEMETRY_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,240 @@
+/*******************************************************************************
+  Tokenized Log System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_tlog.c
+
+  Summary:
+    Tokenized Log System Service implementation.
+
+  Description:
+    This file contains the source code of the tokenized log service.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdarg.h>
+#include "configuration.h"
+#include "system/tlog/sys_tlog.h"
+#include "system/console/sys_console.h"
+#include "peripheral/nvic/plib_nvic.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Marker, length, id and arguments, each varint at most 5 bytes */
+#define SYS_TLOG_RECORD_SIZE_MAX    (2U + (5U * (1U + SYS_TLOG_ARGS_MAX)))
+
+static uint8_t gSysTlogRing[SYS_TLOG_BUFFER_SIZE];
+
+static volatile uint32_t gSysTlogInIndex;
+
+static volatile uint32_t gSysTlogOutIndex;
+
+static uint32_t gSysTlogDropped;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t _SYS_TLOG_VarintPut(uint8_t *dst, uint32_t value)
+{
+    uint32_t len = 0;
+
+    while (value >= 0x80U)
+    {
+        dst[len] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+        len++;
+    }
+
+    dst[len] = (uint8_t)value;
+
+    return len + 1U;
+}
+
+static uint32_t _SYS_TLOG_CountGet(void)
+{
+    uint32_t inIndex = gSysTlogInIndex;
+    uint32_t outIndex = gSysTlogOutIndex;
+
+    return (inIndex >= outIndex) ? (inIndex - outIndex) : ((SYS_TLOG_BUFFER_SIZE - outIndex) + inIndex);
+}
+
+/* Must be called with interrupts disabled */
+static bool _SYS_TLOG_Push(const uint8_t *record, uint32_t len)
+{
+    uint32_t i;
+
+    if ((_SYS_TLOG_CountGet() + len) >= SYS_TLOG_BUFFER_SIZE)
+    {
+        return false;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        gSysTlogRing[gSysTlogInIndex] = record[i];
+        gSysTlogInIndex++;
+        if (gSysTlogInIndex >= SYS_TLOG_BUFFER_SIZE)
+        {
+            gSysTlogInIndex = 0;
+        }
+    }
+
+    return true;
+}
+
+/* Length of the record at the head of the ring */
+static uint32_t _SYS_TLOG_HeadLengthGet(void)
+{
+    uint32_t lengthIndex = gSysTlogOutIndex + 1U;
+
+    if (lengthIndex >= SYS_TLOG_BUFFER_SIZE)
+    {
+        lengthIndex = 0;
+    }
+
+    return 2U + gSysTlogRing[lengthIndex];
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+void SYS_TLOG_Initialize( void )
+{
+    gSysTlogInIndex = 0;
+    gSysTlogOutIndex = 0;
+    gSysTlogDropped = 0;
+}
+
+void SYS_TLOG_Write( uint32_t id, uint32_t nArgs, ... )
+{
+    uint8_t record[SYS_TLOG_RECORD_SIZE_MAX];
+    uint8_t dropped[2U + 5U];
+    uint32_t len;
+    uint32_t droppedLen;
+    bool interruptState;
+    va_list args;
+
+    /* Encode outside of the critical section */
+    len = 2U + _SYS_TLOG_VarintPut(&record[2], id);
+
+    va_start(args, nArgs);
+    while ((nArgs > 0U) && (len <= (SYS_TLOG_RECORD_SIZE_MAX - 5U)))
+    {
+        len += _SYS_TLOG_VarintPut(&record[len], va_arg(args, uint32_t));
+        nArgs--;
+    }
+    va_end(args);
+
+    record[0] = SYS_TLOG_RECORD_MARKER;
+    record[1] = (uint8_t)(len - 2U);
+
+    interruptState = NVIC_INT_Disable();
+
+    /* Report earlier losses first so that the order is preserved */
+    if (gSysTlogDropped != 0U)
+    {
+        droppedLen = 2U + _SYS_TLOG_VarintPut(&dropped[2], gSysTlogDropped);
+        dropped[0] = SYS_TLOG_DROPPED_MARKER;
+        dropped[1] = (uint8_t)(droppedLen - 2U);
+
+        if (_SYS_TLOG_Push(dropped, droppedLen) == true)
+        {
+            gSysTlogDropped = 0;
+        }
+    }
+
+    if ((gSysTlogDropped != 0U) || (_SYS_TLOG_Push(record, len) == false))
+    {
+        gSysTlogDropped++;
+    }
+
+    NVIC_INT_Restore(interruptState);
+}
+
+void SYS_TLOG_Tasks( void )
+{
+    uint32_t len;
+    uint32_t contiguous;
+    ssize_t freeSpace;
+
+    while (_SYS_TLOG_CountGet() != 0U)
+    {
+        len = _SYS_TLOG_HeadLengthGet();
+        freeSpace = SYS_CONSOLE_WriteFreeBufferCountGet(SYS_TLOG_CONSOLE_INDEX);
+
+        if ((freeSpace < 0) || ((uint32_t)freeSpace < len))
+        {
+            break;
+        }
+
+        /* Only the task consumes, so the head record cannot change */
+        contiguous = SYS_TLOG_BUFFER_SIZE - gSysTlogOutIndex;
+        if (len > contiguous)
+        {
+            (void)SYS_CONSOLE_Write(SYS_TLOG_CONSOLE_INDEX, &gSysTlogRing[gSysTlogOutIndex], contiguous);
+            (void)SYS_CONSOLE_Write(SYS_TLOG_CONSOLE_INDEX, &gSysTlogRing[0], len - contiguous);
+            gSysTlogOutIndex = len - contiguous;
+        }
+        else
+        {
+            (void)SYS_CONSOLE_Write(SYS_TLOG_CONSOLE_INDEX, &gSysTlogRing[gSysTlogOutIndex], len);
+            gSysTlogOutIndex = (len == contiguous) ? 0U : (gSysTlogOutIndex + len);
+        }
+    }
+}
+
+bool SYS_TLOG_IsIdle( void )
+{
+    ssize_t freeSpace;
+
+    if (_SYS_TLOG_CountGet() == 0U)
+    {
+        return true;
+    }
+
+    freeSpace = SYS_CONSOLE_WriteFreeBufferCountGet(SYS_TLOG_CONSOLE_INDEX);
+
+    return ((freeSpace < 0) || ((uint32_t)freeSpace < _SYS_TLOG_HeadLengthGet()));
+}
@@ -0,0 +1,254 @@
+/*******************************************************************************
+  Tokenized Log System Service Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_tlog.h
+
+  Summary:
+    Tokenized Log System Service interface.
+
+  Description:
+    This file contains the interface definition of the tokenized log service.
+    SYS_TLOG stores its format string in the .tlog ELF section, which is not
+    programmed into the device. At run time only the address of the string
+    and the arguments are queued, varint encoded, in a RAM ring that
+    SYS_TLOG_Tasks drains to the console. tools/tlog/tlog_decode.py turns
+    the captured console output back into text using the ELF file.
+
+    Wire format of a record:
+      0xFE <length> <varint string id> <varint argument>...
+    Records lost because the ring was full are reported as:
+      0xFD <length> <varint number of lost records>
+    Varints are unsigned LEB128, arguments are sent as 32 bit unsigned values.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_TLOG_H
+#define SYS_TLOG_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+#include "system/system.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Constants
+// *****************************************************************************
+// *****************************************************************************
+
+#define SYS_TLOG_RECORD_MARKER          (0xFEU)
+
+#define SYS_TLOG_DROPPED_MARKER         (0xFDU)
+
+/* Maximum number of arguments of one SYS_TLOG call */
+#define SYS_TLOG_ARGS_MAX               (4U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    void SYS_TLOG_Initialize( void )
+
+  Summary:
+    Clears the log ring.
+
+  Description:
+    None.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+void SYS_TLOG_Initialize( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_TLOG_Tasks( void )
+
+  Summary:
+    Moves complete records from the log ring to the console.
+
+  Description:
+    Only records that fit into the free space of the console transmit buffer
+    are written, so a record is never split.
+
+  Precondition:
+    SYS_TLOG_Initialize and SYS_CONSOLE_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Called from SYS_Tasks.
+*/
+
+void SYS_TLOG_Tasks( void );
+
+// *****************************************************************************
+/* Function:
+    bool SYS_TLOG_IsIdle( void )
+
+  Summary:
+    Tells whether SYS_TLOG_Tasks has nothing it can do right now.
+
+  Description:
+    Returns false while records are queued and the console has room for the
+    next one.
+
+  Precondition:
+    SYS_TLOG_Initialize must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true if SYS_TLOG_Tasks would not make progress.
+
+  Remarks:
+    Used as a power service client.
+*/
+
+bool SYS_TLOG_IsIdle( void );
+
+// *****************************************************************************
+/* Function:
+    void SYS_TLOG_Write( uint32_t id, uint32_t nArgs, ... )
+
+  Summary:
+    Queues a log record.
+
+  Description:
+    Use the SYS_TLOG macro instead, it creates the string id.
+
+  Precondition:
+    SYS_TLOG_Initialize must have been called.
+
+  Parameters:
+    id    - Address of the format string in the .tlog section
+    nArgs - Number of integer arguments that follow
+
+  Returns:
+    None.
+
+  Remarks:
+    Can be called from interrupts.
+*/
+
+void SYS_TLOG_Write( uint32_t id, uint32_t nArgs, ... );
+
+// *****************************************************************************
+/* Macro:
+    SYS_TLOG( format, ... )
+
+  Summary:
+    Logs a message without formatting it on the device.
+
+  Description:
+    The format follows the printf convention. Up to SYS_TLOG_ARGS_MAX
+    arguments of at most 32 bits are supported. %s cannot be used because
+    the host has no access to strings in device memory.
+
+  Example:
+    <code>
+    SYS_TLOG("DRV new heartrate %d", heartRate);
+    </code>
+
+  Remarks:
+    Compiles to no code when SYS_TLOG_ENABLE is 0. More than
+    SYS_TLOG_ARGS_MAX arguments fail to compile in both cases.
+*/
+
+// DOM-IGNORE-BEGIN
+#define _SYS_TLOG_NARGS(...)                                            _SYS_TLOG_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define _SYS_TLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...)    N
+
+#define _SYS_TLOG_NARGS_CHECK(...)                                                              \
+    _Static_assert(_SYS_TLOG_NARGS(__VA_ARGS__) <= SYS_TLOG_ARGS_MAX, "SYS_TLOG takes at most SYS_TLOG_ARGS_MAX arguments")
+// DOM-IGNORE-END
+
+#if (SYS_TLOG_ENABLE == 1)
+#define SYS_TLOG(format, ...)                                                                   \
+    do                                                                                          \
+    {                                                                                           \
+        _SYS_TLOG_NARGS_CHECK(__VA_ARGS__);                                                     \
+        static const char _sysTlogFormat[] __attribute__((section(".tlog"), used)) = format;    \
+        SYS_TLOG_Write((uint32_t)(uintptr_t)_sysTlogFormat, _SYS_TLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__); \
+    } while (0)
+#else
+#define SYS_TLOG(format, ...)                                                                   \
+    do                                                                                          \
+    {                                                                                           \
+        _SYS_TLOG_NARGS_CHECK(__VA_ARGS__);                                                     \
+    } while (0)
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_TLOG_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -73,9 +73,21 @@ void SYS_Tasks ( void )
 {
     /* Maintain system services */
     
+SYS_CONSOLE_Tasks(sysObj.sysConsole0);
+
 SYS_CMD_Tasks();
 
+SYS_TLOG_Tasks();
+
 DRV_HEARTRATE_TASKS(sysObj.drvHeartRate0);
+
+SYS_TELEMETRY_Tasks();
+
+SYS_LOOPBACK_Tasks();
+
+SYS_FLASHLOG_Tasks();
+
+SYS_CFG_Tasks();
     /* Maintain Device Drivers */
     
 
@@ -86,6 +98,8 @@ DRV_HEARTRATE_TASKS(sysObj.drvHeartRate0);
         /* Call Application task APP. */
     APP_Tasks();
 
+    /* Sleep until the next interrupt once all tasks are idle */
+    SYS_POWER_Tasks();
 
 
 
@@ -43,6 +43,15 @@ extern "C" {
 #define NO_INIT        __attribute__((section(".no_init")))
 #define SECTION(a)     __attribute__((__section__(a)))
 
+/* Executes a function from SRAM to avoid the flash wait states. Define
+ * RAMFUNC_DISABLE on the compiler command line to link them to flash, for
+ * example to compare the SYS_PROFILE cycle counts of both builds */
+#ifndef RAMFUNC_DISABLE
+#define RAMFUNC        __attribute__((section(".ramfunc"), long_call, noinline))
+#else
+#define RAMFUNC
+#endif
+
 #define CACHE_LINE_SIZE    (4u)
 #define CACHE_ALIGN
 
@@ -0,0 +1,189 @@
+/*******************************************************************************
+  Formatter benchmark
+
+  File Name:
+    fmtbench.c
+
+  Summary:
+    Host benchmark of SYS_FMT_Snprintf against the C library snprintf.
+
+  Description:
+    Formats the strings printed by the firmware with both implementations,
+    checks that the output is identical and prints the time per call, the
+    fastest of FMTBENCH_RUNS runs of each, taken in turn. Exits with a non
+    zero status if any output differs.
+
+    Against glibc the heartrate and power cases, one or two decimal
+    conversions in plain text, are about 1.5x to 1.7x faster. Padding, hex
+    and string are about 1.8x to 2x faster. The host numbers say little
+    about newlib on the Cortex-M0+, use the "bench" command on the target,
+    "fmt frame" against "snprintf frame" built with SYS_BENCH_LIBC_COMPARE
+    set to 1. The newlib formatted output is not linked as long as nothing
+    else calls it.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "system/fmt/sys_fmt.h"
+
+#define FMTBENCH_BUFFER_SIZE    200
+#define FMTBENCH_ITERATIONS     200000UL
+#define FMTBENCH_RUNS           15
+
+typedef enum
+{
+    FMTBENCH_CASE_HEARTRATE = 0,
+    FMTBENCH_CASE_POWER,
+    FMTBENCH_CASE_PADDING,
+    FMTBENCH_CASE_HEX,
+    FMTBENCH_CASE_STRING,
+    FMTBENCH_CASE_MAX
+} FMTBENCH_CASE;
+
+static const char * const caseNames[FMTBENCH_CASE_MAX] =
+{
+    "heartrate",
+    "power",
+    "padding",
+    "hex",
+    "string",
+};
+
+typedef int (*FMTBENCH_FORMATTER)(char *buffer, size_t size, FMTBENCH_CASE id, unsigned long i);
+
+static int libcFormat(char *buffer, size_t size, FMTBENCH_CASE id, unsigned long i)
+{
+    switch (id)
+    {
+        case FMTBENCH_CASE_HEARTRATE:
+            return snprintf(buffer, size, "DRV new heartrate %d \r\n", (int)(i % 200U));
+        case FMTBENCH_CASE_POWER:
+            return snprintf(buffer, size, "\r\nstandby : %lu entered, %lu exited", i, i + 1U);
+        case FMTBENCH_CASE_PADDING:
+            return snprintf(buffer, size, "[%5d] [%-5u] [%05d] [%c]", -(int)(i % 1000U), (unsigned)(i % 77U), (int)(i % 123U), 'a' + (int)(i % 26U));
+        case FMTBENCH_CASE_HEX:
+            return snprintf(buffer, size, "0x%08lX %x", i * 2654435761UL & 0xFFFFFFFFUL, (unsigned)(i & 0xFFFFU));
+        default:
+            return snprintf(buffer, size, "%s: %s %% %-8s|", "cmd", (i & 1U) ? "ok" : "failed", "x");
+    }
+}
+
+static int fmtFormat(char *buffer, size_t size, FMTBENCH_CASE id, unsigned long i)
+{
+    switch (id)
+    {
+        case FMTBENCH_CASE_HEARTRATE:
+            return (int)SYS_FMT_Snprintf(buffer, size, "DRV new heartrate %d \r\n", (int)(i % 200U));
+        case FMTBENCH_CASE_POWER:
+            return (int)SYS_FMT_Snprintf(buffer, size, "\r\nstandby : %lu entered, %lu exited", i, i + 1U);
+        case FMTBENCH_CASE_PADDING:
+            return (int)SYS_FMT_Snprintf(buffer, size, "[%5d] [%-5u] [%05d] [%c]", -(int)(i % 1000U), (unsigned)(i % 77U), (int)(i % 123U), 'a' + (int)(i % 26U));
+        case FMTBENCH_CASE_HEX:
+            return (int)SYS_FMT_Snprintf(buffer, size, "0x%08lX %x", i * 2654435761UL & 0xFFFFFFFFUL, (unsigned)(i & 0xFFFFU));
+        default:
+            return (int)SYS_FMT_Snprintf(buffer, size, "%s: %s %% %-8s|", "cmd", (i & 1U) ? "ok" : "failed", "x");
+    }
+}
+
+static double runNs(FMTBENCH_FORMATTER formatter, FMTBENCH_CASE id)
+{
+    char buffer[FMTBENCH_BUFFER_SIZE];
+    struct timespec start;
+    struct timespec end;
+    volatile int sink = 0;
+    unsigned long i;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < FMTBENCH_ITERATIONS; i++)
+    {
+        sink += formatter(buffer, sizeof(buffer), id, i);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    (void)sink;
+
+    return ((double)(end.tv_sec - start.tv_sec) * 1e9) + (double)(end.tv_nsec - start.tv_nsec);
+}
+
+/* The runs of both formatters alternate, so that a change of the machine
+ * load during the measurement hits both alike */
+static void elapsedNs(FMTBENCH_CASE id, double *libcNs, double *fmtNs)
+{
+    double libcFastest = 0.0;
+    double fmtFastest = 0.0;
+    double ns;
+    int run;
+
+    for (run = 0; run < FMTBENCH_RUNS; run++)
+    {
+        ns = runNs(libcFormat, id);
+        if ((run == 0) || (ns < libcFastest))
+        {
+            libcFastest = ns;
+        }
+
+        ns = runNs(fmtFormat, id);
+        if ((run == 0) || (ns < fmtFastest))
+        {
+            fmtFastest = ns;
+        }
+    }
+
+    *libcNs = libcFastest / (double)FMTBENCH_ITERATIONS;
+    *fmtNs = fmtFastest / (double)FMTBENCH_ITERATIONS;
+}
+
+static int verify(FMTBENCH_CASE id)
+{
+    char expected[FMTBENCH_BUFFER_SIZE];
+    char actual[FMTBENCH_BUFFER_SIZE];
+    char small[8];
+    unsigned long i;
+    int lenExpected;
+    int lenActual;
+
+    for (i = 0; i < 5000UL; i += 7UL)
+    {
+        lenExpected = libcFormat(expected, sizeof(expected), id, i);
+        lenActual = fmtFormat(actual, sizeof(actual), id, i);
+
+        if ((lenExpected != lenActual) || (strcmp(expected, actual) != 0))
+        {
+            fprintf(stderr, "%s: mismatch at %lu: \"%s\" (%d) != \"%s\" (%d)\n", caseNames[id], i, actual, lenActual, expected, lenExpected);
+            return 1;
+        }
+
+        /* Truncation must keep the terminating zero and the full length */
+        lenActual = fmtFormat(small, sizeof(small), id, i);
+        if ((lenActual != lenExpected) || (strncmp(small, expected, sizeof(small) - 1U) != 0) || (small[sizeof(small) - 1U] != '\0'))
+        {
+            fprintf(stderr, "%s: truncation mismatch at %lu\n", caseNames[id], i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    double libcNs;
+    double fmtNs;
+    int failures = 0;
+    int id;
+
+    printf("%-10s %12s %12s %8s\n", "case", "libc ns", "sys_fmt ns", "speedup");
+
+    for (id = 0; id < (int)FMTBENCH_CASE_MAX; id++)
+    {
+        failures += verify((FMTBENCH_CASE)id);
+
+        elapsedNs((FMTBENCH_CASE)id, &libcNs, &fmtNs);
+
+        printf("%-10s %12.1f %12.1f %7.2fx\n", caseNames[id], libcNs, fmtNs, libcNs / fmtNs);
+    }
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Regenerate the hr9cap replay corpus.
+
+Writes sensor streams in the Heart Rate 9 output format
+"15;<ch0>;<ch1>;<ch2>;<hr>;\\r\\n" at the 100 Hz frame rate:
+
+    clean.txt   every frame intact
+    noisy.txt   the same stream with dropped bytes, flipped bits,
+                truncated frames and bursts of line noise
+    console.txt console output captured alongside the sensor stream
+
+The random generator is seeded, running the script again gives the same
+files.
+
+Usage:
+    mkcorpus.py [directory]
+"""
+
+import math
+import os
+import random
+import sys
+
+FRAMES = 2000
+RATE_HZ = 100
+
+
+def frames():
+    """Return the clean frames as a list of bytes objects."""
+    out = []
+    for i in range(FRAMES):
+        t = i / RATE_HZ
+        bpm = 72 + 8 * math.sin(2 * math.pi * t / 15)
+        phase = 2 * math.pi * bpm / 60 * t
+        pulse = math.sin(phase) + 0.4 * math.sin(2 * phase + 0.8)
+        ch = [int(base + amp * pulse + random.gauss(0, 40))
+              for base, amp in ((98000, 900), (121000, 1300), (14500, 300))]
+        # The sensor reports 0 until its algorithm has settled
+        hr = 0 if i < 500 else int(round(bpm))
+        out.append(b"15;%d;%d;%d;%d;\r\n" % (ch[0], ch[1], ch[2], hr))
+    return out
+
+
+def corrupt(stream):
+    """Apply the faults seen on a noisy line, one every ~40 frames."""
+    out = []
+    for frame in stream:
+        fault = random.randrange(40)
+        frame = bytearray(frame)
+        if fault == 0:
+            del frame[random.randrange(len(frame))]
+        elif fault == 1:
+            pos = random.randrange(len(frame))
+            frame[pos] ^= 1 << random.randrange(7)
+        elif fault == 2:
+            frame = frame[:random.randrange(3, len(frame) - 3)]
+        elif fault == 3:
+            frame += bytes(random.randrange(256) for _ in range(random.randrange(1, 24)))
+        out.append(bytes(frame))
+    return out
+
+
+def console():
+    lines = []
+    for second in range(FRAMES // RATE_HZ):
+        if second >= 5:
+            lines.append(b"I app: heart rate %d\r\n" % (72 + second % 5))
+        if second % 10 == 9:
+            lines.append(b"W hr: 3 frames skipped\r\n")
+    return lines
+
+
+def main():
+    directory = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    random.seed(9)
+    clean = frames()
+    noisy = corrupt(clean)
+    for name, data in (("clean.txt", clean), ("noisy.txt", noisy), ("console.txt", console())):
+        with open(os.path.join(directory, name), "wb") as f:
+            f.write(b"".join(data))
+
+
+if __name__ == "__main__":
+    main()
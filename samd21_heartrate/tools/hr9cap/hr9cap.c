@@ -0,0 +1,694 @@
+/*******************************************************************************
+  Heart Rate 9 capture tool
+
+  File Name:
+    hr9cap.c
+
+  Summary:
+    Captures and decodes the Heart Rate 9 sensor stream and the console.
+
+  Description:
+    Reads the raw sensor stream tapped from the SERCOM0 line, and optionally
+    the SERCOM3 console output, from serial ports or capture files. Sensor
+    frames are decoded with the firmware frame parser and written as CSV or
+    fixed size binary records. Malformed frames, parser resynchronisations
+    and timing gaps are counted, and a throughput and loss report is printed
+    to stderr when the input ends or on SIGINT.
+
+    Serial ports are read in raw mode and stamped with the host monotonic
+    clock. Files are stamped with the time the bytes would take on the wire
+    at the configured baud rate, so a replayed file decodes the same way on
+    every run.
+
+    With --bench the sensor file is decoded in memory the given number of
+    times and only the decoder speed is reported.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "driver/heartrate/src/drv_heartrate_frame.h"
+
+#define HR9CAP_READ_SIZE            4096U
+#define HR9CAP_DEFAULT_BAUD         115200UL
+#define HR9CAP_DEFAULT_PERIOD_US    10000UL
+#define HR9CAP_DEFAULT_GAP_US       50000UL
+#define HR9CAP_DEFAULT_TRAILER      2UL
+
+/* Binary output: file header followed by fixed size little endian records */
+#define HR9CAP_BIN_MAGIC            "HR9C"
+#define HR9CAP_BIN_VERSION          1U
+#define HR9CAP_BIN_RECORD_SIZE      28U
+
+typedef enum
+{
+    HR9CAP_FORMAT_NONE = 0,
+    HR9CAP_FORMAT_CSV,
+    HR9CAP_FORMAT_BIN,
+} HR9CAP_FORMAT;
+
+typedef struct
+{
+    const char     *sensorPath;
+    const char     *consolePath;
+    const char     *outputPath;
+    const char     *consoleLogPath;
+    HR9CAP_FORMAT   format;
+    unsigned long   baud;
+    unsigned long   periodUs;
+    unsigned long   gapUs;
+    unsigned long   trailer;
+    unsigned long   benchPasses;
+    int             quiet;
+} HR9CAP_OPTIONS;
+
+typedef struct
+{
+    int                         fd;
+    int                         isSerial;
+    uint64_t                    bytes;
+    DRV_HEARTRATE_FRAME_PARSER  parser;
+
+    /* Parser counters at the end of the previous frame */
+    uint32_t                    lastSkipped;
+    uint32_t                    lastHeaderErrors;
+    /* Bytes consumed since the previous frame ended */
+    uint64_t                    frameBytes;
+    uint64_t                    lastTimeUs;
+
+    uint64_t                    frames;
+    uint64_t                    cleanFrameBytes;
+    uint64_t                    cleanFrames;
+    uint64_t                    malformed;
+    uint64_t                    resyncs;
+    uint64_t                    gaps;
+    uint64_t                    lost;
+    uint64_t                    decodeNs;
+} HR9CAP_SENSOR;
+
+typedef struct
+{
+    int         fd;
+    int         isSerial;
+    uint64_t    bytes;
+    uint64_t    lines;
+    int         lineStart;
+} HR9CAP_CONSOLE;
+
+static volatile sig_atomic_t stopRequested;
+
+static void onSignal(int sig)
+{
+    (void)sig;
+    stopRequested = 1;
+}
+
+static uint64_t monotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static speed_t baudToSpeed(unsigned long baud)
+{
+    switch (baud)
+    {
+        case 9600UL:    return B9600;
+        case 19200UL:   return B19200;
+        case 38400UL:   return B38400;
+        case 57600UL:   return B57600;
+        case 115200UL:  return B115200;
+        case 230400UL:  return B230400;
+        case 460800UL:  return B460800;
+        case 921600UL:  return B921600;
+        default:        return B0;
+    }
+}
+
+/* Opens a capture file, stdin for "-", or a serial port in raw mode */
+static int openSource(const char *path, unsigned long baud, int *isSerial)
+{
+    struct termios tio;
+    speed_t speed;
+    int fd;
+
+    *isSerial = 0;
+
+    if (strcmp(path, "-") == 0)
+    {
+        return STDIN_FILENO;
+    }
+
+    fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "hr9cap: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    if (isatty(fd) && (tcgetattr(fd, &tio) == 0))
+    {
+        speed = baudToSpeed(baud);
+        if (speed == B0)
+        {
+            fprintf(stderr, "hr9cap: unsupported baud rate %lu\n", baud);
+            close(fd);
+            return -1;
+        }
+
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cc[VMIN] = 1;
+        tio.c_cc[VTIME] = 0;
+
+        if (tcsetattr(fd, TCSANOW, &tio) != 0)
+        {
+            fprintf(stderr, "hr9cap: %s: %s\n", path, strerror(errno));
+            close(fd);
+            return -1;
+        }
+
+        tcflush(fd, TCIFLUSH);
+        *isSerial = 1;
+    }
+
+    return fd;
+}
+
+static void put16(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+}
+
+static void put32(uint8_t *dst, uint32_t value)
+{
+    put16(dst, value);
+    put16(&dst[2], value >> 16);
+}
+
+static void writeHeader(FILE *out, HR9CAP_FORMAT format)
+{
+    uint8_t header[8];
+
+    if (format == HR9CAP_FORMAT_CSV)
+    {
+        fputs("index,time_us,ch0,ch1,ch2,hr,quality,lost\n", out);
+    }
+    else if (format == HR9CAP_FORMAT_BIN)
+    {
+        memcpy(header, HR9CAP_BIN_MAGIC, 4U);
+        put16(&header[4], HR9CAP_BIN_VERSION);
+        put16(&header[6], HR9CAP_BIN_RECORD_SIZE);
+        fwrite(header, sizeof(header), 1U, out);
+    }
+}
+
+static void writeFrame(FILE *out, HR9CAP_FORMAT format, uint64_t index, uint64_t timeUs, const DRV_HEARTRATE_FRAME *frame, uint64_t lost)
+{
+    uint8_t record[HR9CAP_BIN_RECORD_SIZE];
+    uint32_t channel;
+
+    if (format == HR9CAP_FORMAT_CSV)
+    {
+        fprintf(out, "%llu,%llu,%lu,%lu,%lu,%u,%u,%llu\n", (unsigned long long)index, (unsigned long long)timeUs,
+            (unsigned long)frame->channel[0], (unsigned long)frame->channel[1], (unsigned long)frame->channel[2],
+            (unsigned)frame->heartRate, (unsigned)frame->quality, (unsigned long long)lost);
+    }
+    else if (format == HR9CAP_FORMAT_BIN)
+    {
+        /* index(4) time_us(8) ch[3](12) hr(1) quality(1) lost(2) */
+        put32(&record[0], (uint32_t)index);
+        put32(&record[4], (uint32_t)timeUs);
+        put32(&record[8], (uint32_t)(timeUs >> 32));
+        for (channel = 0U; channel < DRV_HEARTRATE_FRAME_CHANNELS; channel++)
+        {
+            put32(&record[12U + (channel * 4U)], frame->channel[channel]);
+        }
+        record[24] = frame->heartRate;
+        record[25] = frame->quality;
+        put16(&record[26], (lost > 0xFFFFU) ? 0xFFFFU : (uint32_t)lost);
+        fwrite(record, sizeof(record), 1U, out);
+    }
+}
+
+/* Mean length of the intact frames seen so far */
+static uint64_t meanFrameLength(const HR9CAP_SENSOR *sensor, uint64_t length)
+{
+    return (sensor->cleanFrames != 0U) ? (sensor->cleanFrameBytes / sensor->cleanFrames) : length;
+}
+
+/* Decodes a chunk of sensor bytes that all arrived at timeUs */
+static void decodeSensor(HR9CAP_SENSOR *sensor, const HR9CAP_OPTIONS *options, FILE *out, const uint8_t *data, size_t size, uint64_t timeUs, int wireTime)
+{
+    const DRV_HEARTRATE_FRAME_PARSER *parser = &sensor->parser;
+    uint64_t start = monotonicNs();
+    uint64_t skipped;
+    uint64_t length;
+    uint64_t mean;
+    uint64_t expected;
+    uint64_t lost;
+    size_t used;
+    int merged;
+    bool complete;
+
+    while (size != 0U)
+    {
+        used = DRV_HEARTRATE_FrameParse(&sensor->parser, data, size, &complete);
+        data += used;
+        size -= used;
+        sensor->bytes += used;
+        sensor->frameBytes += used;
+
+        if (complete == false)
+        {
+            continue;
+        }
+
+        if (wireTime != 0)
+        {
+            timeUs = (sensor->bytes * 10000000ULL) / options->baud;
+        }
+
+        skipped = parser->skippedBytes - sensor->lastSkipped;
+        length = sensor->frameBytes - skipped;
+        mean = meanFrameLength(sensor, length);
+        merged = 0;
+        lost = 0U;
+
+        /* Bytes before the first frame are the tail of an earlier one */
+        if (sensor->frames != 0U)
+        {
+            if ((skipped > options->trailer) || (parser->headerErrors != sensor->lastHeaderErrors))
+            {
+                sensor->resyncs++;
+            }
+
+            /* Everything received since the previous frame, in frames */
+            expected = (sensor->frameBytes + (mean / 2U)) / mean;
+            lost = (expected > 1U) ? (expected - 1U) : 0U;
+
+            /* A frame cut short runs into the next one, the parser reads
+               both as a single long frame */
+            if (length > (mean + (mean / 2U)))
+            {
+                merged = 1;
+                lost = (lost == 0U) ? 1U : lost;
+            }
+
+            if ((timeUs - sensor->lastTimeUs) > options->gapUs)
+            {
+                sensor->gaps++;
+                expected = ((timeUs - sensor->lastTimeUs) + (options->periodUs / 2U)) / options->periodUs;
+                lost = ((expected - 1U) > lost) ? (expected - 1U) : lost;
+            }
+        }
+
+        if ((merged != 0) || ((parser->frame.quality & (DRV_HEARTRATE_FRAME_QUALITY_NON_DIGIT | DRV_HEARTRATE_FRAME_QUALITY_OVERFLOW)) != 0U))
+        {
+            sensor->malformed++;
+        }
+        else if (lost == 0U)
+        {
+            sensor->cleanFrames++;
+            sensor->cleanFrameBytes += length;
+        }
+
+        sensor->lost += lost;
+
+        if (out != NULL)
+        {
+            writeFrame(out, options->format, sensor->frames, timeUs, &parser->frame, lost);
+        }
+
+        sensor->frames++;
+        sensor->frameBytes = 0U;
+        sensor->lastTimeUs = timeUs;
+        sensor->lastSkipped = parser->skippedBytes;
+        sensor->lastHeaderErrors = parser->headerErrors;
+    }
+
+    sensor->decodeNs += monotonicNs() - start;
+}
+
+/* Copies console output to the log, each line prefixed with the host time */
+static void logConsole(HR9CAP_CONSOLE *console, FILE *log, const uint8_t *data, size_t size, uint64_t timeUs)
+{
+    size_t index;
+
+    console->bytes += size;
+
+    for (index = 0U; index < size; index++)
+    {
+        if ((console->lineStart != 0) && (log != NULL))
+        {
+            fprintf(log, "[%llu.%06llu] ", (unsigned long long)(timeUs / 1000000U), (unsigned long long)(timeUs % 1000000U));
+        }
+        console->lineStart = (data[index] == (uint8_t)'\n');
+        console->lines += (uint64_t)console->lineStart;
+
+        if (log != NULL)
+        {
+            fputc(data[index], log);
+        }
+    }
+}
+
+static void report(const HR9CAP_SENSOR *sensor, const HR9CAP_CONSOLE *console, double seconds)
+{
+    uint64_t expected = sensor->frames + sensor->lost;
+
+    if (seconds <= 0.0)
+    {
+        seconds = 1e-9;
+    }
+
+    fprintf(stderr, "sensor:  %llu bytes, %llu frames in %.3f s (%.1f kB/s, %.1f frames/s)\n",
+        (unsigned long long)sensor->bytes, (unsigned long long)sensor->frames, seconds,
+        ((double)sensor->bytes / 1000.0) / seconds, (double)sensor->frames / seconds);
+    fprintf(stderr, "         %llu malformed, %llu resyncs (%lu bytes skipped, %lu bad headers), %llu gaps\n",
+        (unsigned long long)sensor->malformed, (unsigned long long)sensor->resyncs,
+        (unsigned long)sensor->parser.skippedBytes, (unsigned long)sensor->parser.headerErrors,
+        (unsigned long long)sensor->gaps);
+    fprintf(stderr, "         %llu frames lost (%.3f %%)\n", (unsigned long long)sensor->lost,
+        (expected != 0U) ? ((double)sensor->lost * 100.0) / (double)expected : 0.0);
+    fprintf(stderr, "decode:  %.1f MB/s including output\n",
+        (sensor->decodeNs != 0U) ? ((double)sensor->bytes * 1000.0) / (double)sensor->decodeNs : 0.0);
+
+    if (console->fd >= 0)
+    {
+        fprintf(stderr, "console: %llu bytes, %llu lines (%.1f kB/s)\n", (unsigned long long)console->bytes,
+            (unsigned long long)console->lines, ((double)console->bytes / 1000.0) / seconds);
+    }
+}
+
+static int bench(const HR9CAP_OPTIONS *options)
+{
+    HR9CAP_SENSOR sensor;
+    uint8_t *data = NULL;
+    size_t size = 0U;
+    size_t capacity = 0U;
+    ssize_t count;
+    unsigned long pass;
+    uint64_t frames = 0U;
+    uint64_t start;
+    double ns;
+    int isSerial;
+    int fd;
+
+    fd = openSource(options->sensorPath, options->baud, &isSerial);
+    if (fd < 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    do
+    {
+        if (size == capacity)
+        {
+            capacity = (capacity == 0U) ? 65536U : (capacity * 2U);
+            data = realloc(data, capacity);
+            if (data == NULL)
+            {
+                fprintf(stderr, "hr9cap: out of memory\n");
+                return EXIT_FAILURE;
+            }
+        }
+        count = read(fd, &data[size], capacity - size);
+        if (count > 0)
+        {
+            size += (size_t)count;
+        }
+    } while (count > 0);
+
+    if (fd != STDIN_FILENO)
+    {
+        close(fd);
+    }
+
+    start = monotonicNs();
+    for (pass = 0U; pass < options->benchPasses; pass++)
+    {
+        memset(&sensor, 0, sizeof(sensor));
+        DRV_HEARTRATE_FrameParserReset(&sensor.parser);
+        decodeSensor(&sensor, options, NULL, data, size, 0U, 1);
+        frames += sensor.frames;
+    }
+    ns = (double)(monotonicNs() - start);
+
+    printf("%s: %lu passes, %zu bytes, %llu frames per pass, %.1f ns/frame, %.1f MB/s\n",
+        options->sensorPath, options->benchPasses, size, (unsigned long long)sensor.frames,
+        (frames != 0U) ? ns / (double)frames : 0.0,
+        (ns > 0.0) ? ((double)size * (double)options->benchPasses * 1000.0) / ns : 0.0);
+
+    free(data);
+
+    return EXIT_SUCCESS;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: hr9cap [options] <sensor port or file>\n"
+        "  -o, --output FILE      write decoded frames to FILE (- for stdout)\n"
+        "  -f, --format csv|bin   output format, default csv\n"
+        "  -c, --console PATH     also capture the console port or file\n"
+        "  -l, --console-log FILE write the console capture with host timestamps\n"
+        "  -b, --baud RATE        serial baud rate, default %lu\n"
+        "  -p, --period US        nominal frame period, default %lu\n"
+        "  -g, --gap US           frame interval counted as a gap, default %lu\n"
+        "  -t, --trailer BYTES    bytes allowed between frames, default %lu\n"
+        "  -q, --quiet            no report\n"
+        "      --bench PASSES     decode the sensor file PASSES times and report the speed\n",
+        HR9CAP_DEFAULT_BAUD, HR9CAP_DEFAULT_PERIOD_US, HR9CAP_DEFAULT_GAP_US, HR9CAP_DEFAULT_TRAILER);
+}
+
+static int parseOptions(int argc, char **argv, HR9CAP_OPTIONS *options)
+{
+    static const struct option longOptions[] =
+    {
+        { "output",      required_argument, NULL, 'o' },
+        { "format",      required_argument, NULL, 'f' },
+        { "console",     required_argument, NULL, 'c' },
+        { "console-log", required_argument, NULL, 'l' },
+        { "baud",        required_argument, NULL, 'b' },
+        { "period",      required_argument, NULL, 'p' },
+        { "gap",         required_argument, NULL, 'g' },
+        { "trailer",     required_argument, NULL, 't' },
+        { "quiet",       no_argument,       NULL, 'q' },
+        { "bench",       required_argument, NULL, 'B' },
+        { NULL,          0,                 NULL, 0   },
+    };
+    int option;
+
+    memset(options, 0, sizeof(*options));
+    options->format = HR9CAP_FORMAT_CSV;
+    options->baud = HR9CAP_DEFAULT_BAUD;
+    options->periodUs = HR9CAP_DEFAULT_PERIOD_US;
+    options->gapUs = HR9CAP_DEFAULT_GAP_US;
+    options->trailer = HR9CAP_DEFAULT_TRAILER;
+
+    while ((option = getopt_long(argc, argv, "o:f:c:l:b:p:g:t:q", longOptions, NULL)) != -1)
+    {
+        switch (option)
+        {
+            case 'o': options->outputPath = optarg; break;
+            case 'c': options->consolePath = optarg; break;
+            case 'l': options->consoleLogPath = optarg; break;
+            case 'b': options->baud = strtoul(optarg, NULL, 0); break;
+            case 'p': options->periodUs = strtoul(optarg, NULL, 0); break;
+            case 'g': options->gapUs = strtoul(optarg, NULL, 0); break;
+            case 't': options->trailer = strtoul(optarg, NULL, 0); break;
+            case 'q': options->quiet = 1; break;
+            case 'B': options->benchPasses = strtoul(optarg, NULL, 0); break;
+            case 'f':
+                if (strcmp(optarg, "csv") == 0)
+                {
+                    options->format = HR9CAP_FORMAT_CSV;
+                }
+                else if (strcmp(optarg, "bin") == 0)
+                {
+                    options->format = HR9CAP_FORMAT_BIN;
+                }
+                else
+                {
+                    usage();
+                    return -1;
+                }
+                break;
+            default:
+                usage();
+                return -1;
+        }
+    }
+
+    if ((optind != (argc - 1)) || (options->baud == 0U) || (options->periodUs == 0U))
+    {
+        usage();
+        return -1;
+    }
+
+    options->sensorPath = argv[optind];
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    HR9CAP_OPTIONS options;
+    HR9CAP_SENSOR sensor;
+    HR9CAP_CONSOLE console;
+    struct pollfd fds[2];
+    uint8_t buffer[HR9CAP_READ_SIZE];
+    FILE *out = NULL;
+    FILE *log = NULL;
+    uint64_t startNs;
+    uint64_t timeUs;
+    ssize_t count;
+    nfds_t nfds;
+    nfds_t i;
+
+    if (parseOptions(argc, argv, &options) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (options.benchPasses != 0U)
+    {
+        return bench(&options);
+    }
+
+    memset(&sensor, 0, sizeof(sensor));
+    memset(&console, 0, sizeof(console));
+    DRV_HEARTRATE_FrameParserReset(&sensor.parser);
+    console.fd = -1;
+    console.lineStart = 1;
+
+    sensor.fd = openSource(options.sensorPath, options.baud, &sensor.isSerial);
+    if (sensor.fd < 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (options.consolePath != NULL)
+    {
+        console.fd = openSource(options.consolePath, options.baud, &console.isSerial);
+        if (console.fd < 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.outputPath != NULL)
+    {
+        out = (strcmp(options.outputPath, "-") == 0) ? stdout : fopen(options.outputPath, "wb");
+        if (out == NULL)
+        {
+            fprintf(stderr, "hr9cap: %s: %s\n", options.outputPath, strerror(errno));
+            return EXIT_FAILURE;
+        }
+        writeHeader(out, options.format);
+    }
+
+    if (options.consoleLogPath != NULL)
+    {
+        log = fopen(options.consoleLogPath, "w");
+        if (log == NULL)
+        {
+            fprintf(stderr, "hr9cap: %s: %s\n", options.consoleLogPath, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    fds[0].fd = sensor.fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = console.fd;
+    fds[1].events = POLLIN;
+    nfds = (console.fd >= 0) ? 2U : 1U;
+
+    startNs = monotonicNs();
+
+    while ((stopRequested == 0) && ((fds[0].fd >= 0) || (fds[1].fd >= 0)))
+    {
+        if (poll(fds, nfds, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            fprintf(stderr, "hr9cap: poll: %s\n", strerror(errno));
+            break;
+        }
+
+        for (i = 0U; i < nfds; i++)
+        {
+            if ((fds[i].fd < 0) || ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0))
+            {
+                continue;
+            }
+
+            count = read(fds[i].fd, buffer, sizeof(buffer));
+            if (count <= 0)
+            {
+                if ((count < 0) && (errno == EINTR))
+                {
+                    continue;
+                }
+                /* End of file, or the port went away */
+                fds[i].fd = -1;
+                continue;
+            }
+
+            timeUs = (monotonicNs() - startNs) / 1000U;
+
+            if (i == 0U)
+            {
+                decodeSensor(&sensor, &options, out, buffer, (size_t)count, timeUs, !sensor.isSerial);
+            }
+            else
+            {
+                logConsole(&console, log, buffer, (size_t)count, console.isSerial ? timeUs : ((console.bytes * 10000000ULL) / options.baud));
+            }
+        }
+    }
+
+    if ((out != NULL) && (out != stdout))
+    {
+        fclose(out);
+    }
+    else if (out != NULL)
+    {
+        fflush(out);
+    }
+
+    if (log != NULL)
+    {
+        fclose(log);
+    }
+
+    if (options.quiet == 0)
+    {
+        /* Files are reported over their wire time rather than the read time */
+        report(&sensor, &console, sensor.isSerial ? (double)(monotonicNs() - startNs) / 1e9
+                                                  : (double)(sensor.bytes * 10U) / (double)options.baud);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,326 @@
+/*******************************************************************************
+  Heart rate series codec benchmark
+
+  File Name:
+    hrcodecbench.c
+
+  Summary:
+    Host benchmark of the SYS_HRCODEC block codec on heart rate series.
+
+  Description:
+    Encodes heart rate series into blocks the size of a flash log record and
+    of an uplink frame, decodes them back, checks that every sample is
+    restored and prints the compression ratio against the 8 byte record the
+    flash log used before and the time per sample.
+
+    The series are a synthetic day of measurement windows and, for every
+    CSV file given on the command line, the frames decoded by hr9cap. Each
+    series is coded twice: with RTC ticks and with the whole seconds the
+    application logs. Exits with a non zero status if a series does not
+    decode to its input.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "system/hrcodec/sys_hrcodec.h"
+
+#define HRCODECBENCH_RECORD_SIZE        8U
+#define HRCODECBENCH_FLASH_BLOCK        56U
+#define HRCODECBENCH_UPLINK_BLOCK       240U
+#define HRCODECBENCH_RTC_FREQUENCY      1024U
+#define HRCODECBENCH_PASSES_DEFAULT     20U
+
+/* Synthetic day, same windows as the driver configuration */
+#define HRCODECBENCH_DAY_MS             (24UL * 3600UL * 1000UL)
+#define HRCODECBENCH_PERIOD_MS          300000UL
+#define HRCODECBENCH_WINDOW_MS          30000UL
+#define HRCODECBENCH_FRAME_MS           10UL
+
+typedef struct
+{
+    SYS_HRCODEC_SAMPLE *    samples;
+
+    size_t                  count;
+
+    size_t                  capacity;
+
+} HRCODECBENCH_SERIES;
+
+typedef struct
+{
+    size_t  blocks;
+
+    /* Sum of the block lengths */
+    size_t  bytes;
+
+    double  encodeNs;
+
+    double  decodeNs;
+
+} HRCODECBENCH_RESULT;
+
+static uint8_t *blockStore;
+
+static size_t blockStoreSize;
+
+static double nowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+static void seriesAdd(HRCODECBENCH_SERIES *series, uint32_t timestamp, int32_t value)
+{
+    if (series->count == series->capacity)
+    {
+        series->capacity = (series->capacity == 0U) ? 4096U : (series->capacity * 2U);
+        series->samples = realloc(series->samples, series->capacity * sizeof(*series->samples));
+        if (series->samples == NULL)
+        {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    series->samples[series->count].timestamp = timestamp;
+    series->samples[series->count].value = value;
+    series->count++;
+}
+
+/* Heart rate wandering by one beat now and then, frames 10 ms apart with a
+   tick of jitter, as the driver reports them during its windows */
+static void seriesSynthetic(HRCODECBENCH_SERIES *series, uint32_t divider)
+{
+    uint32_t seed = 12345U;
+    int32_t heartRate = 72;
+    unsigned long window;
+    unsigned long ms;
+
+    for (window = 0; window < HRCODECBENCH_DAY_MS; window += HRCODECBENCH_PERIOD_MS)
+    {
+        for (ms = 0; ms < HRCODECBENCH_WINDOW_MS; ms += HRCODECBENCH_FRAME_MS)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            if (((seed >> 16) % 100U) < 3U)
+            {
+                heartRate += ((seed >> 8) & 1U) ? 1 : -1;
+                heartRate = (heartRate < 50) ? 50 : ((heartRate > 150) ? 150 : heartRate);
+            }
+            seriesAdd(series, (uint32_t)(((window + ms) * HRCODECBENCH_RTC_FREQUENCY / 1000UL) + ((seed >> 4) & 1U)) / divider, heartRate);
+        }
+    }
+}
+
+/* hr9cap CSV: index,time_us,ch0,ch1,ch2,hr,quality,lost. Frames without a
+   heart rate are not reported by the driver and are skipped */
+static int seriesLoad(HRCODECBENCH_SERIES *series, const char *path, uint32_t divider)
+{
+    char line[256];
+    unsigned long long timeUs;
+    unsigned long index;
+    long ch[3];
+    int heartRate;
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if ((sscanf(line, "%lu,%llu,%ld,%ld,%ld,%d", &index, &timeUs, &ch[0], &ch[1], &ch[2], &heartRate) == 6) && (heartRate > 0))
+        {
+            seriesAdd(series, (uint32_t)((timeUs * HRCODECBENCH_RTC_FREQUENCY) / 1000000ULL) / divider, heartRate);
+        }
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+static void encode(const HRCODECBENCH_SERIES *series, size_t blockSize, HRCODECBENCH_RESULT *result)
+{
+    SYS_HRCODEC_ENCODER encoder;
+    uint8_t *block = blockStore;
+    size_t i;
+
+    result->blocks = 0U;
+    result->bytes = 0U;
+
+    SYS_HRCODEC_EncoderInit(&encoder, block, blockSize);
+    for (i = 0; i < series->count; i++)
+    {
+        if (!SYS_HRCODEC_EncoderPut(&encoder, &series->samples[i]))
+        {
+            result->bytes += SYS_HRCODEC_EncoderFinish(&encoder);
+            result->blocks++;
+            block += blockSize;
+            SYS_HRCODEC_EncoderInit(&encoder, block, blockSize);
+            (void)SYS_HRCODEC_EncoderPut(&encoder, &series->samples[i]);
+        }
+    }
+    result->bytes += SYS_HRCODEC_EncoderFinish(&encoder);
+    result->blocks++;
+}
+
+static int decode(const HRCODECBENCH_SERIES *series, size_t blockSize, size_t blocks, int verify)
+{
+    SYS_HRCODEC_DECODER decoder;
+    SYS_HRCODEC_SAMPLE sample;
+    SYS_HRCODEC_DECODE_STATUS status;
+    size_t block;
+    size_t i = 0U;
+
+    for (block = 0; block < blocks; block++)
+    {
+        (void)SYS_HRCODEC_DecoderInit(&decoder, &blockStore[block * blockSize], blockSize);
+
+        while ((status = SYS_HRCODEC_DecoderGet(&decoder, &sample)) == SYS_HRCODEC_DECODE_SAMPLE)
+        {
+            if (verify && ((i >= series->count) || (sample.timestamp != series->samples[i].timestamp) || (sample.value != series->samples[i].value)))
+            {
+                fprintf(stderr, "mismatch at sample %zu of block %zu\n", i, block);
+                return 1;
+            }
+            i++;
+        }
+
+        if (status != SYS_HRCODEC_DECODE_END)
+        {
+            fprintf(stderr, "decode error in block %zu\n", block);
+            return 1;
+        }
+    }
+
+    if (i != series->count)
+    {
+        fprintf(stderr, "%zu samples decoded, %zu encoded\n", i, series->count);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int run(const char *name, const HRCODECBENCH_SERIES *series, size_t blockSize, unsigned passes)
+{
+    HRCODECBENCH_RESULT result;
+    size_t needed = ((series->count + 1U) * blockSize);
+    double start;
+    double raw = (double)series->count * HRCODECBENCH_RECORD_SIZE;
+    unsigned pass;
+    int failures = 0;
+
+    if (series->count == 0U)
+    {
+        return 0;
+    }
+
+    /* At least one sample per block */
+    if (needed > blockStoreSize)
+    {
+        blockStore = realloc(blockStore, needed);
+        blockStoreSize = needed;
+        if (blockStore == NULL)
+        {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+    }
+    memset(blockStore, 0xFF, needed);
+
+    start = nowNs();
+    for (pass = 0; pass < passes; pass++)
+    {
+        encode(series, blockSize, &result);
+    }
+    result.encodeNs = (nowNs() - start) / ((double)passes * (double)series->count);
+
+    failures += decode(series, blockSize, result.blocks, 1);
+
+    start = nowNs();
+    for (pass = 0; pass < passes; pass++)
+    {
+        failures += decode(series, blockSize, result.blocks, 0);
+    }
+    result.decodeNs = (nowNs() - start) / ((double)passes * (double)series->count);
+
+    printf("%-16s %5zu %8zu %6zu %9zu %6.2f %7.1fx ", name, blockSize, series->count, result.blocks,
+        result.bytes, (double)result.bytes / (double)series->count, raw / (double)result.bytes);
+
+    /* Flash records are padded to the block size, uplink frames are not */
+    if (blockSize == HRCODECBENCH_FLASH_BLOCK)
+    {
+        printf("%7.1fx ", raw / ((double)result.blocks * (double)blockSize));
+    }
+    else
+    {
+        printf("%8s ", "-");
+    }
+    printf("%6.1f %6.1f\n", result.encodeNs, result.decodeNs);
+
+    return failures;
+}
+
+static int runSeries(const char *name, const HRCODECBENCH_SERIES *series, unsigned passes)
+{
+    return run(name, series, HRCODECBENCH_FLASH_BLOCK, passes)
+        + run(name, series, HRCODECBENCH_UPLINK_BLOCK, passes);
+}
+
+int main(int argc, char **argv)
+{
+    HRCODECBENCH_SERIES series;
+    char name[64];
+    const char *base;
+    unsigned passes = HRCODECBENCH_PASSES_DEFAULT;
+    int failures = 0;
+    int first = 1;
+    int i;
+
+    if ((argc > 2) && (strcmp(argv[1], "-p") == 0))
+    {
+        passes = (unsigned)strtoul(argv[2], NULL, 0);
+        passes = (passes == 0U) ? 1U : passes;
+        first = 3;
+    }
+
+    printf("%-16s %5s %8s %6s %9s %6s %8s %8s %6s %6s\n", "series", "block", "samples", "blocks",
+        "bytes", "B/smp", "ratio", "padded", "enc ns", "dec ns");
+
+    memset(&series, 0, sizeof(series));
+    seriesSynthetic(&series, 1U);
+    failures += runSeries("day ticks", &series, passes);
+
+    series.count = 0U;
+    seriesSynthetic(&series, HRCODECBENCH_RTC_FREQUENCY);
+    failures += runSeries("day seconds", &series, passes);
+
+    for (i = first; i < argc; i++)
+    {
+        base = strrchr(argv[i], '/');
+        base = (base == NULL) ? argv[i] : (base + 1);
+
+        series.count = 0U;
+        failures += seriesLoad(&series, argv[i], 1U);
+        snprintf(name, sizeof(name), "%.10s ticks", base);
+        failures += runSeries(name, &series, passes);
+
+        series.count = 0U;
+        failures += seriesLoad(&series, argv[i], HRCODECBENCH_RTC_FREQUENCY);
+        snprintf(name, sizeof(name), "%.10s secs", base);
+        failures += runSeries(name, &series, passes);
+    }
+
+    free(series.samples);
+    free(blockStore);
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
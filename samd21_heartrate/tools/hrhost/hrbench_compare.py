@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Compare two hrparsebench JSON results.
+
+Cases are matched on stream, path, noise, corrupted share and chunk size.
+For every case the change of the time per byte is printed, a case is a
+regression when it is slower by more than the threshold or decodes a
+different number of frames. Cases found in one file only are listed.
+
+Usage:
+    hrbench_compare.py baseline.json candidate.json [--threshold 10]
+
+Files written by different format versions may have different synthetic
+streams, a note is printed when the versions differ.
+
+Exits with status 1 if there is a regression.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    """Return the format version and the results of a file keyed by case."""
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for result in data["results"]:
+        key = (result["stream"], result["path"], result.get("noise"),
+               result.get("corrupt"), result["chunk"])
+        results[key] = result
+    return data.get("version"), results
+
+
+def describe(key):
+    stream, path, noise, corrupt, chunk = key
+    if noise is None:
+        return "%-16s %-6s %11s %5d" % (stream, path, "-", chunk)
+    return "%-16s %-6s %5.2f %5.2f %5d" % (stream, path, noise, corrupt, chunk)
+
+
+def ns_per_byte(result):
+    return result["ns"] / result["bytes"] if result["bytes"] else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent reported as a regression")
+    args = parser.parse_args()
+
+    baseline_version, baseline = load(args.baseline)
+    candidate_version, candidate = load(args.candidate)
+    if baseline_version != candidate_version:
+        print("note: format version %s against %s, synthetic streams differ" % (
+            baseline_version, candidate_version))
+    regressions = 0
+
+    print("%-16s %-6s %11s %5s %10s %10s %8s  %s" % (
+        "stream", "path", "noise corr", "chunk", "ns/B base", "ns/B new", "change", "frames"))
+
+    for key in sorted(baseline.keys() & candidate.keys(), key=str):
+        old = baseline[key]
+        new = candidate[key]
+        old_ns = ns_per_byte(old)
+        new_ns = ns_per_byte(new)
+        change = (new_ns - old_ns) / old_ns * 100.0 if old_ns else 0.0
+        flags = []
+        if change > args.threshold:
+            flags.append("SLOWER")
+        if old["frames"] != new["frames"]:
+            flags.append("FRAMES %d -> %d" % (old["frames"], new["frames"]))
+        if flags:
+            regressions += 1
+        print("%s %10.3f %10.3f %+7.1f%%  %s" % (
+            describe(key), old_ns, new_ns, change, " ".join(flags)))
+
+    for key in sorted(baseline.keys() - candidate.keys(), key=str):
+        print("%s  only in %s" % (describe(key), args.baseline))
+    for key in sorted(candidate.keys() - baseline.keys(), key=str):
+        print("%s  only in %s" % (describe(key), args.candidate))
+
+    print("%d regression(s) above %.1f%%" % (regressions, args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
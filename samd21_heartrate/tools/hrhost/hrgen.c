@@ -0,0 +1,204 @@
+/*******************************************************************************
+  Heart Rate 9 stream generator
+
+  File Name:
+    hrgen.c
+
+  Summary:
+    Synthetic sensor stream in the Heart Rate 9 output format.
+
+  Description:
+    Channel levels and amplitudes are those of the hr9cap corpus.
+*******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "hrgen.h"
+
+#define HRGEN_PI                        3.14159265358979323846
+
+#define HRGEN_CHANNELS                  3U
+
+#define HRGEN_HEART_RATE_MIN            30.0
+#define HRGEN_HEART_RATE_MAX            220.0
+
+/* Breaths per second and baseline wander relative to the pulse amplitude */
+#define HRGEN_BREATH_HZ                 0.25
+#define HRGEN_BREATH_DEPTH              0.5
+
+/* Frame text without faults, "15;" three channels of 10 digits and the rate */
+#define HRGEN_TEXT_MAX                  64U
+
+static const double hrgenBase[HRGEN_CHANNELS]      = { 98000.0, 121000.0, 14500.0 };
+static const double hrgenAmplitude[HRGEN_CHANNELS] = { 900.0, 1300.0, 300.0 };
+
+static uint32_t _HRGEN_Random( HRGEN * gen )
+{
+    /* xorshift32 */
+    gen->random ^= gen->random << 13;
+    gen->random ^= gen->random >> 17;
+    gen->random ^= gen->random << 5;
+    return gen->random;
+}
+
+/* Uniform in [0, 1) */
+static double _HRGEN_Unit( HRGEN * gen )
+{
+    return (double)_HRGEN_Random(gen) / 4294967296.0;
+}
+
+static double _HRGEN_Gauss( HRGEN * gen )
+{
+    double u1 = _HRGEN_Unit(gen) + (1.0 / 4294967296.0);
+    double u2 = _HRGEN_Unit(gen);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * HRGEN_PI * u2);
+}
+
+/* Pulse shape over one beat, systolic peak then the dicrotic wave */
+static double _HRGEN_Pulse( double phase )
+{
+    double systolic = (phase - 0.15) / 0.06;
+    double dicrotic = (phase - 0.45) / 0.09;
+
+    return exp(-0.5 * systolic * systolic) + (0.35 * exp(-0.5 * dicrotic * dicrotic));
+}
+
+void HRGEN_ConfigDefault( HRGEN_CONFIG * config )
+{
+    memset(config, 0, sizeof(*config));
+    config->frameRateHz = 100.0;
+    config->seed = 9U;
+    config->heartRate = 72.0;
+    config->heartRateSwing = 8.0;
+    config->heartRateSwingPeriodS = 15.0;
+    config->settleS = 5.0;
+    config->channelNoise = 40.0;
+    config->burstLength = 24U;
+}
+
+void HRGEN_Initialize( HRGEN * gen, const HRGEN_CONFIG * config )
+{
+    memset(gen, 0, sizeof(*gen));
+    gen->config = *config;
+    gen->random = (config->seed != 0U) ? config->seed : 1U;
+
+    if (gen->config.burstLength > HRGEN_BURST_LENGTH_MAX)
+    {
+        gen->config.burstLength = HRGEN_BURST_LENGTH_MAX;
+    }
+    if (gen->config.lineNoise > HRGEN_LINE_NOISE_MAX)
+    {
+        gen->config.lineNoise = HRGEN_LINE_NOISE_MAX;
+    }
+    if (gen->config.frameRateHz <= 0.0)
+    {
+        gen->config.frameRateHz = 100.0;
+    }
+}
+
+size_t HRGEN_FrameNext( HRGEN * gen, uint8_t * buffer )
+{
+    const HRGEN_CONFIG *config = &gen->config;
+    double t = (double)gen->stats.frames / config->frameRateHz;
+    double pulse;
+    double wander;
+    double level;
+    unsigned long channel[HRGEN_CHANNELS];
+    unsigned long heartRate;
+    char text[HRGEN_TEXT_MAX];
+    size_t len;
+    size_t pos;
+    size_t burst;
+    uint32_t i;
+
+    /* Heart rate trajectory, the beat phase follows the instantaneous rate */
+    gen->heartRate = config->heartRate + (config->heartRateRampPerMin * t / 60.0);
+    if (config->heartRateSwingPeriodS > 0.0)
+    {
+        gen->heartRate += config->heartRateSwing * sin(2.0 * HRGEN_PI * t / config->heartRateSwingPeriodS);
+    }
+    gen->heartRate = fmin(fmax(gen->heartRate, HRGEN_HEART_RATE_MIN), HRGEN_HEART_RATE_MAX);
+
+    gen->beatPhase += gen->heartRate / 60.0 / config->frameRateHz;
+    gen->beatPhase -= floor(gen->beatPhase);
+    gen->breathPhase = fmod(gen->breathPhase + (2.0 * HRGEN_PI * HRGEN_BREATH_HZ / config->frameRateHz), 2.0 * HRGEN_PI);
+
+    pulse = _HRGEN_Pulse(gen->beatPhase);
+    wander = HRGEN_BREATH_DEPTH * sin(gen->breathPhase);
+
+    for (i = 0U; i < HRGEN_CHANNELS; i++)
+    {
+        level = hrgenBase[i] + (hrgenAmplitude[i] * (pulse + wander)) + (config->channelNoise * _HRGEN_Gauss(gen));
+        channel[i] = (level > 0.0) ? (unsigned long)level : 0UL;
+    }
+
+    heartRate = (t < config->settleS) ? 0UL : (unsigned long)lround(gen->heartRate);
+
+    len = (size_t)snprintf(text, sizeof(text), "15;%lu;%lu;%lu;%lu;\r\n", channel[0], channel[1], channel[2], heartRate);
+    memcpy(buffer, text, len);
+
+    gen->stats.frames++;
+
+    if (_HRGEN_Unit(gen) < config->bitFlipRate)
+    {
+        buffer[_HRGEN_Random(gen) % len] ^= (uint8_t)(1U << (_HRGEN_Random(gen) % 7U));
+        gen->stats.bitFlips++;
+    }
+
+    if (_HRGEN_Unit(gen) < config->dropRate)
+    {
+        pos = _HRGEN_Random(gen) % len;
+        memmove(&buffer[pos], &buffer[pos + 1U], len - pos - 1U);
+        len--;
+        gen->stats.drops++;
+    }
+
+    if ((_HRGEN_Unit(gen) < config->truncateRate) && (len > 6U))
+    {
+        len = 3U + (_HRGEN_Random(gen) % (len - 6U));
+        gen->stats.truncations++;
+    }
+
+    /* Line noise in proportion to the frame text */
+    gen->noiseCarry += (config->lineNoise / (1.0 - config->lineNoise)) * (double)len;
+
+    if ((_HRGEN_Unit(gen) < config->burstRate) && (config->burstLength != 0U))
+    {
+        burst = 1U + (_HRGEN_Random(gen) % config->burstLength);
+        for (i = 0U; i < burst; i++)
+        {
+            buffer[len++] = (uint8_t)_HRGEN_Random(gen);
+        }
+        gen->stats.bursts++;
+    }
+
+    while ((gen->noiseCarry >= 1.0) && (len < HRGEN_FRAME_MAX))
+    {
+        buffer[len++] = (uint8_t)_HRGEN_Random(gen);
+        gen->noiseCarry -= 1.0;
+        gen->stats.noiseBytes++;
+    }
+
+    gen->stats.bytes += len;
+
+    return len;
+}
+
+uint64_t HRGEN_TimeGet( const HRGEN * gen )
+{
+    return (uint64_t)(((double)gen->stats.frames * 1e6) / gen->config.frameRateHz);
+}
+
+uint8_t HRGEN_HeartRateGet( const HRGEN * gen )
+{
+    double t = (double)(gen->stats.frames - 1U) / gen->config.frameRateHz;
+
+    if ((gen->stats.frames == 0U) || (t < gen->config.settleS))
+    {
+        return 0U;
+    }
+
+    return (uint8_t)lround(gen->heartRate);
+}
@@ -0,0 +1,143 @@
+/*******************************************************************************
+  Heart Rate 9 stream generator
+
+  File Name:
+    hrgen.h
+
+  Summary:
+    Synthetic sensor stream in the Heart Rate 9 output format.
+
+  Description:
+    Every frame is "15;<ch0>;<ch1>;<ch2>;<hr>;\r\n", the format parsed by
+    DRV_HEARTRATE_FrameParse. The three optical channels follow a PPG
+    pulse, a systolic peak and a dicrotic wave per beat on a baseline that
+    wanders with breathing, plus sensor noise. The beat rate follows the
+    heart rate trajectory: a base rate, a slow sinusoidal swing and a
+    linear ramp. The heart rate field is 0 until the settle time is over,
+    like the sensor while its algorithm converges.
+
+    Faults are drawn per frame: one flipped bit, one dropped byte, a
+    frame cut short, a burst of random bytes after the frame. Line noise
+    inserts random bytes between frames so that they make up the given
+    share of the stream.
+
+    The generator is seeded, the same configuration always produces the
+    same stream.
+*******************************************************************************/
+
+#ifndef HRGEN_H
+#define HRGEN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Longest frame, with faults, that HRGEN_FrameNext writes */
+#define HRGEN_FRAME_MAX                 640U
+
+/* Limits applied by HRGEN_Initialize so that a frame fits HRGEN_FRAME_MAX */
+#define HRGEN_BURST_LENGTH_MAX          128U
+#define HRGEN_LINE_NOISE_MAX            0.9
+
+typedef struct
+{
+    /* Frames per second sent by the sensor, 100 for the Heart Rate 9 */
+    double      frameRateHz;
+
+    uint32_t    seed;
+
+    /* Heart rate trajectory in beats per minute */
+    double      heartRate;
+
+    double      heartRateSwing;
+
+    double      heartRateSwingPeriodS;
+
+    double      heartRateRampPerMin;
+
+    /* Seconds the heart rate field stays 0 */
+    double      settleS;
+
+    /* Standard deviation of the channel noise, in counts */
+    double      channelNoise;
+
+    /* Probability per frame of each fault */
+    double      bitFlipRate;
+
+    double      dropRate;
+
+    double      truncateRate;
+
+    double      burstRate;
+
+    /* Longest burst of random bytes */
+    uint32_t    burstLength;
+
+    /* Share of the stream made of random bytes between frames, below 1 */
+    double      lineNoise;
+
+} HRGEN_CONFIG;
+
+typedef struct
+{
+    uint64_t    frames;
+
+    uint64_t    bytes;
+
+    uint64_t    bitFlips;
+
+    uint64_t    drops;
+
+    uint64_t    truncations;
+
+    uint64_t    bursts;
+
+    uint64_t    noiseBytes;
+
+} HRGEN_STATS;
+
+typedef struct
+{
+    HRGEN_CONFIG    config;
+
+    uint32_t        random;
+
+    /* Beat phase in cycles and breathing phase in radians */
+    double          beatPhase;
+
+    double          breathPhase;
+
+    /* Heart rate of the last frame, before rounding */
+    double          heartRate;
+
+    /* Fractional line noise byte carried to the next frame */
+    double          noiseCarry;
+
+    HRGEN_STATS     stats;
+
+} HRGEN;
+
+/* 100 Hz, 72 bpm swinging by 8 bpm over 15 s, settled after 5 s, no faults */
+void HRGEN_ConfigDefault( HRGEN_CONFIG * config );
+
+void HRGEN_Initialize( HRGEN * gen, const HRGEN_CONFIG * config );
+
+/* Writes the next frame with its faults and line noise, buffer holds at
+   least HRGEN_FRAME_MAX bytes. Returns the number of bytes written. */
+size_t HRGEN_FrameNext( HRGEN * gen, uint8_t * buffer );
+
+/* Time of the next frame in microseconds since the first one */
+uint64_t HRGEN_TimeGet( const HRGEN * gen );
+
+/* Heart rate the last frame carried, 0 while settling */
+uint8_t HRGEN_HeartRateGet( const HRGEN * gen );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //HRGEN_H
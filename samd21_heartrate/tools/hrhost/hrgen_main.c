@@ -0,0 +1,359 @@
+/*******************************************************************************
+  Heart Rate 9 stream generator
+
+  File Name:
+    hrgen_main.c
+
+  Summary:
+    Writes a synthetic Heart Rate 9 stream to a file, a pipe or a serial
+    port.
+
+  Description:
+    A serial port is set to raw mode at the given baud rate and the frames
+    are sent in real time at the frame rate, the port then stands in for
+    the sensor on the SERCOM0 RX pin. Files and pipes are written as fast
+    as possible unless --realtime is given, "hrgen | hrhost -" runs the
+    stream through the host build of the driver.
+
+    The heart rate each frame carried can be written to a CSV file as the
+    reference for the rates the driver reports. A summary of the stream and
+    of the injected faults is printed to stderr.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "hrgen.h"
+
+#define HRGEN_DEFAULT_SECONDS       20.0
+#define HRGEN_DEFAULT_BAUD          115200UL
+
+typedef struct
+{
+    HRGEN_CONFIG    config;
+    const char     *outputPath;
+    const char     *truthPath;
+    unsigned long   frames;
+    unsigned long   baud;
+    int             realtime;
+} HRGEN_OPTIONS;
+
+static volatile sig_atomic_t stopRequested;
+
+static void onSignal(int sig)
+{
+    (void)sig;
+    stopRequested = 1;
+}
+
+static speed_t baudToSpeed(unsigned long baud)
+{
+    switch (baud)
+    {
+        case 9600UL:    return B9600;
+        case 19200UL:   return B19200;
+        case 38400UL:   return B38400;
+        case 57600UL:   return B57600;
+        case 115200UL:  return B115200;
+        case 230400UL:  return B230400;
+        case 460800UL:  return B460800;
+        case 921600UL:  return B921600;
+        default:        return B0;
+    }
+}
+
+static int openOutput(const char *path, unsigned long baud, int *isSerial)
+{
+    struct termios tio;
+    speed_t speed;
+    int fd;
+
+    *isSerial = 0;
+
+    if ((path == NULL) || (strcmp(path, "-") == 0))
+    {
+        return STDOUT_FILENO;
+    }
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_NOCTTY, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "hrgen: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    if (isatty(fd) && (tcgetattr(fd, &tio) == 0))
+    {
+        speed = baudToSpeed(baud);
+        if (speed == B0)
+        {
+            fprintf(stderr, "hrgen: unsupported baud rate %lu\n", baud);
+            close(fd);
+            return -1;
+        }
+
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        tio.c_cflag |= CLOCAL;
+
+        if (tcsetattr(fd, TCSANOW, &tio) != 0)
+        {
+            fprintf(stderr, "hrgen: %s: %s\n", path, strerror(errno));
+            close(fd);
+            return -1;
+        }
+
+        *isSerial = 1;
+    }
+
+    return fd;
+}
+
+static int writeAll(int fd, const uint8_t *data, size_t size)
+{
+    ssize_t count;
+
+    while (size != 0U)
+    {
+        count = write(fd, data, size);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        data += count;
+        size -= (size_t)count;
+    }
+
+    return 0;
+}
+
+static void sleepUntil(const struct timespec *start, uint64_t offsetUs)
+{
+    struct timespec deadline = *start;
+    uint64_t ns = (uint64_t)deadline.tv_nsec + (offsetUs * 1000U);
+
+    deadline.tv_sec += (time_t)(ns / 1000000000U);
+    deadline.tv_nsec = (long)(ns % 1000000000U);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+        if (stopRequested != 0)
+        {
+            break;
+        }
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: hrgen [options]\n"
+        "  -o <path>              file or serial port, default stdout\n"
+        "  -b <baud>              serial port baud rate, default %lu\n"
+        "  -n <frames>            frames to send, default %.0f s worth\n"
+        "  -r <hz>                frame rate, default 100\n"
+        "  -s <seed>              random seed\n"
+        "  -g <file>              write the heart rate of every frame as CSV\n"
+        "  --realtime             pace a file or pipe at the frame rate\n"
+        "  --hr <bpm>             base heart rate, default 72\n"
+        "  --swing <bpm>          sinusoidal swing, default 8\n"
+        "  --swing-period <s>     swing period, default 15\n"
+        "  --ramp <bpm/min>       linear change of the rate, default 0\n"
+        "  --settle <s>           seconds the rate field stays 0, default 5\n"
+        "  --channel-noise <n>    channel noise deviation in counts, default 40\n"
+        "  --bit-flips <p>        probability per frame of a flipped bit\n"
+        "  --drops <p>            probability per frame of a dropped byte\n"
+        "  --truncations <p>      probability per frame of a truncated frame\n"
+        "  --bursts <p>           probability per frame of a burst of noise\n"
+        "  --burst-length <n>     longest burst, default 24\n"
+        "  --line-noise <share>   share of random bytes between frames\n",
+        HRGEN_DEFAULT_BAUD, HRGEN_DEFAULT_SECONDS);
+}
+
+static int parseOptions(int argc, char **argv, HRGEN_OPTIONS *options)
+{
+    enum
+    {
+        OPT_REALTIME = 256,
+        OPT_HR,
+        OPT_SWING,
+        OPT_SWING_PERIOD,
+        OPT_RAMP,
+        OPT_SETTLE,
+        OPT_CHANNEL_NOISE,
+        OPT_BIT_FLIPS,
+        OPT_DROPS,
+        OPT_TRUNCATIONS,
+        OPT_BURSTS,
+        OPT_BURST_LENGTH,
+        OPT_LINE_NOISE,
+    };
+    static const struct option longOptions[] =
+    {
+        { "realtime",       no_argument,       NULL, OPT_REALTIME },
+        { "hr",             required_argument, NULL, OPT_HR },
+        { "swing",          required_argument, NULL, OPT_SWING },
+        { "swing-period",   required_argument, NULL, OPT_SWING_PERIOD },
+        { "ramp",           required_argument, NULL, OPT_RAMP },
+        { "settle",         required_argument, NULL, OPT_SETTLE },
+        { "channel-noise",  required_argument, NULL, OPT_CHANNEL_NOISE },
+        { "bit-flips",      required_argument, NULL, OPT_BIT_FLIPS },
+        { "drops",          required_argument, NULL, OPT_DROPS },
+        { "truncations",    required_argument, NULL, OPT_TRUNCATIONS },
+        { "bursts",         required_argument, NULL, OPT_BURSTS },
+        { "burst-length",   required_argument, NULL, OPT_BURST_LENGTH },
+        { "line-noise",     required_argument, NULL, OPT_LINE_NOISE },
+        { NULL, 0, NULL, 0 },
+    };
+    HRGEN_CONFIG *config = &options->config;
+    int option;
+
+    memset(options, 0, sizeof(*options));
+    HRGEN_ConfigDefault(config);
+    options->baud = HRGEN_DEFAULT_BAUD;
+
+    while ((option = getopt_long(argc, argv, "o:b:n:r:s:g:", longOptions, NULL)) != -1)
+    {
+        switch (option)
+        {
+            case 'o': options->outputPath = optarg; break;
+            case 'b': options->baud = strtoul(optarg, NULL, 0); break;
+            case 'n': options->frames = strtoul(optarg, NULL, 0); break;
+            case 'r': config->frameRateHz = strtod(optarg, NULL); break;
+            case 's': config->seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'g': options->truthPath = optarg; break;
+            case OPT_REALTIME: options->realtime = 1; break;
+            case OPT_HR: config->heartRate = strtod(optarg, NULL); break;
+            case OPT_SWING: config->heartRateSwing = strtod(optarg, NULL); break;
+            case OPT_SWING_PERIOD: config->heartRateSwingPeriodS = strtod(optarg, NULL); break;
+            case OPT_RAMP: config->heartRateRampPerMin = strtod(optarg, NULL); break;
+            case OPT_SETTLE: config->settleS = strtod(optarg, NULL); break;
+            case OPT_CHANNEL_NOISE: config->channelNoise = strtod(optarg, NULL); break;
+            case OPT_BIT_FLIPS: config->bitFlipRate = strtod(optarg, NULL); break;
+            case OPT_DROPS: config->dropRate = strtod(optarg, NULL); break;
+            case OPT_TRUNCATIONS: config->truncateRate = strtod(optarg, NULL); break;
+            case OPT_BURSTS: config->burstRate = strtod(optarg, NULL); break;
+            case OPT_BURST_LENGTH: config->burstLength = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case OPT_LINE_NOISE: config->lineNoise = strtod(optarg, NULL); break;
+            default:
+                usage();
+                return -1;
+        }
+    }
+
+    if ((optind != argc) || (config->frameRateHz <= 0.0) || (config->lineNoise < 0.0) ||
+        (config->lineNoise > HRGEN_LINE_NOISE_MAX))
+    {
+        usage();
+        return -1;
+    }
+
+    if (options->frames == 0U)
+    {
+        options->frames = (unsigned long)(HRGEN_DEFAULT_SECONDS * config->frameRateHz);
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    HRGEN_OPTIONS options;
+    HRGEN gen;
+    uint8_t frame[HRGEN_FRAME_MAX];
+    struct timespec start;
+    FILE *truth = NULL;
+    uint64_t frameUs;
+    size_t len;
+    int isSerial;
+    int fd;
+
+    if (parseOptions(argc, argv, &options) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    fd = openOutput(options.outputPath, options.baud, &isSerial);
+    if (fd < 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (options.truthPath != NULL)
+    {
+        truth = fopen(options.truthPath, "w");
+        if (truth == NULL)
+        {
+            fprintf(stderr, "hrgen: %s: %s\n", options.truthPath, strerror(errno));
+            return EXIT_FAILURE;
+        }
+        fprintf(truth, "frame,time_us,heart_rate\n");
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    HRGEN_Initialize(&gen, &options.config);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while ((stopRequested == 0) && (gen.stats.frames < options.frames))
+    {
+        frameUs = HRGEN_TimeGet(&gen);
+        if ((isSerial != 0) || (options.realtime != 0))
+        {
+            sleepUntil(&start, frameUs);
+        }
+
+        len = HRGEN_FrameNext(&gen, frame);
+
+        if (truth != NULL)
+        {
+            fprintf(truth, "%llu,%llu,%u\n", (unsigned long long)(gen.stats.frames - 1U),
+                (unsigned long long)frameUs, HRGEN_HeartRateGet(&gen));
+        }
+
+        if (writeAll(fd, frame, len) != 0)
+        {
+            fprintf(stderr, "hrgen: write: %s\n", strerror(errno));
+            break;
+        }
+    }
+
+    if (isSerial != 0)
+    {
+        tcdrain(fd);
+    }
+
+    if (truth != NULL)
+    {
+        fclose(truth);
+    }
+
+    fprintf(stderr, "hrgen: %llu frames, %llu bytes in %.3f s, %.0f bytes/s\n",
+        (unsigned long long)gen.stats.frames, (unsigned long long)gen.stats.bytes,
+        (double)HRGEN_TimeGet(&gen) / 1e6,
+        (double)gen.stats.bytes * options.config.frameRateHz / (double)((gen.stats.frames != 0U) ? gen.stats.frames : 1U));
+    fprintf(stderr, "hrgen: %llu bit flips, %llu drops, %llu truncations, %llu bursts, %llu noise bytes\n",
+        (unsigned long long)gen.stats.bitFlips, (unsigned long long)gen.stats.drops,
+        (unsigned long long)gen.stats.truncations, (unsigned long long)gen.stats.bursts,
+        (unsigned long long)gen.stats.noiseBytes);
+
+    if ((gen.stats.bytes * 10U) > ((uint64_t)options.baud * (HRGEN_TimeGet(&gen) / 1000000U + 1U)))
+    {
+        fprintf(stderr, "hrgen: the stream needs more than %lu baud at this frame rate\n", options.baud);
+    }
+
+    return EXIT_SUCCESS;
+}
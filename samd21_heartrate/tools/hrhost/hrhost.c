@@ -0,0 +1,274 @@
+/*******************************************************************************
+  Host build of the heart rate driver
+
+  File Name:
+    hrhost.c
+
+  Summary:
+    Mock SERCOM0 ring buffer, RTC, SysTick and sensor reset pin.
+
+  Description:
+    The ring and its notification follow plib_sercom0_usart.c so the driver
+    sees the same callbacks and the same overflows as on the target.
+*******************************************************************************/
+
+#include <string.h>
+#include "hrhost.h"
+#include "peripheral/rtc/plib_rtc.h"
+#include "peripheral/systick/plib_systick.h"
+
+typedef struct
+{
+    uint8_t                                 ring[HRHOST_PLIB_RING_SIZE];
+
+    uint32_t                                inIndex;
+
+    uint32_t                                outIndex;
+
+    uint32_t                                threshold;
+
+    bool                                    notificationEnabled;
+
+    bool                                    notifyPersistently;
+
+    DRV_HEARTRATE_PLIB_READ_CALLBACK_REG    callback;
+
+    uintptr_t                               context;
+
+    HRHOST_PLIB_STATS                       stats;
+
+    uint64_t                                clockUs;
+
+    uint32_t                                rtcCompare;
+
+    uint32_t                                rtcInterrupts;
+
+    bool                                    resetPin;
+
+} HRHOST_OBJ;
+
+static HRHOST_OBJ gHrhostObj;
+
+static size_t _HRHOST_PlibRead( uint8_t * buffer, const size_t size );
+static size_t _HRHOST_PlibReadCountGet( void );
+static void _HRHOST_PlibReadCallbackRegister( DRV_HEARTRATE_PLIB_READ_CALLBACK_REG callback, uintptr_t context );
+static void _HRHOST_PlibReadThresholdSet( uint32_t nBytesThreshold );
+static bool _HRHOST_PlibReadNotificationEnable( bool isEnabled, bool isPersistent );
+
+const DRV_HEARTRATE_PLIB_INTERFACE hrhostPlibAPI =
+{
+    .read = _HRHOST_PlibRead,
+    .readCallbackRegister = _HRHOST_PlibReadCallbackRegister,
+    .readCountGet = _HRHOST_PlibReadCountGet,
+    .setReadThreshold = _HRHOST_PlibReadThresholdSet,
+    .readNotificationEnable = _HRHOST_PlibReadNotificationEnable
+};
+
+// *****************************************************************************
+// Section: SERCOM0 ring buffer
+// *****************************************************************************
+
+static size_t _HRHOST_PlibRead( uint8_t * buffer, const size_t size )
+{
+    HRHOST_OBJ *obj = &gHrhostObj;
+    size_t nBytesRead = 0U;
+
+    while ((nBytesRead < size) && (obj->outIndex != obj->inIndex))
+    {
+        buffer[nBytesRead++] = obj->ring[obj->outIndex++];
+
+        if (obj->outIndex >= HRHOST_PLIB_RING_SIZE)
+        {
+            obj->outIndex = 0U;
+        }
+    }
+
+    return nBytesRead;
+}
+
+static size_t _HRHOST_PlibReadCountGet( void )
+{
+    HRHOST_OBJ *obj = &gHrhostObj;
+
+    if (obj->inIndex >= obj->outIndex)
+    {
+        return obj->inIndex - obj->outIndex;
+    }
+
+    return (HRHOST_PLIB_RING_SIZE - obj->outIndex) + obj->inIndex;
+}
+
+static void _HRHOST_PlibReadCallbackRegister( DRV_HEARTRATE_PLIB_READ_CALLBACK_REG callback, uintptr_t context )
+{
+    gHrhostObj.callback = callback;
+    gHrhostObj.context = context;
+}
+
+static void _HRHOST_PlibReadThresholdSet( uint32_t nBytesThreshold )
+{
+    if (nBytesThreshold > 0U)
+    {
+        gHrhostObj.threshold = nBytesThreshold;
+    }
+}
+
+static bool _HRHOST_PlibReadNotificationEnable( bool isEnabled, bool isPersistent )
+{
+    bool previousStatus = gHrhostObj.notificationEnabled;
+
+    gHrhostObj.notificationEnabled = isEnabled;
+    gHrhostObj.notifyPersistently = isPersistent;
+
+    return previousStatus;
+}
+
+/* SERCOM0_USART_RxPushByte followed by SERCOM0_USART_ReadNotificationSend */
+static bool _HRHOST_PlibPushByte( HRHOST_OBJ *obj, uint8_t data )
+{
+    uint32_t tempInIndex = obj->inIndex + 1U;
+    uint32_t count;
+
+    if (tempInIndex >= HRHOST_PLIB_RING_SIZE)
+    {
+        tempInIndex = 0U;
+    }
+
+    if ((tempInIndex == obj->outIndex) && (obj->callback != NULL))
+    {
+        /* The client gets a chance to free up space */
+        obj->callback((int)HEARTRATE_EVENT_READ_BUFFER_FULL, obj->context);
+    }
+
+    if (tempInIndex == obj->outIndex)
+    {
+        obj->stats.overflowCount++;
+        return false;
+    }
+
+    obj->ring[obj->inIndex] = data;
+    obj->inIndex = tempInIndex;
+
+    count = (uint32_t)_HRHOST_PlibReadCountGet();
+    obj->stats.rxCount++;
+    if (count > obj->stats.peakCount)
+    {
+        obj->stats.peakCount = count;
+    }
+
+    if ((obj->notificationEnabled == true) && (obj->callback != NULL) &&
+        (((obj->notifyPersistently == true) && (count >= obj->threshold)) ||
+         ((obj->notifyPersistently == false) && (count == obj->threshold))))
+    {
+        obj->stats.callbackCount++;
+        obj->callback((int)HEARTRATE_EVENT_READ_THRESHOLD_REACHED, obj->context);
+    }
+
+    return true;
+}
+
+void HRHOST_Initialize( void )
+{
+    memset(&gHrhostObj, 0, sizeof(gHrhostObj));
+}
+
+size_t HRHOST_PlibFeed( const uint8_t * data, size_t size )
+{
+    HRHOST_OBJ *obj = &gHrhostObj;
+    size_t nBytesPushed = 0U;
+    size_t i;
+
+    if (obj->resetPin == false)
+    {
+        obj->stats.resetDropCount += (uint32_t)size;
+        return 0U;
+    }
+
+    for (i = 0U; i < size; i++)
+    {
+        if (_HRHOST_PlibPushByte(obj, data[i]) == true)
+        {
+            nBytesPushed++;
+        }
+    }
+
+    return nBytesPushed;
+}
+
+void HRHOST_PlibStatsGet( HRHOST_PLIB_STATS * stats )
+{
+    *stats = gHrhostObj.stats;
+}
+
+// *****************************************************************************
+// Section: Virtual clock
+// *****************************************************************************
+
+void HRHOST_ClockAdvance( uint32_t us )
+{
+    gHrhostObj.clockUs += us;
+}
+
+uint64_t HRHOST_ClockGet( void )
+{
+    return gHrhostObj.clockUs;
+}
+
+uint32_t RTC_Timer32CounterGet( void )
+{
+    return (uint32_t)((gHrhostObj.clockUs * HRHOST_RTC_FREQUENCY) / 1000000U);
+}
+
+uint32_t RTC_Timer32FrequencyGet( void )
+{
+    return HRHOST_RTC_FREQUENCY;
+}
+
+void RTC_Timer32CompareSet( uint32_t compareValue )
+{
+    gHrhostObj.rtcCompare = compareValue;
+}
+
+bool HRHOST_RtcCompareGet( uint32_t * compare )
+{
+    *compare = gHrhostObj.rtcCompare;
+
+    return ((gHrhostObj.rtcInterrupts & (uint32_t)RTC_TIMER32_INT_MASK_COMPARE_MATCH) != 0U);
+}
+
+void RTC_Timer32InterruptEnable( RTC_TIMER32_INT_MASK interrupt )
+{
+    gHrhostObj.rtcInterrupts |= (uint32_t)interrupt;
+}
+
+void RTC_Timer32InterruptDisable( RTC_TIMER32_INT_MASK interrupt )
+{
+    gHrhostObj.rtcInterrupts &= ~(uint32_t)interrupt;
+}
+
+void SYSTICK_TimerStart( void )
+{
+}
+
+void SYSTICK_DelayMs( uint32_t delay_ms )
+{
+    HRHOST_ClockAdvance(delay_ms * 1000U);
+}
+
+void SYSTICK_DelayUs( uint32_t delay_us )
+{
+    HRHOST_ClockAdvance(delay_us);
+}
+
+// *****************************************************************************
+// Section: Sensor reset pin
+// *****************************************************************************
+
+void HRHOST_ResetPinSet( bool state )
+{
+    gHrhostObj.resetPin = state;
+}
+
+bool HRHOST_ResetPinGet( void )
+{
+    return gHrhostObj.resetPin;
+}
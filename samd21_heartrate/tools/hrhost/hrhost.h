@@ -0,0 +1,100 @@
+/*******************************************************************************
+  Host build of the heart rate driver
+
+  File Name:
+    hrhost.h
+
+  Summary:
+    Mock PLIBs and system services the heart rate driver is linked against
+    on the host.
+
+  Description:
+    drv_heartrate.c, the frame parser, the log service and the formatter
+    are built from the firmware sources. This module replaces what needs
+    the hardware:
+
+    - SERCOM0 ring buffer: a 128 byte ring behind the
+      DRV_HEARTRATE_PLIB_INTERFACE table, filled with HRHOST_PlibFeed. It
+      calls the read callback the way SERCOM0_USART_RxPushByte and
+      SERCOM0_USART_ReadNotificationSend do from the receive interrupt:
+      when the count reaches the threshold, on every byte past it only
+      with persistent notification, and when the ring is full.
+    - RTC and SysTick: a virtual clock in microseconds, moved forward with
+      HRHOST_ClockAdvance and by SYSTICK_DelayMs. The RTC counts at
+      1024 Hz like the target.
+    - WDRV_WINC_RESETN: the sensor reset pin, the include/ directory shadows
+      peripheral/port/plib_port.h with macros that call HRHOST_ResetPinSet.
+    - Console, command, trace log and boot timing: the console writes to
+      stdout, the others do nothing.
+
+    The driver keeps its state in static data, it can be initialized once
+    per process.
+*******************************************************************************/
+
+#ifndef HRHOST_H
+#define HRHOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+#include "driver/heartrate/drv_heartrate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Same as SERCOM0_USART_READ_BUFFER_SIZE, holds one byte less */
+#define HRHOST_PLIB_RING_SIZE           128U
+
+#define HRHOST_RTC_FREQUENCY            1024U
+
+typedef struct
+{
+    /* Bytes pushed into the ring and bytes lost on a full ring */
+    uint32_t    rxCount;
+
+    uint32_t    overflowCount;
+
+    /* Highest ring fill after a push */
+    uint32_t    peakCount;
+
+    uint32_t    callbackCount;
+
+    /* Bytes fed while the sensor was held in reset, not pushed */
+    uint32_t    resetDropCount;
+
+} HRHOST_PLIB_STATS;
+
+/* PLIB table to put in DRV_HEARTRATE_INIT.heartratePlib */
+extern const DRV_HEARTRATE_PLIB_INTERFACE hrhostPlibAPI;
+
+/* Clears the ring, the statistics and the clock, before DRV_HEARTRATE_Initialize */
+void HRHOST_Initialize( void );
+
+/* Receives bytes from the sensor, one receive interrupt per byte. Bytes
+   fed while the reset pin is low are dropped, the sensor does not send.
+   Returns the number of bytes pushed into the ring. */
+size_t HRHOST_PlibFeed( const uint8_t * data, size_t size );
+
+void HRHOST_PlibStatsGet( HRHOST_PLIB_STATS * stats );
+
+/* Virtual time since HRHOST_Initialize */
+void HRHOST_ClockAdvance( uint32_t us );
+
+uint64_t HRHOST_ClockGet( void );
+
+/* RTC compare value, returns false while the compare match interrupt is
+   disabled and does not wake the device */
+bool HRHOST_RtcCompareGet( uint32_t * compare );
+
+/* Sensor reset pin, high while the sensor runs */
+void HRHOST_ResetPinSet( bool state );
+
+bool HRHOST_ResetPinGet( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //HRHOST_H
@@ -0,0 +1,295 @@
+/*******************************************************************************
+  Host run of the heart rate driver
+
+  File Name:
+    hrhost_main.c
+
+  Summary:
+    Feeds a sensor capture through the host build of the heart rate driver.
+
+  Description:
+    The capture, a raw SERCOM0 stream like the hr9cap corpus, is fed to the
+    mock ring buffer at the time the bytes take on the wire at the
+    configured baud rate. DRV_HEARTRATE_TASKS runs once per loop period of
+    virtual time, the heart rates reported to the client and the window
+    summaries are printed with their virtual time. The capture is paused
+    while the driver holds the sensor in reset.
+
+    A report of the ring buffer and of the frames seen by the driver is
+    printed to stderr at the end of the capture.
+*******************************************************************************/
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "hrhost.h"
+
+#define HRHOST_DEFAULT_BAUD         115200UL
+#define HRHOST_DEFAULT_LOOP_US      1000UL
+
+/* Loop periods run after the end of the capture to drain the driver */
+#define HRHOST_DRAIN_LOOPS          16U
+
+typedef struct
+{
+    const char     *capturePath;
+    unsigned long   baud;
+    unsigned long   loopUs;
+    DRV_HEARTRATE_INIT init;
+    int             quiet;
+} HRHOST_OPTIONS;
+
+typedef struct
+{
+    uint64_t    reports;
+    uint64_t    samples;
+    uint64_t    windows;
+} HRHOST_CLIENT;
+
+static DRV_HEARTRATE_CLIENT_OBJ hrhostClientObjPool[DRV_HEARTRATE_CLIENTS_NUMBER_IDX0];
+
+static HRHOST_CLIENT hrhostClient;
+
+static int hrhostQuiet;
+
+static double virtualSeconds(void)
+{
+    return (double)HRHOST_ClockGet() / 1e6;
+}
+
+static void onHeartRate(DRV_HANDLE handle, int heartRate)
+{
+    (void)handle;
+
+    hrhostClient.reports++;
+    if (hrhostQuiet == 0)
+    {
+        printf("%10.3f s  hr %3d\n", virtualSeconds(), heartRate);
+    }
+}
+
+static void onSample(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    (void)handle;
+    (void)sample;
+
+    hrhostClient.samples++;
+}
+
+static void onSession(DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary)
+{
+    (void)handle;
+
+    hrhostClient.windows++;
+    if (hrhostQuiet == 0)
+    {
+        printf("%10.3f s  window %lu: %u frames, %u valid, %u discarded, hr %u/%u/%u\n", virtualSeconds(),
+            (unsigned long)summary->windowIndex, summary->frameCount, summary->validCount,
+            summary->discardedCount, summary->heartRateMin, summary->heartRateMean, summary->heartRateMax);
+    }
+}
+
+static uint8_t *readCapture(const char *path, size_t *size)
+{
+    FILE *in = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    uint8_t *data = NULL;
+    size_t capacity = 0U;
+    size_t count;
+
+    *size = 0U;
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "hrhost: %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    do
+    {
+        if (*size == capacity)
+        {
+            capacity = (capacity != 0U) ? (capacity * 2U) : 65536U;
+            data = realloc(data, capacity);
+            if (data == NULL)
+            {
+                fprintf(stderr, "hrhost: out of memory\n");
+                break;
+            }
+        }
+
+        count = fread(&data[*size], 1U, capacity - *size, in);
+        *size += count;
+    } while (count != 0U);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    return data;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: hrhost [options] <capture file or ->\n"
+        "  -b <baud>    sensor baud rate, default %lu\n"
+        "  -l <us>      super loop period in virtual time, default %lu\n"
+        "  -p <ms>      measurement period, 0 streams, default %lu\n"
+        "  -w <ms>      measurement window, default %lu\n"
+        "  -u <frames>  warmup frames of a window, default %lu\n"
+        "  -d <ms>      streaming startup delay, default %lu\n"
+        "  -r <n>       report decimation, default %lu\n"
+        "  -q           print the report only\n",
+        HRHOST_DEFAULT_BAUD, HRHOST_DEFAULT_LOOP_US,
+        (unsigned long)DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0, (unsigned long)DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0,
+        (unsigned long)DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0, (unsigned long)DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0,
+        (unsigned long)DRV_HEARTRATE_REPORT_DECIMATION_IDX0);
+}
+
+static int parseOptions(int argc, char **argv, HRHOST_OPTIONS *options)
+{
+    int option;
+
+    memset(options, 0, sizeof(*options));
+    options->baud = HRHOST_DEFAULT_BAUD;
+    options->loopUs = HRHOST_DEFAULT_LOOP_US;
+    options->init.heartratePlib = &hrhostPlibAPI;
+    options->init.clientObjPool = (uintptr_t)&hrhostClientObjPool[0];
+    options->init.numClients = DRV_HEARTRATE_CLIENTS_NUMBER_IDX0;
+    options->init.sessionPeriodMs = DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0;
+    options->init.sessionWindowMs = DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0;
+    options->init.sessionWarmupFrames = DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0;
+    options->init.readThreshold = DRV_HEARTRATE_READ_THRESHOLD_IDX0;
+    options->init.reportDecimation = DRV_HEARTRATE_REPORT_DECIMATION_IDX0;
+    options->init.startupDelayMs = DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0;
+
+    while ((option = getopt(argc, argv, "b:l:p:w:u:d:r:q")) != -1)
+    {
+        switch (option)
+        {
+            case 'b': options->baud = strtoul(optarg, NULL, 0); break;
+            case 'l': options->loopUs = strtoul(optarg, NULL, 0); break;
+            case 'p': options->init.sessionPeriodMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': options->init.sessionWindowMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'u': options->init.sessionWarmupFrames = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'd': options->init.startupDelayMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'r': options->init.reportDecimation = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'q': options->quiet = 1; break;
+            default:
+                usage();
+                return -1;
+        }
+    }
+
+    if ((optind != (argc - 1)) || (options->baud == 0U) || (options->loopUs == 0U) ||
+        ((options->init.sessionPeriodMs != 0U) && (options->init.sessionWindowMs >= options->init.sessionPeriodMs)))
+    {
+        usage();
+        return -1;
+    }
+
+    options->capturePath = argv[optind];
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    HRHOST_OPTIONS options;
+    HRHOST_PLIB_STATS stats;
+    SYS_MODULE_OBJ object;
+    DRV_HANDLE handle = DRV_HANDLE_INVALID;
+    uint8_t *capture;
+    size_t size;
+    size_t fed = 0U;
+    uint64_t wireUs = 0U;
+    uint64_t due;
+    uint32_t drain = 0U;
+
+    if (parseOptions(argc, argv, &options) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    capture = readCapture(options.capturePath, &size);
+    if (capture == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    hrhostQuiet = options.quiet;
+
+    HRHOST_Initialize();
+    (void)SYS_LOG_Initialize();
+
+    object = DRV_HEARTRATE_Initialize(DRV_HEARTRATE_INDEX_0, (SYS_MODULE_INIT *)&options.init);
+    if (object == SYS_MODULE_OBJ_INVALID)
+    {
+        fprintf(stderr, "hrhost: driver initialization failed\n");
+        free(capture);
+        return EXIT_FAILURE;
+    }
+
+    /* Open fails until the startup delay is over, like the application the
+       client retries every loop, without the error message */
+    SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_NONE);
+
+    while (drain < HRHOST_DRAIN_LOOPS)
+    {
+        /* Bytes that arrived on the wire during the last loop period */
+        if (HRHOST_ResetPinGet() == true)
+        {
+            wireUs += options.loopUs;
+            due = (wireUs * options.baud) / 10000000U;
+            if (due > size)
+            {
+                due = size;
+            }
+            (void)HRHOST_PlibFeed(&capture[fed], (size_t)due - fed);
+            fed = (size_t)due;
+        }
+
+        DRV_HEARTRATE_TASKS(object);
+
+        if (handle == DRV_HANDLE_INVALID)
+        {
+            handle = DRV_HEARTRATE_Open(DRV_HEARTRATE_INDEX_0, DRV_IO_INTENT_READ);
+            if (handle != DRV_HANDLE_INVALID)
+            {
+                SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_DEFAULT);
+                DRV_HEARTRATE_ClientEventHandlerSet(handle, onHeartRate);
+                DRV_HEARTRATE_SampleEventHandlerSet(handle, onSample);
+                DRV_HEARTRATE_SessionEventHandlerSet(handle, onSession);
+            }
+        }
+
+        HRHOST_ClockAdvance((uint32_t)options.loopUs);
+
+        if (fed == size)
+        {
+            drain++;
+        }
+    }
+
+    HRHOST_PlibStatsGet(&stats);
+
+    fprintf(stderr, "virtual time %.3f s, %zu bytes fed\n", virtualSeconds(), fed);
+    fprintf(stderr, "ring: %lu pushed, %lu lost on overflow, peak %lu of %u, %lu callbacks\n",
+        (unsigned long)stats.rxCount, (unsigned long)stats.overflowCount,
+        (unsigned long)stats.peakCount, HRHOST_PLIB_RING_SIZE - 1U, (unsigned long)stats.callbackCount);
+    fprintf(stderr, "driver: %llu samples, %llu heart rates reported, %llu windows\n",
+        (unsigned long long)hrhostClient.samples, (unsigned long long)hrhostClient.reports,
+        (unsigned long long)hrhostClient.windows);
+
+    if (handle != DRV_HANDLE_INVALID)
+    {
+        DRV_HEARTRATE_Close(handle);
+    }
+    free(capture);
+
+    return EXIT_SUCCESS;
+}
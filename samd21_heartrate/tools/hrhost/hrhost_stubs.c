@@ -0,0 +1,73 @@
+/*******************************************************************************
+  Host build of the heart rate driver
+
+  File Name:
+    hrhost_stubs.c
+
+  Summary:
+    System services the driver and the log service call on the host.
+
+  Description:
+    The console writes to stdout with the carriage returns of the target
+    output removed. Commands are not registered, there is no shell. Trace
+    log records and boot milestones are dropped.
+*******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "definitions.h"
+
+ssize_t SYS_CONSOLE_Write( const SYS_CONSOLE_HANDLE handle, const void* buf, size_t count )
+{
+    const char *data = (const char *)buf;
+    size_t i;
+
+    (void)handle;
+
+    for (i = 0U; i < count; i++)
+    {
+        if (data[i] != '\r')
+        {
+            (void)putchar(data[i]);
+        }
+    }
+
+    return (ssize_t)count;
+}
+
+void SYS_CONSOLE_Print( const SYS_CONSOLE_HANDLE handle, const char *format, ... )
+{
+    char buffer[256];
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (len > 0)
+    {
+        (void)SYS_CONSOLE_Write(handle, buffer, ((size_t)len < sizeof(buffer)) ? (size_t)len : (sizeof(buffer) - 1U));
+    }
+}
+
+bool SYS_CMD_ADDGRP( const SYS_CMD_DESCRIPTOR* pCmdTbl, int nCmds, const char* groupName, const char* menuStr )
+{
+    (void)pCmdTbl;
+    (void)nCmds;
+    (void)groupName;
+    (void)menuStr;
+
+    return true;
+}
+
+void SYS_TLOG_Write( uint32_t id, uint32_t nArgs, ... )
+{
+    (void)id;
+    (void)nArgs;
+}
+
+void SYS_BOOT_Mark( SYS_BOOT_MILESTONE milestone )
+{
+    (void)milestone;
+}
@@ -0,0 +1,529 @@
+/*******************************************************************************
+  Heart rate parser throughput benchmark
+
+  File Name:
+    hrparsebench.c
+
+  Summary:
+    Measures the frame parser and the driver receive path on the host.
+
+  Description:
+    Every stream is run through two paths:
+
+    - parser: DRV_HEARTRATE_FrameParse alone, called on chunks of the
+      stream like the driver calls it on the bytes of one task call.
+    - driver: the chunk is pushed into the mock SERCOM0 ring, the read
+      callback appends it to rx_buff and DRV_HEARTRATE_TASKS parses it in
+      heartrate9_read_byte. Frames are counted in the sample callback,
+      which does not see the frames flagged NON_DIGIT or OVERFLOW, so
+      the driver decodes fewer frames than the parser on corrupted
+      streams.
+
+    The chunk size is the number of bytes received between two task calls.
+    Synthetic streams are generated with hrgen for every combination of
+    line noise, the share of random bytes inserted between frames, and
+    corrupted frames, the share of frames with one flipped bit.
+    Recorded streams, such as the hr9cap corpus, are given on the command
+    line.
+
+    Each case runs the given number of passes and the fastest pass is kept.
+    The results are written as JSON for hrbench_compare.py, a table is
+    printed to stderr. Cycles are read from the time stamp counter where
+    the host has one.
+*******************************************************************************/
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HRPARSEBENCH_CYCLES()       __rdtsc()
+#define HRPARSEBENCH_CYCLE_SOURCE   "tsc"
+#else
+#define HRPARSEBENCH_CYCLES()       0ULL
+#define HRPARSEBENCH_CYCLE_SOURCE   "none"
+#endif
+#include "definitions.h"
+#include "hrhost.h"
+#include "hrgen.h"
+
+#define HRPARSEBENCH_FORMAT_VERSION 2U
+#define HRPARSEBENCH_DEFAULT_FRAMES 2000U
+#define HRPARSEBENCH_DEFAULT_PASSES 20U
+#define HRPARSEBENCH_SEED           0x48523921UL
+#define HRPARSEBENCH_MAX_LIST       16U
+
+/* Task calls run after the last chunk to drain the ring */
+#define HRPARSEBENCH_DRAIN_LOOPS    4U
+
+typedef struct
+{
+    double      values[HRPARSEBENCH_MAX_LIST];
+    size_t      count;
+} HRPARSEBENCH_LIST;
+
+typedef struct
+{
+    HRPARSEBENCH_LIST   chunks;
+    HRPARSEBENCH_LIST   noise;
+    HRPARSEBENCH_LIST   corrupt;
+    unsigned long       frames;
+    unsigned long       passes;
+    const char         *outputPath;
+    char              **recorded;
+    int                 recordedCount;
+} HRPARSEBENCH_OPTIONS;
+
+typedef struct
+{
+    uint8_t    *data;
+    size_t      size;
+    size_t      capacity;
+    uint32_t    frames;
+} HRPARSEBENCH_STREAM;
+
+typedef struct
+{
+    uint64_t    ns;
+    uint64_t    cycles;
+    uint32_t    frames;
+} HRPARSEBENCH_RUN;
+
+static DRV_HEARTRATE_CLIENT_OBJ hrparsebenchClientObjPool[1];
+
+static uint32_t hrparsebenchSamples;
+
+static uint64_t monotonicNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static void streamAppend(HRPARSEBENCH_STREAM *stream, const void *data, size_t size)
+{
+    if ((stream->size + size) > stream->capacity)
+    {
+        stream->capacity = (stream->capacity + size) * 2U;
+        stream->data = realloc(stream->data, stream->capacity);
+        if (stream->data == NULL)
+        {
+            fprintf(stderr, "hrparsebench: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    memcpy(&stream->data[stream->size], data, size);
+    stream->size += size;
+}
+
+/* hrgen frames at the 100 Hz sensor rate, the heart rate field is 0 for
+   the first quarter of the stream */
+static void streamSynthesize(HRPARSEBENCH_STREAM *stream, unsigned long frames, double noise, double corrupt)
+{
+    HRGEN_CONFIG config;
+    HRGEN gen;
+    uint8_t frame[HRGEN_FRAME_MAX];
+    size_t len;
+
+    memset(stream, 0, sizeof(*stream));
+
+    HRGEN_ConfigDefault(&config);
+    config.seed = HRPARSEBENCH_SEED;
+    config.settleS = (double)(frames / 4U) / config.frameRateHz;
+    config.bitFlipRate = corrupt;
+    config.lineNoise = noise;
+    HRGEN_Initialize(&gen, &config);
+
+    while (gen.stats.frames < frames)
+    {
+        len = HRGEN_FrameNext(&gen, frame);
+        streamAppend(stream, frame, len);
+    }
+
+    stream->frames = (uint32_t)gen.stats.frames;
+}
+
+static int streamLoad(HRPARSEBENCH_STREAM *stream, const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    uint8_t buffer[4096];
+    size_t count;
+    size_t i;
+
+    memset(stream, 0, sizeof(*stream));
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "hrparsebench: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    while ((count = fread(buffer, 1U, sizeof(buffer), in)) != 0U)
+    {
+        streamAppend(stream, buffer, count);
+    }
+    fclose(in);
+
+    /* Frames sent by the sensor, one per line */
+    for (i = 0U; i < stream->size; i++)
+    {
+        if (stream->data[i] == '\n')
+        {
+            stream->frames++;
+        }
+    }
+
+    return 0;
+}
+
+static void runParser(const HRPARSEBENCH_STREAM *stream, size_t chunk, HRPARSEBENCH_RUN *run)
+{
+    DRV_HEARTRATE_FRAME_PARSER parser;
+    uint64_t startNs;
+    uint64_t startCycles;
+    size_t offset = 0U;
+    size_t end;
+    bool complete;
+
+    DRV_HEARTRATE_FrameParserReset(&parser);
+    run->frames = 0U;
+
+    startNs = monotonicNs();
+    startCycles = HRPARSEBENCH_CYCLES();
+
+    while (offset < stream->size)
+    {
+        end = offset + chunk;
+        if (end > stream->size)
+        {
+            end = stream->size;
+        }
+
+        while (offset < end)
+        {
+            offset += DRV_HEARTRATE_FrameParse(&parser, &stream->data[offset], end - offset, &complete);
+            if (complete == true)
+            {
+                run->frames++;
+            }
+        }
+    }
+
+    run->cycles = HRPARSEBENCH_CYCLES() - startCycles;
+    run->ns = monotonicNs() - startNs;
+}
+
+static void runDriver(SYS_MODULE_OBJ object, const HRPARSEBENCH_STREAM *stream, size_t chunk, HRPARSEBENCH_RUN *run)
+{
+    uint64_t startNs;
+    uint64_t startCycles;
+    size_t offset = 0U;
+    size_t size;
+    uint32_t drain;
+
+    hrparsebenchSamples = 0U;
+
+    startNs = monotonicNs();
+    startCycles = HRPARSEBENCH_CYCLES();
+
+    while (offset < stream->size)
+    {
+        size = ((stream->size - offset) < chunk) ? (stream->size - offset) : chunk;
+        (void)HRHOST_PlibFeed(&stream->data[offset], size);
+        offset += size;
+
+        DRV_HEARTRATE_TASKS(object);
+    }
+
+    for (drain = 0U; drain < HRPARSEBENCH_DRAIN_LOOPS; drain++)
+    {
+        DRV_HEARTRATE_TASKS(object);
+    }
+
+    run->cycles = HRPARSEBENCH_CYCLES() - startCycles;
+    run->ns = monotonicNs() - startNs;
+    run->frames = hrparsebenchSamples;
+}
+
+static void onSample(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    (void)handle;
+    (void)sample;
+
+    hrparsebenchSamples++;
+}
+
+static void onHeartRate(DRV_HANDLE handle, int heartRate)
+{
+    (void)handle;
+    (void)heartRate;
+}
+
+static SYS_MODULE_OBJ driverStart(void)
+{
+    static DRV_HEARTRATE_INIT init;
+    SYS_MODULE_OBJ object;
+    DRV_HANDLE handle;
+
+    init.heartratePlib = &hrhostPlibAPI;
+    init.clientObjPool = (uintptr_t)&hrparsebenchClientObjPool[0];
+    init.numClients = 1U;
+    init.readThreshold = DRV_HEARTRATE_READ_THRESHOLD_IDX0;
+    init.reportDecimation = DRV_HEARTRATE_REPORT_DECIMATION_IDX0;
+
+    HRHOST_Initialize();
+    (void)SYS_LOG_Initialize();
+
+    /* Streaming without a startup delay, the first task call opens it */
+    object = DRV_HEARTRATE_Initialize(DRV_HEARTRATE_INDEX_0, (SYS_MODULE_INIT *)&init);
+    DRV_HEARTRATE_TASKS(object);
+
+    handle = DRV_HEARTRATE_Open(DRV_HEARTRATE_INDEX_0, DRV_IO_INTENT_READ);
+    if (handle == DRV_HANDLE_INVALID)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    DRV_HEARTRATE_ClientEventHandlerSet(handle, onHeartRate);
+    DRV_HEARTRATE_SampleEventHandlerSet(handle, onSample);
+
+    return object;
+}
+
+static void report(FILE *out, int *first, const char *stream, const char *path, double noise, double corrupt,
+    size_t chunk, const HRPARSEBENCH_STREAM *data, const HRPARSEBENCH_RUN *best)
+{
+    double seconds = (double)best->ns / 1e9;
+    double bytesPerSecond = (seconds > 0.0) ? ((double)data->size / seconds) : 0.0;
+    double nsPerFrame = (best->frames != 0U) ? ((double)best->ns / (double)best->frames) : 0.0;
+    double cyclesPerFrame = (best->frames != 0U) ? ((double)best->cycles / (double)best->frames) : 0.0;
+
+    fprintf(out, "%s\n    {\"stream\": \"%s\", \"path\": \"%s\", ", (*first != 0) ? "" : ",", stream, path);
+    if (noise >= 0.0)
+    {
+        fprintf(out, "\"noise\": %.3f, \"corrupt\": %.3f, ", noise, corrupt);
+    }
+    fprintf(out, "\"chunk\": %zu, \"bytes\": %zu, \"frames_sent\": %lu, \"frames\": %lu, "
+        "\"ns\": %llu, \"bytes_per_s\": %.0f, \"ns_per_frame\": %.1f, \"cycles_per_frame\": %.1f}",
+        chunk, data->size, (unsigned long)data->frames, (unsigned long)best->frames,
+        (unsigned long long)best->ns, bytesPerSecond, nsPerFrame, cyclesPerFrame);
+    *first = 0;
+
+    fprintf(stderr, "%-16s %-6s ", stream, path);
+    if (noise >= 0.0)
+    {
+        fprintf(stderr, "%5.2f %5.2f ", noise, corrupt);
+    }
+    else
+    {
+        fprintf(stderr, "%5s %5s ", "-", "-");
+    }
+    fprintf(stderr, "%5zu %7lu/%-7lu %12.0f %10.1f %10.1f\n", chunk, (unsigned long)best->frames,
+        (unsigned long)data->frames, bytesPerSecond, nsPerFrame, cyclesPerFrame);
+}
+
+static void benchStream(FILE *out, int *first, SYS_MODULE_OBJ object, const HRPARSEBENCH_OPTIONS *options,
+    const char *name, double noise, double corrupt, const HRPARSEBENCH_STREAM *stream)
+{
+    HRPARSEBENCH_RUN run;
+    HRPARSEBENCH_RUN best;
+    size_t chunk;
+    size_t c;
+    unsigned long pass;
+
+    for (c = 0U; c < options->chunks.count; c++)
+    {
+        chunk = (size_t)options->chunks.values[c];
+
+        best.ns = UINT64_MAX;
+        for (pass = 0U; pass < options->passes; pass++)
+        {
+            runParser(stream, chunk, &run);
+            if (run.ns < best.ns)
+            {
+                best = run;
+            }
+        }
+        report(out, first, name, "parser", noise, corrupt, chunk, stream, &best);
+
+        best.ns = UINT64_MAX;
+        for (pass = 0U; pass < options->passes; pass++)
+        {
+            runDriver(object, stream, chunk, &run);
+            if (run.ns < best.ns)
+            {
+                best = run;
+            }
+        }
+        report(out, first, name, "driver", noise, corrupt, chunk, stream, &best);
+    }
+}
+
+static int parseList(const char *text, HRPARSEBENCH_LIST *list, double max)
+{
+    char *end;
+
+    list->count = 0U;
+
+    while (*text != '\0')
+    {
+        if (list->count == HRPARSEBENCH_MAX_LIST)
+        {
+            return -1;
+        }
+
+        list->values[list->count] = strtod(text, &end);
+        if ((end == text) || (list->values[list->count] < 0.0) || (list->values[list->count] > max))
+        {
+            return -1;
+        }
+        list->count++;
+
+        text = (*end == ',') ? (end + 1) : end;
+        if ((*end != ',') && (*end != '\0'))
+        {
+            return -1;
+        }
+    }
+
+    return (list->count != 0U) ? 0 : -1;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: hrparsebench [options] [recorded stream...]\n"
+        "  -c <list>    chunk sizes in bytes, default 1,4,10,16,64\n"
+        "  -n <list>    line noise shares, default 0,0.05,0.2\n"
+        "  -e <list>    corrupted frame shares, default 0,0.02,0.1\n"
+        "  -f <frames>  synthetic stream length, default %u, 0 for recorded streams only\n"
+        "  -p <passes>  passes per case, the fastest is kept, default %u\n"
+        "  -o <file>    JSON output, default stdout\n",
+        HRPARSEBENCH_DEFAULT_FRAMES, HRPARSEBENCH_DEFAULT_PASSES);
+}
+
+static int parseOptions(int argc, char **argv, HRPARSEBENCH_OPTIONS *options)
+{
+    int option;
+    int status = 0;
+
+    memset(options, 0, sizeof(*options));
+    options->frames = HRPARSEBENCH_DEFAULT_FRAMES;
+    options->passes = HRPARSEBENCH_DEFAULT_PASSES;
+    (void)parseList("1,4,10,16,64", &options->chunks, 65536.0);
+    (void)parseList("0,0.05,0.2", &options->noise, HRGEN_LINE_NOISE_MAX);
+    (void)parseList("0,0.02,0.1", &options->corrupt, 1.0);
+
+    while ((option = getopt(argc, argv, "c:n:e:f:p:o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'c': status |= parseList(optarg, &options->chunks, 65536.0); break;
+            case 'n': status |= parseList(optarg, &options->noise, HRGEN_LINE_NOISE_MAX); break;
+            case 'e': status |= parseList(optarg, &options->corrupt, 1.0); break;
+            case 'f': options->frames = strtoul(optarg, NULL, 0); break;
+            case 'p': options->passes = strtoul(optarg, NULL, 0); break;
+            case 'o': options->outputPath = optarg; break;
+            default: status = -1; break;
+        }
+    }
+
+    for (size_t c = 0U; c < options->chunks.count; c++)
+    {
+        if (options->chunks.values[c] < 1.0)
+        {
+            status = -1;
+        }
+    }
+
+    if ((status != 0) || (options->passes == 0U) || ((options->frames == 0U) && (optind == argc)))
+    {
+        usage();
+        return -1;
+    }
+
+    options->recorded = &argv[optind];
+    options->recordedCount = argc - optind;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    HRPARSEBENCH_OPTIONS options;
+    HRPARSEBENCH_STREAM stream;
+    SYS_MODULE_OBJ object;
+    FILE *out = stdout;
+    const char *name;
+    int first = 1;
+    size_t n;
+    size_t e;
+    int i;
+
+    if (parseOptions(argc, argv, &options) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    object = driverStart();
+    if (object == SYS_MODULE_OBJ_INVALID)
+    {
+        fprintf(stderr, "hrparsebench: driver initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    if (options.outputPath != NULL)
+    {
+        out = fopen(options.outputPath, "w");
+        if (out == NULL)
+        {
+            fprintf(stderr, "hrparsebench: %s: %s\n", options.outputPath, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf(out, "{\n  \"tool\": \"hrparsebench\",\n  \"version\": %u,\n  \"passes\": %lu,\n"
+        "  \"read_threshold\": %u,\n  \"cycle_source\": \"%s\",\n  \"results\": [",
+        HRPARSEBENCH_FORMAT_VERSION, options.passes, (unsigned)DRV_HEARTRATE_READ_THRESHOLD_IDX0,
+        HRPARSEBENCH_CYCLE_SOURCE);
+
+    fprintf(stderr, "%-16s %-6s %5s %5s %5s %15s %12s %10s %10s\n", "stream", "path", "noise", "corr",
+        "chunk", "frames", "bytes/s", "ns/frame", "cyc/frame");
+
+    for (n = 0U; (options.frames != 0U) && (n < options.noise.count); n++)
+    {
+        for (e = 0U; e < options.corrupt.count; e++)
+        {
+            streamSynthesize(&stream, options.frames, options.noise.values[n], options.corrupt.values[e]);
+            benchStream(out, &first, object, &options, "synthetic", options.noise.values[n], options.corrupt.values[e], &stream);
+            free(stream.data);
+        }
+    }
+
+    for (i = 0; i < options.recordedCount; i++)
+    {
+        if (streamLoad(&stream, options.recorded[i]) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+
+        name = strrchr(options.recorded[i], '/');
+        name = (name != NULL) ? (name + 1) : options.recorded[i];
+        benchStream(out, &first, object, &options, name, -1.0, -1.0, &stream);
+        free(stream.data);
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    return EXIT_SUCCESS;
+}
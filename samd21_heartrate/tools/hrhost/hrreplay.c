@@ -0,0 +1,737 @@
+/*******************************************************************************
+  Heart rate capture replay
+
+  File Name:
+    hrreplay.c
+
+  Summary:
+    Replays raw sensor chunks captured by the driver on the target.
+
+  Description:
+    The input is the SERCOM2 telemetry stream recorded while "telem capture
+    on" or "telem capture send" was running, for example with
+
+        stty -F /dev/ttyUSB1 115200 raw && cat /dev/ttyUSB1 > field.cap
+
+    Capture frames are COBS decoded and checked against their CRC, sample
+    frames are skipped. Every captured chunk is pushed into the mock SERCOM0
+    ring of the host build of the driver at its capture time in virtual
+    time, so the driver sees the spacing of the target, and
+    DRV_HEARTRATE_TASKS runs once per loop period in between. The read
+    callback runs on the read threshold like on the target. Chunks lost on
+    the target, on a full capture buffer or in a damaged frame, are found
+    from the sequence numbers and reported.
+
+    With -o the chunks are written to a serial port or a file instead, a
+    serial port wired to the SERCOM0 RX pin of a board replays the capture
+    into the real driver. -x writes the bytes alone, the format read by
+    hrhost, hr9cap and hrparsebench.
+
+    -s sets the wall clock speed: 1 replays in real time, 10 ten times
+    faster, 0 as fast as possible. The virtual time of the driver follows
+    the capture at every speed, the speed only matters to the serial port
+    and to the replay throughput printed at the end.
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "definitions.h"
+#include "system/telemetry/sys_telemetry.h"
+#include "hrhost.h"
+
+#define HRREPLAY_DEFAULT_BAUD       115200UL
+#define HRREPLAY_DEFAULT_LOOP_US    1000UL
+
+/* Loop periods run after the last chunk to drain the driver */
+#define HRREPLAY_DRAIN_LOOPS        16U
+
+/* Telemetry frame layout, see sys_telemetry.h */
+#define HRREPLAY_FRAME_TYPE_SAMPLES         SYS_TELEMETRY_FRAME_TYPE_SAMPLES
+#define HRREPLAY_FRAME_TYPE_CAPTURE         SYS_TELEMETRY_FRAME_TYPE_CAPTURE
+#define HRREPLAY_HEADER_SIZE                SYS_TELEMETRY_HEADER_SIZE
+#define HRREPLAY_RECORD_HEADER_SIZE         SYS_TELEMETRY_CAPTURE_RECORD_HEADER_SIZE
+#define HRREPLAY_CRC_SIZE                   SYS_TELEMETRY_CRC_SIZE
+
+typedef struct
+{
+    DRV_HEARTRATE_CAPTURE_RECORD    record;
+
+    const uint8_t                  *data;
+
+} HRREPLAY_CHUNK;
+
+typedef struct
+{
+    HRREPLAY_CHUNK *chunks;
+    size_t          count;
+    size_t          capacity;
+
+    uint64_t        bytes;
+    uint64_t        captureFrames;
+    uint64_t        sampleFrames;
+    uint64_t        badFrames;
+    uint64_t        missingChunks;
+    uint64_t        gapFlags;
+} HRREPLAY_CAPTURE;
+
+typedef struct
+{
+    const char     *capturePath;
+    const char     *outputPath;
+    const char     *exportPath;
+    unsigned long   baud;
+    unsigned long   loopUs;
+    double          speed;
+    DRV_HEARTRATE_INIT init;
+    int             quiet;
+} HRREPLAY_OPTIONS;
+
+typedef struct
+{
+    uint64_t    reports;
+    uint64_t    samples;
+    uint64_t    windows;
+} HRREPLAY_CLIENT;
+
+static DRV_HEARTRATE_CLIENT_OBJ hrreplayClientObjPool[DRV_HEARTRATE_CLIENTS_NUMBER_IDX0];
+
+static HRREPLAY_CLIENT hrreplayClient;
+
+static int hrreplayQuiet;
+
+static uint64_t monotonicNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static void sleepUntilNs(uint64_t deadlineNs)
+{
+    struct timespec deadline;
+
+    deadline.tv_sec = (time_t)(deadlineNs / 1000000000ULL);
+    deadline.tv_nsec = (long)(deadlineNs % 1000000000ULL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+    }
+}
+
+static uint16_t get16(const uint8_t *src)
+{
+    return (uint16_t)(src[0] | (src[1] << 8));
+}
+
+static uint32_t get32(const uint8_t *src)
+{
+    return (uint32_t)get16(src) | ((uint32_t)get16(&src[2]) << 16);
+}
+
+/* CRC-16/CCITT-FALSE like SYS_TELEMETRY_Crc16 */
+static uint16_t crc16(const uint8_t *data, size_t size)
+{
+    uint16_t crc = 0xFFFFU;
+    size_t i;
+    int bit;
+
+    for (i = 0U; i < size; i++)
+    {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/* Decodes one COBS frame without its delimiter in place, returns the
+   decoded size or 0 if the frame is malformed */
+static size_t cobsDecode(uint8_t *data, size_t size)
+{
+    size_t in = 0U;
+    size_t out = 0U;
+    uint8_t code;
+    uint8_t i;
+
+    while (in < size)
+    {
+        code = data[in++];
+        if ((code == 0U) || ((in + code - 1U) > size))
+        {
+            return 0U;
+        }
+
+        for (i = 1U; i < code; i++)
+        {
+            data[out++] = data[in++];
+        }
+
+        if ((code != 0xFFU) && (in < size))
+        {
+            data[out++] = 0U;
+        }
+    }
+
+    return out;
+}
+
+static uint8_t *readFile(const char *path, size_t *size)
+{
+    FILE *in = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    uint8_t *data = NULL;
+    size_t capacity = 0U;
+    size_t count;
+
+    *size = 0U;
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "hrreplay: %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    do
+    {
+        if (*size == capacity)
+        {
+            capacity = (capacity != 0U) ? (capacity * 2U) : 65536U;
+            data = realloc(data, capacity);
+            if (data == NULL)
+            {
+                fprintf(stderr, "hrreplay: out of memory\n");
+                break;
+            }
+        }
+
+        count = fread(&data[*size], 1U, capacity - *size, in);
+        *size += count;
+    } while (count != 0U);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    return data;
+}
+
+static void chunkAppend(HRREPLAY_CAPTURE *capture, const DRV_HEARTRATE_CAPTURE_RECORD *record, const uint8_t *data)
+{
+    if (capture->count == capture->capacity)
+    {
+        capture->capacity = (capture->capacity != 0U) ? (capture->capacity * 2U) : 4096U;
+        capture->chunks = realloc(capture->chunks, capture->capacity * sizeof(*capture->chunks));
+        if (capture->chunks == NULL)
+        {
+            fprintf(stderr, "hrreplay: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    capture->chunks[capture->count].record = *record;
+    capture->chunks[capture->count].data = data;
+    capture->count++;
+    capture->bytes += record->length;
+}
+
+static void parseCaptureFrame(HRREPLAY_CAPTURE *capture, const uint8_t *frame, size_t size)
+{
+    DRV_HEARTRATE_CAPTURE_RECORD record;
+    const uint8_t *end = &frame[size - HRREPLAY_CRC_SIZE];
+    const uint8_t *pos = &frame[HRREPLAY_HEADER_SIZE];
+    uint8_t count = frame[1];
+    uint16_t expected;
+
+    while ((count != 0U) && ((size_t)(end - pos) >= HRREPLAY_RECORD_HEADER_SIZE))
+    {
+        record.sequence = get16(&pos[0]);
+        record.timestamp = get32(&pos[2]);
+        record.length = pos[6];
+        record.flags = pos[7];
+        pos += HRREPLAY_RECORD_HEADER_SIZE;
+
+        if ((size_t)(end - pos) < record.length)
+        {
+            break;
+        }
+
+        if (capture->count != 0U)
+        {
+            expected = (uint16_t)(capture->chunks[capture->count - 1U].record.sequence + 1U);
+            capture->missingChunks += (uint16_t)(record.sequence - expected);
+        }
+        if ((record.flags & DRV_HEARTRATE_CAPTURE_FLAG_GAP) != 0U)
+        {
+            capture->gapFlags++;
+        }
+
+        chunkAppend(capture, &record, pos);
+        pos += record.length;
+        count--;
+    }
+
+    if ((count != 0U) || (pos != end))
+    {
+        capture->badFrames++;
+    }
+}
+
+/* Splits the telemetry stream into frames and collects the captured chunks */
+static void parseStream(HRREPLAY_CAPTURE *capture, uint8_t *stream, size_t size)
+{
+    size_t start = 0U;
+    size_t i;
+    size_t frameSize;
+    uint8_t *frame;
+
+    /* Frames are decoded in place, the chunks point into the stream */
+    memset(capture, 0, sizeof(*capture));
+
+    for (i = 0U; i < size; i++)
+    {
+        if (stream[i] != 0U)
+        {
+            continue;
+        }
+
+        frame = &stream[start];
+        frameSize = cobsDecode(frame, i - start);
+        start = i + 1U;
+
+        if (frameSize == 0U)
+        {
+            /* Back to back delimiters or the tail of a frame cut by the start of the recording */
+            continue;
+        }
+
+        if ((frameSize < (HRREPLAY_HEADER_SIZE + HRREPLAY_CRC_SIZE)) ||
+            (crc16(frame, frameSize - HRREPLAY_CRC_SIZE) != get16(&frame[frameSize - HRREPLAY_CRC_SIZE])))
+        {
+            capture->badFrames++;
+            continue;
+        }
+
+        if (frame[0] == HRREPLAY_FRAME_TYPE_CAPTURE)
+        {
+            capture->captureFrames++;
+            parseCaptureFrame(capture, frame, frameSize);
+        }
+        else if (frame[0] == HRREPLAY_FRAME_TYPE_SAMPLES)
+        {
+            capture->sampleFrames++;
+        }
+        else
+        {
+            capture->badFrames++;
+        }
+    }
+}
+
+static speed_t baudToSpeed(unsigned long baud)
+{
+    switch (baud)
+    {
+        case 9600UL:    return B9600;
+        case 19200UL:   return B19200;
+        case 38400UL:   return B38400;
+        case 57600UL:   return B57600;
+        case 115200UL:  return B115200;
+        case 230400UL:  return B230400;
+        case 460800UL:  return B460800;
+        case 921600UL:  return B921600;
+        default:        return B0;
+    }
+}
+
+static int openOutput(const char *path, unsigned long baud)
+{
+    struct termios tio;
+    speed_t speed;
+    int fd;
+
+    fd = (strcmp(path, "-") == 0) ? STDOUT_FILENO : open(path, O_WRONLY | O_CREAT | O_TRUNC | O_NOCTTY, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "hrreplay: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    if (isatty(fd) && (tcgetattr(fd, &tio) == 0))
+    {
+        speed = baudToSpeed(baud);
+        if (speed == B0)
+        {
+            fprintf(stderr, "hrreplay: unsupported baud rate %lu\n", baud);
+            close(fd);
+            return -1;
+        }
+
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        tio.c_cflag |= CLOCAL;
+
+        if (tcsetattr(fd, TCSANOW, &tio) != 0)
+        {
+            fprintf(stderr, "hrreplay: %s: %s\n", path, strerror(errno));
+            close(fd);
+            return -1;
+        }
+    }
+
+    return fd;
+}
+
+static int writeAll(int fd, const uint8_t *data, size_t size)
+{
+    ssize_t count;
+
+    while (size != 0U)
+    {
+        count = write(fd, data, size);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        data += count;
+        size -= (size_t)count;
+    }
+
+    return 0;
+}
+
+static int exportBytes(const HRREPLAY_CAPTURE *capture, const char *path)
+{
+    FILE *out = fopen(path, "wb");
+    size_t i;
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "hrreplay: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    for (i = 0U; i < capture->count; i++)
+    {
+        fwrite(capture->chunks[i].data, 1U, capture->chunks[i].record.length, out);
+    }
+
+    fclose(out);
+
+    return 0;
+}
+
+/* Capture time of a chunk in microseconds since the first one */
+static uint64_t chunkTimeUs(const HRREPLAY_CAPTURE *capture, size_t index)
+{
+    uint32_t ticks = capture->chunks[index].record.timestamp - capture->chunks[0].record.timestamp;
+
+    return ((uint64_t)ticks * 1000000U) / HRHOST_RTC_FREQUENCY;
+}
+
+static int replayToPort(const HRREPLAY_CAPTURE *capture, const HRREPLAY_OPTIONS *options)
+{
+    uint64_t startNs;
+    size_t i;
+    int fd;
+
+    fd = openOutput(options->outputPath, options->baud);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    startNs = monotonicNs();
+
+    for (i = 0U; i < capture->count; i++)
+    {
+        if (options->speed > 0.0)
+        {
+            sleepUntilNs(startNs + (uint64_t)(((double)chunkTimeUs(capture, i) * 1000.0) / options->speed));
+        }
+
+        if (writeAll(fd, capture->chunks[i].data, capture->chunks[i].record.length) != 0)
+        {
+            fprintf(stderr, "hrreplay: write: %s\n", strerror(errno));
+            return -1;
+        }
+    }
+
+    if (isatty(fd))
+    {
+        tcdrain(fd);
+    }
+
+    fprintf(stderr, "hrreplay: %zu chunks written in %.3f s\n", capture->count, (double)(monotonicNs() - startNs) / 1e9);
+
+    return 0;
+}
+
+static double virtualSeconds(void)
+{
+    return (double)HRHOST_ClockGet() / 1e6;
+}
+
+static void onHeartRate(DRV_HANDLE handle, int heartRate)
+{
+    (void)handle;
+
+    hrreplayClient.reports++;
+    if (hrreplayQuiet == 0)
+    {
+        printf("%10.3f s  hr %3d\n", virtualSeconds(), heartRate);
+    }
+}
+
+static void onSample(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    (void)handle;
+    (void)sample;
+
+    hrreplayClient.samples++;
+}
+
+static void onSession(DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary)
+{
+    (void)handle;
+
+    hrreplayClient.windows++;
+    if (hrreplayQuiet == 0)
+    {
+        printf("%10.3f s  window %lu: %u frames, %u valid, %u discarded, hr %u/%u/%u\n", virtualSeconds(),
+            (unsigned long)summary->windowIndex, summary->frameCount, summary->validCount,
+            summary->discardedCount, summary->heartRateMin, summary->heartRateMean, summary->heartRateMax);
+    }
+}
+
+/* Runs the driver until the virtual clock reaches timeUs */
+static void runUntil(SYS_MODULE_OBJ object, DRV_HANDLE *handle, uint64_t timeUs, unsigned long loopUs)
+{
+    uint64_t step;
+
+    do
+    {
+        DRV_HEARTRATE_TASKS(object);
+
+        if (*handle == DRV_HANDLE_INVALID)
+        {
+            *handle = DRV_HEARTRATE_Open(DRV_HEARTRATE_INDEX_0, DRV_IO_INTENT_READ);
+            if (*handle != DRV_HANDLE_INVALID)
+            {
+                SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_DEFAULT);
+                DRV_HEARTRATE_ClientEventHandlerSet(*handle, onHeartRate);
+                DRV_HEARTRATE_SampleEventHandlerSet(*handle, onSample);
+                DRV_HEARTRATE_SessionEventHandlerSet(*handle, onSession);
+            }
+        }
+
+        step = (timeUs > HRHOST_ClockGet()) ? (timeUs - HRHOST_ClockGet()) : 0U;
+        HRHOST_ClockAdvance((uint32_t)((step < loopUs) ? step : loopUs));
+    } while (HRHOST_ClockGet() < timeUs);
+}
+
+static int replayToDriver(const HRREPLAY_CAPTURE *capture, const HRREPLAY_OPTIONS *options)
+{
+    HRHOST_PLIB_STATS stats;
+    SYS_MODULE_OBJ object;
+    DRV_HANDLE handle = DRV_HANDLE_INVALID;
+    uint64_t startNs;
+    uint64_t originUs;
+    uint64_t elapsedNs;
+    size_t i;
+
+    hrreplayQuiet = options->quiet;
+
+    HRHOST_Initialize();
+    (void)SYS_LOG_Initialize();
+
+    object = DRV_HEARTRATE_Initialize(DRV_HEARTRATE_INDEX_0, (SYS_MODULE_INIT *)&options->init);
+    if (object == SYS_MODULE_OBJ_INVALID)
+    {
+        fprintf(stderr, "hrreplay: driver initialization failed\n");
+        return -1;
+    }
+
+    /* Open fails until the startup delay is over, the client retries every loop */
+    SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_NONE);
+
+    /* The first chunk arrives once the driver has a client */
+    runUntil(object, &handle, (uint64_t)options->init.startupDelayMs * 1000U, options->loopUs);
+    runUntil(object, &handle, HRHOST_ClockGet() + options->loopUs, options->loopUs);
+    originUs = HRHOST_ClockGet();
+
+    startNs = monotonicNs();
+
+    for (i = 0U; i < capture->count; i++)
+    {
+        runUntil(object, &handle, originUs + chunkTimeUs(capture, i), options->loopUs);
+
+        if (options->speed > 0.0)
+        {
+            sleepUntilNs(startNs + (uint64_t)(((double)chunkTimeUs(capture, i) * 1000.0) / options->speed));
+        }
+
+        (void)HRHOST_PlibFeed(capture->chunks[i].data, capture->chunks[i].record.length);
+    }
+
+    runUntil(object, &handle, HRHOST_ClockGet() + (HRREPLAY_DRAIN_LOOPS * options->loopUs), options->loopUs);
+
+    elapsedNs = monotonicNs() - startNs;
+
+    HRHOST_PlibStatsGet(&stats);
+
+    fprintf(stderr, "virtual time %.3f s, replayed in %.3f s, %.1f ns per byte\n", virtualSeconds(),
+        (double)elapsedNs / 1e9, (capture->bytes != 0U) ? ((double)elapsedNs / (double)capture->bytes) : 0.0);
+    fprintf(stderr, "ring: %lu pushed, %lu lost on overflow, peak %lu of %u, %lu callbacks, %lu dropped in reset\n",
+        (unsigned long)stats.rxCount, (unsigned long)stats.overflowCount, (unsigned long)stats.peakCount,
+        HRHOST_PLIB_RING_SIZE - 1U, (unsigned long)stats.callbackCount, (unsigned long)stats.resetDropCount);
+    fprintf(stderr, "driver: %llu samples, %llu heart rates reported, %llu windows\n",
+        (unsigned long long)hrreplayClient.samples, (unsigned long long)hrreplayClient.reports,
+        (unsigned long long)hrreplayClient.windows);
+
+    if (handle != DRV_HANDLE_INVALID)
+    {
+        DRV_HEARTRATE_Close(handle);
+    }
+
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: hrreplay [options] <telemetry capture or ->\n"
+        "  -s <speed>   wall clock speed, 1 real time, 0 as fast as possible, default 0\n"
+        "  -o <path>    write the chunks to a serial port or file instead of the driver\n"
+        "  -b <baud>    serial port baud rate, default %lu\n"
+        "  -x <file>    write the captured bytes alone\n"
+        "  -l <us>      super loop period in virtual time, default %lu\n"
+        "  -p <ms>      measurement period, default 0, the sensor streams\n"
+        "  -w <ms>      measurement window, default %lu\n"
+        "  -u <frames>  warmup frames of a window, default %lu\n"
+        "  -d <ms>      startup delay before the first chunk, default 0\n"
+        "  -r <n>       report decimation, default %lu\n"
+        "  -q           print the report only\n",
+        HRREPLAY_DEFAULT_BAUD, HRREPLAY_DEFAULT_LOOP_US,
+        (unsigned long)DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0, (unsigned long)DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0,
+        (unsigned long)DRV_HEARTRATE_REPORT_DECIMATION_IDX0);
+}
+
+static int parseOptions(int argc, char **argv, HRREPLAY_OPTIONS *options)
+{
+    int option;
+
+    memset(options, 0, sizeof(*options));
+    options->baud = HRREPLAY_DEFAULT_BAUD;
+    options->loopUs = HRREPLAY_DEFAULT_LOOP_US;
+    options->init.heartratePlib = &hrhostPlibAPI;
+    options->init.clientObjPool = (uintptr_t)&hrreplayClientObjPool[0];
+    options->init.numClients = DRV_HEARTRATE_CLIENTS_NUMBER_IDX0;
+    options->init.sessionPeriodMs = 0U;
+    options->init.sessionWindowMs = DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0;
+    options->init.sessionWarmupFrames = DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0;
+    options->init.readThreshold = DRV_HEARTRATE_READ_THRESHOLD_IDX0;
+    options->init.reportDecimation = DRV_HEARTRATE_REPORT_DECIMATION_IDX0;
+    options->init.startupDelayMs = 0U;
+
+    while ((option = getopt(argc, argv, "s:o:b:x:l:p:w:u:d:r:q")) != -1)
+    {
+        switch (option)
+        {
+            case 's': options->speed = strtod(optarg, NULL); break;
+            case 'o': options->outputPath = optarg; break;
+            case 'b': options->baud = strtoul(optarg, NULL, 0); break;
+            case 'x': options->exportPath = optarg; break;
+            case 'l': options->loopUs = strtoul(optarg, NULL, 0); break;
+            case 'p': options->init.sessionPeriodMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': options->init.sessionWindowMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'u': options->init.sessionWarmupFrames = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'd': options->init.startupDelayMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'r': options->init.reportDecimation = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'q': options->quiet = 1; break;
+            default:
+                usage();
+                return -1;
+        }
+    }
+
+    if ((optind != (argc - 1)) || (options->speed < 0.0) || (options->loopUs == 0U) ||
+        ((options->init.sessionPeriodMs != 0U) && (options->init.sessionWindowMs >= options->init.sessionPeriodMs)))
+    {
+        usage();
+        return -1;
+    }
+
+    options->capturePath = argv[optind];
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    HRREPLAY_OPTIONS options;
+    HRREPLAY_CAPTURE capture;
+    uint8_t *stream;
+    size_t size;
+    int status;
+
+    if (parseOptions(argc, argv, &options) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    stream = readFile(options.capturePath, &size);
+    if (stream == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    parseStream(&capture, stream, size);
+
+    fprintf(stderr, "capture: %zu chunks, %llu bytes over %.3f s, %llu capture frames, %llu sample frames skipped\n",
+        capture.count, (unsigned long long)capture.bytes,
+        (capture.count != 0U) ? ((double)chunkTimeUs(&capture, capture.count - 1U) / 1e6) : 0.0,
+        (unsigned long long)capture.captureFrames, (unsigned long long)capture.sampleFrames);
+    fprintf(stderr, "capture: %llu chunks missing, %llu gaps flagged by the target, %llu bad frames\n",
+        (unsigned long long)capture.missingChunks, (unsigned long long)capture.gapFlags,
+        (unsigned long long)capture.badFrames);
+
+    if (capture.count == 0U)
+    {
+        fprintf(stderr, "hrreplay: no captured chunks in %s\n", options.capturePath);
+        free(stream);
+        return EXIT_FAILURE;
+    }
+
+    status = 0;
+
+    if (options.exportPath != NULL)
+    {
+        status = exportBytes(&capture, options.exportPath);
+    }
+
+    if (status == 0)
+    {
+        status = (options.outputPath != NULL) ? replayToPort(&capture, &options) : replayToDriver(&capture, &options);
+    }
+
+    free(capture.chunks);
+    free(stream);
+
+    return (status == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
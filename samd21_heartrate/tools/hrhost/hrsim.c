@@ -0,0 +1,1062 @@
+/*******************************************************************************
+  Superloop simulator
+
+  File Name:
+    hrsim.c
+
+  Summary:
+    Runs the firmware superloop under a virtual clock and measures the time
+    from the sensor bytes to the driver client callbacks.
+
+  Description:
+    SYS_Tasks from tasks.c and the application run unchanged on top of the
+    host build of the driver. The sensor stream, a capture split in lines
+    or frames from hrgen, is scheduled on the wire at the frame rate and
+    the baud rate. Every byte runs the SERCOM0 receive interrupt of the
+    mock PLIB at its arrival time, between tasks or in the middle of one.
+
+    Each task moves the virtual clock forward by a modelled cost in CPU
+    cycles. The driver task costs a base plus a cost per byte parsed and
+    per sample, the receive interrupt a cost per byte plus the copy of the
+    read notification. SYS_POWER_Tasks sleeps until the next byte or RTC
+    compare match once the driver is idle and charges the wakeup.
+
+    The services other than the driver are stubs that only cost time. The
+    simulator opens the driver in place of the telemetry service, its
+    sample callback matches every sample to the frame it was parsed from
+    and records the time from the arrival of the ';' ending the frame to
+    the callback. The heart rate callback of the application runs in the
+    same driver task call.
+
+    Model limits: the code of a task runs at the start of its cost window
+    and only sees the bytes that arrived before it. A sample is delivered
+    at the point of the driver cost where its frame was parsed. The default
+    costs are estimates, measure them on the target with the "prof"
+    command and pass them with -C.
+*******************************************************************************/
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "definitions.h"
+#include "driver/heartrate/src/drv_heartrate_frame.h"
+#include "hrgen.h"
+#include "hrhost.h"
+
+#define HRSIM_DEFAULT_BAUD          115200UL
+#define HRSIM_DEFAULT_RATE_HZ       100.0
+#define HRSIM_DEFAULT_SECONDS       60.0
+#define HRSIM_DEFAULT_MHZ           8.0
+
+/* Frames searched ahead of the last match for the frame of a sample */
+#define HRSIM_MATCH_WINDOW          256U
+
+/* Latency histogram buckets, powers of two in microseconds */
+#define HRSIM_HISTOGRAM_BUCKETS     24U
+#define HRSIM_HISTOGRAM_WIDTH       50U
+
+/* Task costs in CPU cycles */
+typedef struct
+{
+    uint32_t    console;
+    uint32_t    command;
+    uint32_t    tlog;
+    uint32_t    telemetry;
+    uint32_t    flashlog;
+    uint32_t    cfg;
+    uint32_t    app;
+    uint32_t    driver;
+    uint32_t    driverByte;
+    uint32_t    driverSample;
+    uint32_t    isr;
+    uint32_t    notify;
+    uint32_t    power;
+    uint32_t    wake;
+} HRSIM_COSTS;
+
+typedef struct
+{
+    const char *name;
+    size_t      offset;
+    const char *help;
+} HRSIM_COST_KEY;
+
+static const HRSIM_COST_KEY hrsimCostKeys[] =
+{
+    { "console",   offsetof(HRSIM_COSTS, console),      "SYS_CONSOLE_Tasks" },
+    { "cmd",       offsetof(HRSIM_COSTS, command),      "SYS_CMD_Tasks" },
+    { "tlog",      offsetof(HRSIM_COSTS, tlog),         "SYS_TLOG_Tasks" },
+    { "telemetry", offsetof(HRSIM_COSTS, telemetry),    "SYS_TELEMETRY_Tasks" },
+    { "flashlog",  offsetof(HRSIM_COSTS, flashlog),     "SYS_FLASHLOG_Tasks" },
+    { "cfg",       offsetof(HRSIM_COSTS, cfg),          "SYS_CFG_Tasks" },
+    { "app",       offsetof(HRSIM_COSTS, app),          "APP_Tasks" },
+    { "driver",    offsetof(HRSIM_COSTS, driver),       "DRV_HEARTRATE_TASKS, per call" },
+    { "byte",      offsetof(HRSIM_COSTS, driverByte),   "DRV_HEARTRATE_TASKS, per byte parsed" },
+    { "sample",    offsetof(HRSIM_COSTS, driverSample), "DRV_HEARTRATE_TASKS, per sample and its callbacks" },
+    { "isr",       offsetof(HRSIM_COSTS, isr),          "SERCOM0 receive interrupt, per byte" },
+    { "notify",    offsetof(HRSIM_COSTS, notify),       "read notification, per callback" },
+    { "power",     offsetof(HRSIM_COSTS, power),        "SYS_POWER_Tasks" },
+    { "wake",      offsetof(HRSIM_COSTS, wake),         "wakeup from sleep" },
+};
+
+static const HRSIM_COSTS hrsimDefaultCosts =
+{
+    .console = 200U,
+    .command = 150U,
+    .tlog = 100U,
+    .telemetry = 300U,
+    .flashlog = 100U,
+    .cfg = 50U,
+    .app = 100U,
+    .driver = 300U,
+    .driverByte = 60U,
+    .driverSample = 400U,
+    .isr = 120U,
+    .notify = 300U,
+    .power = 80U,
+    .wake = 160U,
+};
+
+typedef struct
+{
+    const char     *inputPath;
+    const char     *csvPath;
+    unsigned long   baud;
+    double          rateHz;
+    double          seconds;
+    uint32_t        seed;
+    double          mhz;
+    HRSIM_COSTS     costs;
+    DRV_HEARTRATE_INIT init;
+    int             quiet;
+} HRSIM_OPTIONS;
+
+/* Sensor bytes with their arrival times on the wire */
+typedef struct
+{
+    uint8_t        *data;
+    uint64_t       *arrivalNs;
+    size_t          size;
+    size_t          capacity;
+    size_t          next;
+    uint64_t        lines;
+} HRSIM_STREAM;
+
+typedef struct
+{
+    /* Arrival of the byte that ends the frame */
+    uint64_t        endNs;
+
+    uint64_t        callbackNs;
+
+    DRV_HEARTRATE_FRAME frame;
+
+    bool            delivered;
+
+} HRSIM_FRAME;
+
+typedef struct
+{
+    HRSIM_FRAME    *list;
+    size_t          count;
+    size_t          cursor;
+    /* Frames that ended before the last callback */
+    size_t          arrived;
+    bool            matching;
+    uint64_t        delivered;
+    uint64_t        lost;
+    uint64_t        unmatched;
+} HRSIM_FRAMES;
+
+typedef struct
+{
+    uint64_t        nowNs;
+    bool            done;
+
+    DRV_HANDLE      handle;
+
+    /* Driver task call in progress */
+    uint64_t        driverStartNs;
+    uint32_t        backlogStart;
+    uint32_t        callSamples;
+
+    uint64_t        loops;
+    uint64_t        loopMaxNs;
+    uint64_t        busyNs;
+    uint64_t        sleepNs;
+    uint64_t        sleeps;
+    uint64_t        isrNs;
+    uint64_t        isrCount;
+    uint64_t        driverCalls;
+    uint64_t        driverNs;
+    uint64_t        driverMaxNs;
+    uint64_t        reports;
+    uint64_t        windows;
+} HRSIM_STATE;
+
+SYSTEM_OBJECTS sysObj;
+
+static DRV_HEARTRATE_CLIENT_OBJ hrsimClientObjPool[DRV_HEARTRATE_CLIENTS_NUMBER_IDX0];
+
+static HRSIM_OPTIONS hrsimOptions;
+static HRSIM_STREAM hrsimStream;
+static HRSIM_FRAMES hrsimFrames;
+static HRSIM_STATE hrsim;
+
+// *****************************************************************************
+// Section: Virtual clock
+// *****************************************************************************
+
+static uint64_t cyclesToNs(uint64_t cycles)
+{
+    return (uint64_t)(((double)cycles * 1000.0 / hrsimOptions.mhz) + 0.5);
+}
+
+/* The mock RTC and SysTick count whole microseconds */
+static void clockSet(uint64_t ns)
+{
+    HRHOST_ClockAdvance((uint32_t)((ns / 1000U) - (hrsim.nowNs / 1000U)));
+    hrsim.nowNs = ns;
+}
+
+/* Receive interrupt of the next byte, the byte is lost without a cost
+   while the sensor is held in reset */
+static void byteReceive(void)
+{
+    HRHOST_PLIB_STATS before;
+    HRHOST_PLIB_STATS after;
+    uint64_t cycles = hrsimOptions.costs.isr;
+    uint64_t ns;
+    bool running = HRHOST_ResetPinGet();
+
+    HRHOST_PlibStatsGet(&before);
+    (void)HRHOST_PlibFeed(&hrsimStream.data[hrsimStream.next], 1U);
+    hrsimStream.next++;
+
+    if (running == false)
+    {
+        return;
+    }
+
+    HRHOST_PlibStatsGet(&after);
+    if (after.callbackCount != before.callbackCount)
+    {
+        cycles += hrsimOptions.costs.notify;
+    }
+
+    ns = cyclesToNs(cycles);
+    hrsim.isrNs += ns;
+    hrsim.isrCount++;
+    clockSet(hrsim.nowNs + ns);
+}
+
+/* Task code taking the given cycles, the bytes arriving meanwhile
+   interrupt it and stretch it by the interrupt time */
+static void taskRun(uint64_t cycles)
+{
+    uint64_t remaining = cyclesToNs(cycles);
+    uint64_t arrival;
+
+    while ((hrsimStream.next < hrsimStream.size) &&
+           (hrsimStream.arrivalNs[hrsimStream.next] <= (hrsim.nowNs + remaining)))
+    {
+        arrival = hrsimStream.arrivalNs[hrsimStream.next];
+        if (arrival > hrsim.nowNs)
+        {
+            remaining -= arrival - hrsim.nowNs;
+            hrsim.busyNs += arrival - hrsim.nowNs;
+            clockSet(arrival);
+        }
+        byteReceive();
+    }
+
+    hrsim.busyNs += remaining;
+    clockSet(hrsim.nowNs + remaining);
+}
+
+// *****************************************************************************
+// Section: Sensor stream
+// *****************************************************************************
+
+/* Puts a frame on the wire at the given time, or right after the previous
+   frame if that one is still being sent */
+static int streamAppend(const uint8_t *data, size_t size, uint64_t startNs)
+{
+    HRSIM_STREAM *stream = &hrsimStream;
+    uint64_t byteNs = 10000000000ULL / hrsimOptions.baud;
+    uint64_t at = startNs;
+    size_t i;
+
+    if ((stream->size != 0U) && (stream->arrivalNs[stream->size - 1U] > at))
+    {
+        at = stream->arrivalNs[stream->size - 1U];
+    }
+
+    while ((stream->size + size) > stream->capacity)
+    {
+        stream->capacity = (stream->capacity != 0U) ? (stream->capacity * 2U) : 65536U;
+        stream->data = realloc(stream->data, stream->capacity);
+        stream->arrivalNs = realloc(stream->arrivalNs, stream->capacity * sizeof(uint64_t));
+        if ((stream->data == NULL) || (stream->arrivalNs == NULL))
+        {
+            fprintf(stderr, "hrsim: out of memory\n");
+            return -1;
+        }
+    }
+
+    for (i = 0U; i < size; i++)
+    {
+        at += byteNs;
+        stream->data[stream->size] = data[i];
+        stream->arrivalNs[stream->size] = at;
+        stream->size++;
+    }
+
+    stream->lines++;
+
+    return 0;
+}
+
+static uint64_t lineStartNs(uint64_t line)
+{
+    return (uint64_t)(((double)line * 1e9) / hrsimOptions.rateHz);
+}
+
+/* A capture in the hr9cap format, one line per frame period */
+static int streamLoadFile(const char *path)
+{
+    FILE *in = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    uint8_t line[HRGEN_FRAME_MAX];
+    size_t len = 0U;
+    int c;
+    int result = 0;
+
+    if (in == NULL)
+    {
+        fprintf(stderr, "hrsim: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    while ((result == 0) && ((c = fgetc(in)) != EOF))
+    {
+        line[len++] = (uint8_t)c;
+        if ((c == '\n') || (len == sizeof(line)))
+        {
+            result = streamAppend(line, len, lineStartNs(hrsimStream.lines));
+            len = 0U;
+        }
+    }
+
+    if ((result == 0) && (len != 0U))
+    {
+        result = streamAppend(line, len, lineStartNs(hrsimStream.lines));
+    }
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    return result;
+}
+
+static int streamGenerate(void)
+{
+    HRGEN_CONFIG config;
+    HRGEN gen;
+    uint8_t frame[HRGEN_FRAME_MAX];
+    uint64_t frames = (uint64_t)(hrsimOptions.seconds * hrsimOptions.rateHz);
+    uint64_t i;
+    size_t len;
+
+    HRGEN_ConfigDefault(&config);
+    config.frameRateHz = hrsimOptions.rateHz;
+    config.seed = hrsimOptions.seed;
+    HRGEN_Initialize(&gen, &config);
+
+    for (i = 0U; i < frames; i++)
+    {
+        len = HRGEN_FrameNext(&gen, frame);
+        if (streamAppend(frame, len, lineStartNs(i)) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* The frames the driver can parse from the stream, with the arrival of
+   their last byte */
+static int framesFind(void)
+{
+    HRSIM_FRAMES *frames = &hrsimFrames;
+    DRV_HEARTRATE_FRAME_PARSER parser;
+    size_t capacity = 0U;
+    size_t offset = 0U;
+    bool complete;
+
+    DRV_HEARTRATE_FrameParserReset(&parser);
+
+    while (offset < hrsimStream.size)
+    {
+        offset += DRV_HEARTRATE_FrameParse(&parser, &hrsimStream.data[offset], hrsimStream.size - offset, &complete);
+        if (complete == false)
+        {
+            continue;
+        }
+
+        if (frames->count == capacity)
+        {
+            capacity = (capacity != 0U) ? (capacity * 2U) : 4096U;
+            frames->list = realloc(frames->list, capacity * sizeof(HRSIM_FRAME));
+            if (frames->list == NULL)
+            {
+                fprintf(stderr, "hrsim: out of memory\n");
+                return -1;
+            }
+        }
+
+        memset(&frames->list[frames->count], 0, sizeof(HRSIM_FRAME));
+        frames->list[frames->count].endNs = hrsimStream.arrivalNs[offset - 1U];
+        frames->list[frames->count].frame = parser.frame;
+        frames->count++;
+    }
+
+    return 0;
+}
+
+/* Frames between two delivered ones of the same window are lost, the
+   frames before the first delivery of a window are its warmup. The search
+   covers the frames that ended before the callback, at most
+   HRSIM_MATCH_WINDOW of them. */
+static void frameMatch(const DRV_HEARTRATE_FRAME *frame, uint64_t atNs)
+{
+    HRSIM_FRAMES *frames = &hrsimFrames;
+    HRSIM_FRAME *candidate;
+    size_t start = frames->cursor;
+    size_t i;
+
+    while ((frames->arrived < frames->count) && (frames->list[frames->arrived].endNs <= atNs))
+    {
+        frames->arrived++;
+    }
+
+    if ((frames->arrived > HRSIM_MATCH_WINDOW) && (start < (frames->arrived - HRSIM_MATCH_WINDOW)))
+    {
+        start = frames->arrived - HRSIM_MATCH_WINDOW;
+    }
+
+    for (i = start; i < frames->arrived; i++)
+    {
+        candidate = &frames->list[i];
+
+        if ((memcmp(candidate->frame.channel, frame->channel, sizeof(frame->channel)) == 0) &&
+            (candidate->frame.heartRate == frame->heartRate))
+        {
+            if (frames->matching == true)
+            {
+                frames->lost += i - frames->cursor;
+            }
+            candidate->delivered = true;
+            candidate->callbackNs = atNs;
+            frames->delivered++;
+            frames->cursor = i + 1U;
+            frames->matching = true;
+            return;
+        }
+    }
+
+    frames->unmatched++;
+}
+
+// *****************************************************************************
+// Section: Simulator client
+// *****************************************************************************
+
+static void onSample(DRV_HANDLE handle, const DRV_HEARTRATE_SAMPLE *sample)
+{
+    uint32_t backlog = DRV_HEARTRATE_BacklogGet(sysObj.drvHeartRate0);
+    uint32_t parsed = (backlog < hrsim.backlogStart) ? (hrsim.backlogStart - backlog) : 0U;
+    const HRSIM_COSTS *costs = &hrsimOptions.costs;
+
+    (void)handle;
+
+    hrsim.callSamples++;
+    frameMatch(&sample->frame, hrsim.driverStartNs + cyclesToNs((uint64_t)costs->driver +
+        ((uint64_t)costs->driverByte * parsed) + ((uint64_t)costs->driverSample * hrsim.callSamples)));
+}
+
+static void onHeartRate(DRV_HANDLE handle, int heartRate)
+{
+    (void)handle;
+    (void)heartRate;
+
+    hrsim.reports++;
+}
+
+static void onSession(DRV_HANDLE handle, const DRV_HEARTRATE_SESSION_SUMMARY *summary)
+{
+    (void)handle;
+    (void)summary;
+
+    hrsim.windows++;
+    hrsimFrames.matching = false;
+}
+
+// *****************************************************************************
+// Section: Tasks called by SYS_Tasks
+// *****************************************************************************
+
+/* tasks.c is built with DRV_HEARTRATE_TASKS and APP_Tasks renamed to these */
+void HRSIM_DriverTasks( SYS_MODULE_OBJ object )
+{
+    const HRSIM_COSTS *costs = &hrsimOptions.costs;
+    uint32_t backlog;
+    uint32_t parsed;
+    uint64_t startNs = hrsim.nowNs;
+    uint64_t ns;
+
+    hrsim.driverStartNs = hrsim.nowNs;
+    hrsim.backlogStart = DRV_HEARTRATE_BacklogGet(object);
+    hrsim.callSamples = 0U;
+
+    DRV_HEARTRATE_TASKS(object);
+
+    backlog = DRV_HEARTRATE_BacklogGet(object);
+    parsed = (backlog < hrsim.backlogStart) ? (hrsim.backlogStart - backlog) : 0U;
+
+    taskRun((uint64_t)costs->driver + ((uint64_t)costs->driverByte * parsed) +
+        ((uint64_t)costs->driverSample * hrsim.callSamples));
+
+    ns = hrsim.nowNs - startNs;
+    hrsim.driverCalls++;
+    hrsim.driverNs += ns;
+    if (ns > hrsim.driverMaxNs)
+    {
+        hrsim.driverMaxNs = ns;
+    }
+}
+
+void HRSIM_AppTasks( void )
+{
+    APP_Tasks();
+    taskRun(hrsimOptions.costs.app);
+}
+
+void SYS_CONSOLE_Tasks( SYS_MODULE_OBJ object )
+{
+    (void)object;
+    taskRun(hrsimOptions.costs.console);
+}
+
+bool SYS_CMD_Tasks( void )
+{
+    taskRun(hrsimOptions.costs.command);
+    return true;
+}
+
+void SYS_TLOG_Tasks( void )
+{
+    taskRun(hrsimOptions.costs.tlog);
+}
+
+/* Opens the simulator client in the slot the telemetry service uses */
+void SYS_TELEMETRY_Tasks( void )
+{
+    if (hrsim.handle == DRV_HANDLE_INVALID)
+    {
+        hrsim.handle = DRV_HEARTRATE_Open(DRV_HEARTRATE_INDEX_0, DRV_IO_INTENT_READ);
+        if (hrsim.handle != DRV_HANDLE_INVALID)
+        {
+            if (hrsimOptions.quiet == 0)
+            {
+                SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_DEFAULT);
+            }
+            DRV_HEARTRATE_SampleEventHandlerSet(hrsim.handle, onSample);
+            DRV_HEARTRATE_ClientEventHandlerSet(hrsim.handle, onHeartRate);
+            DRV_HEARTRATE_SessionEventHandlerSet(hrsim.handle, onSession);
+        }
+    }
+
+    taskRun(hrsimOptions.costs.telemetry);
+}
+
+/* The loopback self-test is never started in the simulator */
+void SYS_LOOPBACK_Tasks( void )
+{
+}
+
+void SYS_FLASHLOG_Tasks( void )
+{
+    taskRun(hrsimOptions.costs.flashlog);
+}
+
+bool SYS_FLASHLOG_Append( const void * record )
+{
+    (void)record;
+    return true;
+}
+
+void SYS_FLASHLOG_Flush( void )
+{
+}
+
+void SYS_CFG_Tasks( void )
+{
+    taskRun(hrsimOptions.costs.cfg);
+}
+
+/* Sleeps once the driver is idle until a byte from the running sensor or
+   the RTC compare match wakes the device, ends the run when the input is
+   over */
+void SYS_POWER_Tasks( void )
+{
+    uint64_t wakeNs = UINT64_MAX;
+    uint32_t compare;
+
+    taskRun(hrsimOptions.costs.power);
+
+    if (DRV_HEARTRATE_IsIdle(sysObj.drvHeartRate0) == false)
+    {
+        return;
+    }
+
+    if (HRHOST_RtcCompareGet(&compare) == true)
+    {
+        wakeNs = (((uint64_t)compare * 1000000000ULL) + HRHOST_RTC_FREQUENCY - 1U) / HRHOST_RTC_FREQUENCY;
+    }
+
+    /* The sensor does not send while it is held in reset */
+    while ((hrsimStream.next < hrsimStream.size) && (HRHOST_ResetPinGet() == false) &&
+           (hrsimStream.arrivalNs[hrsimStream.next] < wakeNs))
+    {
+        byteReceive();
+    }
+
+    if (hrsimStream.next >= hrsimStream.size)
+    {
+        hrsim.done = true;
+        return;
+    }
+
+    if (hrsimStream.arrivalNs[hrsimStream.next] < wakeNs)
+    {
+        wakeNs = hrsimStream.arrivalNs[hrsimStream.next];
+    }
+
+    if (wakeNs > hrsim.nowNs)
+    {
+        hrsim.sleepNs += wakeNs - hrsim.nowNs;
+        clockSet(wakeNs);
+    }
+
+    hrsim.sleeps++;
+    taskRun(hrsimOptions.costs.wake);
+}
+
+void SERCOM0_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void SERCOM0_USART_StatsReset( void )
+{
+}
+
+size_t SERCOM0_USART_ReadBufferSizeGet( void )
+{
+    return HRHOST_PLIB_RING_SIZE - 1U;
+}
+
+size_t SERCOM0_USART_WriteBufferSizeGet( void )
+{
+    return 0U;
+}
+
+void SERCOM2_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void SERCOM2_USART_StatsReset( void )
+{
+}
+
+void SERCOM3_USART_StatsGet( SERCOM_USART_STATS * stats )
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void SERCOM3_USART_StatsReset( void )
+{
+}
+
+size_t SERCOM3_USART_ReadBufferSizeGet( void )
+{
+    return 0U;
+}
+
+size_t SERCOM3_USART_WriteBufferSizeGet( void )
+{
+    return 0U;
+}
+
+// *****************************************************************************
+// Section: Report
+// *****************************************************************************
+
+static int compareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static double percentileUs(const uint64_t *sorted, size_t count, double percent)
+{
+    size_t index = (size_t)((percent / 100.0) * (double)(count - 1U) + 0.5);
+
+    return (double)sorted[index] / 1000.0;
+}
+
+static uint32_t histogramBucket(uint64_t ns)
+{
+    uint64_t us = ns / 1000U;
+    uint32_t bucket = 0U;
+
+    while ((us > 1U) && (bucket < (HRSIM_HISTOGRAM_BUCKETS - 1U)))
+    {
+        us >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+static void latencyReport(void)
+{
+    uint64_t *latency;
+    uint64_t histogram[HRSIM_HISTOGRAM_BUCKETS] = { 0 };
+    uint64_t peak = 0U;
+    uint64_t sum = 0U;
+    uint32_t first = HRSIM_HISTOGRAM_BUCKETS;
+    uint32_t last = 0U;
+    uint32_t bucket;
+    size_t count = 0U;
+    size_t i;
+
+    latency = malloc(((hrsimFrames.delivered != 0U) ? hrsimFrames.delivered : 1U) * sizeof(uint64_t));
+    if (latency == NULL)
+    {
+        fprintf(stderr, "hrsim: out of memory\n");
+        return;
+    }
+
+    for (i = 0U; i < hrsimFrames.count; i++)
+    {
+        if (hrsimFrames.list[i].delivered == true)
+        {
+            latency[count] = hrsimFrames.list[i].callbackNs - hrsimFrames.list[i].endNs;
+            sum += latency[count];
+            bucket = histogramBucket(latency[count]);
+            histogram[bucket]++;
+            first = (bucket < first) ? bucket : first;
+            last = (bucket > last) ? bucket : last;
+            count++;
+        }
+    }
+
+    if (count == 0U)
+    {
+        printf("latency: no sample delivered\n");
+        free(latency);
+        return;
+    }
+
+    qsort(latency, count, sizeof(uint64_t), compareU64);
+
+    printf("latency, end of frame to sample callback, %zu samples:\n", count);
+    printf("  min %.1f us, p50 %.1f us, p90 %.1f us, p99 %.1f us, max %.1f us, mean %.1f us\n",
+        (double)latency[0] / 1000.0, percentileUs(latency, count, 50.0), percentileUs(latency, count, 90.0),
+        percentileUs(latency, count, 99.0), (double)latency[count - 1U] / 1000.0,
+        (double)sum / (double)count / 1000.0);
+
+    for (bucket = first; bucket <= last; bucket++)
+    {
+        peak = (histogram[bucket] > peak) ? histogram[bucket] : peak;
+    }
+
+    for (bucket = first; bucket <= last; bucket++)
+    {
+        printf("  %7lu us %8llu %.*s\n", (bucket == 0U) ? 0UL : (1UL << bucket),
+            (unsigned long long)histogram[bucket],
+            (int)((histogram[bucket] * HRSIM_HISTOGRAM_WIDTH + peak - 1U) / peak),
+            "##################################################");
+    }
+
+    free(latency);
+}
+
+static void report(void)
+{
+    HRHOST_PLIB_STATS stats;
+    double seconds = (double)hrsim.nowNs / 1e9;
+
+    HRHOST_PlibStatsGet(&stats);
+
+    printf("virtual time %.3f s at %.1f MHz, %zu bytes in %llu lines, %zu frames\n", seconds, hrsimOptions.mhz,
+        hrsimStream.size, (unsigned long long)hrsimStream.lines, hrsimFrames.count);
+    printf("loop: %llu iterations, longest %.1f us, cpu busy %.1f%%, interrupts %.1f%%, %llu sleeps\n",
+        (unsigned long long)hrsim.loops, (double)hrsim.loopMaxNs / 1000.0,
+        (hrsim.nowNs != 0U) ? ((double)hrsim.busyNs * 100.0 / (double)hrsim.nowNs) : 0.0,
+        (hrsim.nowNs != 0U) ? ((double)hrsim.isrNs * 100.0 / (double)hrsim.nowNs) : 0.0,
+        (unsigned long long)hrsim.sleeps);
+    printf("driver task: %llu calls, mean %.1f us, longest %.1f us\n", (unsigned long long)hrsim.driverCalls,
+        (hrsim.driverCalls != 0U) ? ((double)hrsim.driverNs / (double)hrsim.driverCalls / 1000.0) : 0.0,
+        (double)hrsim.driverMaxNs / 1000.0);
+    printf("ring: %lu pushed, %lu lost on overflow, peak %lu of %u, %lu callbacks, %lu dropped in reset\n",
+        (unsigned long)stats.rxCount, (unsigned long)stats.overflowCount, (unsigned long)stats.peakCount,
+        HRHOST_PLIB_RING_SIZE - 1U, (unsigned long)stats.callbackCount, (unsigned long)stats.resetDropCount);
+    printf("samples: %llu delivered, %llu lost between deliveries, %llu not matched to a frame, "
+        "%llu heart rates reported, %llu windows\n",
+        (unsigned long long)hrsimFrames.delivered, (unsigned long long)hrsimFrames.lost,
+        (unsigned long long)hrsimFrames.unmatched, (unsigned long long)hrsim.reports,
+        (unsigned long long)hrsim.windows);
+
+    latencyReport();
+}
+
+static int csvWrite(const char *path)
+{
+    FILE *out = fopen(path, "w");
+    size_t i;
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "hrsim: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    fprintf(out, "frame,end_us,callback_us,latency_us\n");
+    for (i = 0U; i < hrsimFrames.count; i++)
+    {
+        if (hrsimFrames.list[i].delivered == true)
+        {
+            fprintf(out, "%zu,%.3f,%.3f,%.3f\n", i, (double)hrsimFrames.list[i].endNs / 1000.0,
+                (double)hrsimFrames.list[i].callbackNs / 1000.0,
+                (double)(hrsimFrames.list[i].callbackNs - hrsimFrames.list[i].endNs) / 1000.0);
+        }
+    }
+
+    fclose(out);
+
+    return 0;
+}
+
+// *****************************************************************************
+// Section: Options
+// *****************************************************************************
+
+static void usage(void)
+{
+    size_t i;
+
+    fprintf(stderr,
+        "usage: hrsim [options] [capture file or -]\n"
+        "  without a capture, hrgen frames are simulated\n"
+        "  -t <s>       seconds of hrgen frames, default %.0f\n"
+        "  -s <seed>    hrgen seed, default 9\n"
+        "  -F <hz>      frame rate, lines per second of a capture, default %.0f\n"
+        "  -b <baud>    sensor baud rate, default %lu\n"
+        "  -f <mhz>     CPU clock the costs are counted in, default %.0f\n"
+        "  -C <k>=<cycles>[,...]  task costs, see below\n"
+        "  -p <ms>      measurement period, 0 streams, default %lu\n"
+        "  -w <ms>      measurement window, default %lu\n"
+        "  -u <frames>  warmup frames of a window, default %lu\n"
+        "  -d <ms>      streaming startup delay, default %lu\n"
+        "  -r <n>       report decimation, default %lu\n"
+        "  -o <file>    latency of every sample as CSV\n"
+        "  -q           no driver and application log\n"
+        "costs in cycles:\n",
+        HRSIM_DEFAULT_SECONDS, HRSIM_DEFAULT_RATE_HZ, HRSIM_DEFAULT_BAUD, HRSIM_DEFAULT_MHZ,
+        (unsigned long)DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0, (unsigned long)DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0,
+        (unsigned long)DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0, (unsigned long)DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0,
+        (unsigned long)DRV_HEARTRATE_REPORT_DECIMATION_IDX0);
+
+    for (i = 0U; i < (sizeof(hrsimCostKeys) / sizeof(hrsimCostKeys[0])); i++)
+    {
+        fprintf(stderr, "  %-10s %5lu  %s\n", hrsimCostKeys[i].name,
+            (unsigned long)*(const uint32_t *)((const uint8_t *)&hrsimDefaultCosts + hrsimCostKeys[i].offset),
+            hrsimCostKeys[i].help);
+    }
+}
+
+static int costsParse(char *list, HRSIM_COSTS *costs)
+{
+    char *item;
+    char *value;
+    size_t i;
+
+    for (item = strtok(list, ","); item != NULL; item = strtok(NULL, ","))
+    {
+        value = strchr(item, '=');
+        if (value == NULL)
+        {
+            return -1;
+        }
+        *value++ = '\0';
+
+        for (i = 0U; i < (sizeof(hrsimCostKeys) / sizeof(hrsimCostKeys[0])); i++)
+        {
+            if (strcmp(item, hrsimCostKeys[i].name) == 0)
+            {
+                *(uint32_t *)((uint8_t *)costs + hrsimCostKeys[i].offset) = (uint32_t)strtoul(value, NULL, 0);
+                break;
+            }
+        }
+
+        if (i == (sizeof(hrsimCostKeys) / sizeof(hrsimCostKeys[0])))
+        {
+            fprintf(stderr, "hrsim: unknown cost %s\n", item);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int parseOptions(int argc, char **argv, HRSIM_OPTIONS *options)
+{
+    int option;
+
+    memset(options, 0, sizeof(*options));
+    options->baud = HRSIM_DEFAULT_BAUD;
+    options->rateHz = HRSIM_DEFAULT_RATE_HZ;
+    options->seconds = HRSIM_DEFAULT_SECONDS;
+    options->seed = 9U;
+    options->mhz = HRSIM_DEFAULT_MHZ;
+    options->costs = hrsimDefaultCosts;
+    options->init.heartratePlib = &hrhostPlibAPI;
+    options->init.clientObjPool = (uintptr_t)&hrsimClientObjPool[0];
+    options->init.numClients = DRV_HEARTRATE_CLIENTS_NUMBER_IDX0;
+    options->init.sessionPeriodMs = DRV_HEARTRATE_SESSION_PERIOD_MS_IDX0;
+    options->init.sessionWindowMs = DRV_HEARTRATE_SESSION_WINDOW_MS_IDX0;
+    options->init.sessionWarmupFrames = DRV_HEARTRATE_SESSION_WARMUP_FRAMES_IDX0;
+    options->init.readThreshold = DRV_HEARTRATE_READ_THRESHOLD_IDX0;
+    options->init.reportDecimation = DRV_HEARTRATE_REPORT_DECIMATION_IDX0;
+    options->init.startupDelayMs = DRV_HEARTRATE_STARTUP_DELAY_MS_IDX0;
+
+    while ((option = getopt(argc, argv, "t:s:F:b:f:C:p:w:u:d:r:o:q")) != -1)
+    {
+        switch (option)
+        {
+            case 't': options->seconds = strtod(optarg, NULL); break;
+            case 's': options->seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'F': options->rateHz = strtod(optarg, NULL); break;
+            case 'b': options->baud = strtoul(optarg, NULL, 0); break;
+            case 'f': options->mhz = strtod(optarg, NULL); break;
+            case 'C':
+                if (costsParse(optarg, &options->costs) != 0)
+                {
+                    usage();
+                    return -1;
+                }
+                break;
+            case 'p': options->init.sessionPeriodMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': options->init.sessionWindowMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'u': options->init.sessionWarmupFrames = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'd': options->init.startupDelayMs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'r': options->init.reportDecimation = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'o': options->csvPath = optarg; break;
+            case 'q': options->quiet = 1; break;
+            default:
+                usage();
+                return -1;
+        }
+    }
+
+    if ((optind < (argc - 1)) || (options->baud == 0U) || (options->rateHz <= 0.0) ||
+        (options->seconds <= 0.0) || (options->mhz <= 0.0) ||
+        ((options->init.sessionPeriodMs != 0U) && (options->init.sessionWindowMs >= options->init.sessionPeriodMs)))
+    {
+        usage();
+        return -1;
+    }
+
+    options->inputPath = (optind < argc) ? argv[optind] : NULL;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t loopStartNs;
+    uint64_t sleepStartNs;
+    uint64_t loopNs;
+    int result;
+
+    if (parseOptions(argc, argv, &hrsimOptions) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    result = (hrsimOptions.inputPath != NULL) ? streamLoadFile(hrsimOptions.inputPath) : streamGenerate();
+    if ((result != 0) || (framesFind() != 0))
+    {
+        return EXIT_FAILURE;
+    }
+
+    hrsim.handle = DRV_HANDLE_INVALID;
+
+    HRHOST_Initialize();
+    (void)SYS_LOG_Initialize();
+
+    /* Open fails until the startup delay is over, the application retries
+       every loop */
+    SYS_LOG_ThresholdSet(SYS_LOG_MODULE_HEARTRATE, SYS_LOG_LEVEL_NONE);
+    if (hrsimOptions.quiet != 0)
+    {
+        SYS_LOG_ThresholdSet(SYS_LOG_MODULE_APP, SYS_LOG_LEVEL_NONE);
+    }
+
+    sysObj.drvHeartRate0 = DRV_HEARTRATE_Initialize(DRV_HEARTRATE_INDEX_0, (SYS_MODULE_INIT *)&hrsimOptions.init);
+    if (sysObj.drvHeartRate0 == SYS_MODULE_OBJ_INVALID)
+    {
+        fprintf(stderr, "hrsim: driver initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    APP_Initialize();
+
+    while (hrsim.done == false)
+    {
+        loopStartNs = hrsim.nowNs;
+        sleepStartNs = hrsim.sleepNs;
+
+        SYS_Tasks();
+
+        hrsim.loops++;
+        loopNs = (hrsim.nowNs - loopStartNs) - (hrsim.sleepNs - sleepStartNs);
+        if (loopNs > hrsim.loopMaxNs)
+        {
+            hrsim.loopMaxNs = loopNs;
+        }
+    }
+
+    report();
+
+    if ((hrsimOptions.csvPath != NULL) && (csvWrite(hrsimOptions.csvPath) != 0))
+    {
+        return EXIT_FAILURE;
+    }
+
+    free(hrsimStream.data);
+    free(hrsimStream.arrivalNs);
+    free(hrsimFrames.list);
+
+    return EXIT_SUCCESS;
+}
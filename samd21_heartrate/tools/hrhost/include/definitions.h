@@ -0,0 +1,62 @@
+/*******************************************************************************
+  System Definitions of the host build
+
+  File Name:
+    definitions.h
+
+  Summary:
+    Replaces the firmware definitions.h on the host.
+
+  Description:
+    The firmware header includes every PLIB. Its includes are resolved
+    from config/default first, so the host plib_port.h would not be picked
+    up through it. This one includes the modules the host build links and
+    takes plib_port.h from the host include directory.
+
+    The services and the application that tasks.c calls are declared as
+    well, with the system objects, for the superloop simulator. Tools that
+    do not call them do not link them.
+*******************************************************************************/
+
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "peripheral/port/plib_port.h"
+#include "peripheral/systick/plib_systick.h"
+#include "peripheral/rtc/plib_rtc.h"
+#include "peripheral/sercom/usart/plib_sercom0_usart.h"
+#include "peripheral/sercom/usart/plib_sercom2_usart.h"
+#include "peripheral/sercom/usart/plib_sercom3_usart.h"
+#include "driver/heartrate/drv_heartrate.h"
+#include "system/console/sys_console.h"
+#include "system/command/sys_command.h"
+#include "system/int/sys_int.h"
+#include "system/profile/sys_profile.h"
+#include "system/tlog/sys_tlog.h"
+#include "system/log/sys_log.h"
+#include "system/fmt/sys_fmt.h"
+#include "system/boot/sys_boot.h"
+#include "system/power/sys_power.h"
+#include "system/telemetry/sys_telemetry.h"
+#include "system/loopback/sys_loopback.h"
+#include "system/flashlog/sys_flashlog.h"
+#include "system/cfg/sys_cfg.h"
+#include "system/hrcodec/sys_hrcodec.h"
+#include "osal/osal.h"
+#include "app.h"
+
+typedef struct
+{
+    SYS_MODULE_OBJ  sysConsole0;
+    SYS_MODULE_OBJ  drvHeartRate0;
+
+} SYSTEM_OBJECTS;
+
+extern SYSTEM_OBJECTS sysObj;
+
+void SYS_Tasks ( void );
+
+#endif // DEFINITIONS_H
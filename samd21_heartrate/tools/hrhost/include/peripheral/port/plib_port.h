@@ -0,0 +1,42 @@
+/*******************************************************************************
+  PORT PLIB of the host build
+
+  File Name:
+    plib_port.h
+
+  Summary:
+    Replaces the firmware peripheral/port/plib_port.h on the host.
+
+  Description:
+    The firmware macros write the PORT registers. The sensor reset pin is
+    the only pin the driver uses, its macros go to the host mock instead.
+*******************************************************************************/
+
+#ifndef PLIB_PORT_H
+#define PLIB_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void HRHOST_ResetPinSet( bool state );
+
+bool HRHOST_ResetPinGet( void );
+
+/*** Macros for WDRV_WINC_RESETN pin ***/
+#define WDRV_WINC_RESETN_Set()               HRHOST_ResetPinSet(true)
+#define WDRV_WINC_RESETN_Clear()             HRHOST_ResetPinSet(false)
+#define WDRV_WINC_RESETN_Toggle()            HRHOST_ResetPinSet(!HRHOST_ResetPinGet())
+#define WDRV_WINC_RESETN_OutputEnable()      ((void)0)
+#define WDRV_WINC_RESETN_InputEnable()       ((void)0)
+#define WDRV_WINC_RESETN_Get()               ((uint32_t)HRHOST_ResetPinGet())
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PLIB_PORT_H
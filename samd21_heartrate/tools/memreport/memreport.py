@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+"""Report the memory footprint of a firmware build from its linker map.
+
+The map is the one written by the heartrate.X link with ATSAMD21E18A.ld.
+Every input section placed in the rom or ram region is counted against the
+object file it comes from, the module name is the object file name without
+extension, library members are counted against their archive.
+
+    text    code and constant data in flash
+    data    initialized variables, in RAM and their initial values in flash
+    bss     zeroed and NO_INIT variables, in RAM
+
+The heap and the stack sections are reported apart. The stack headroom is
+the RAM not taken by data, bss and the heap, the stack grows into it.
+
+Usage:
+    memreport.py heartrate.X.production.map [--budgets budgets.ini] [-o report.json]
+
+With --budgets the totals and the modules are checked against the limits of
+the file, see budgets.ini. Exits with status 1 if a budget is exceeded.
+"""
+
+import argparse
+import configparser
+import json
+import os
+import re
+import sys
+
+HEX = r"0x[0-9a-fA-F]+"
+
+REGION_RE = re.compile(r"^(\S+)\s+(%s)\s+(%s)" % (HEX, HEX))
+OUTPUT_RE = re.compile(r"^(\S+)\s+(%s)\s+(%s)" % (HEX, HEX))
+INPUT_RE = re.compile(r"^ (\S+)\s+(%s)\s+(%s)\s+(\S.*)$" % (HEX, HEX))
+INPUT_NAME_RE = re.compile(r"^ (\S+)$")
+INPUT_REST_RE = re.compile(r"^\s+(%s)\s+(%s)\s+(\S.*)$" % (HEX, HEX))
+SYMBOL_RE = re.compile(r"^\s+(%s)\s+([A-Za-z_.$][\w.$]*)\s*$" % HEX)
+ARCHIVE_RE = re.compile(r"([^/\\]+\.a)\(")
+
+# Output sections not loaded into the device
+SKIP_OUTPUT = (".debug", ".comment", ".ARM.attributes", ".stab", ".tlog", ".gnu")
+
+DATA_INPUT = (".data", ".sdata", ".ramfunc")
+HEAP_INPUT = (".heap",)
+STACK_INPUT = (".stack",)
+
+
+class Section:
+    def __init__(self, name, address, size, module):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.module = module
+        self.symbols = []
+        self.kind = None
+
+    def symbol(self):
+        """Name of the variable or function, one per section with
+        -ffunction-sections and -fdata-sections. Static symbols are not
+        listed in the map, the section name holds them."""
+        if len(self.symbols) == 1:
+            return self.symbols[0]
+        for prefix in (".text.", ".rodata.", ".data.", ".bss.", ".ramfunc.", ".no_init."):
+            if self.name.startswith(prefix):
+                return self.name[len(prefix):]
+        return self.name
+
+
+def module_name(path):
+    match = ARCHIVE_RE.search(path)
+    if match:
+        return match.group(1)
+    base = os.path.basename(path.replace("\\", "/"))
+    return os.path.splitext(base)[0] or path
+
+
+def parse_map(path):
+    """Return the memory regions and the input sections of a linker map."""
+    regions = {}
+    sections = []
+    state = None
+    output = None
+    pending = None
+    current = None
+
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\r\n")
+
+            if line.startswith("Memory Configuration"):
+                state = "regions"
+                continue
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            if state == "regions":
+                match = REGION_RE.match(line)
+                if match and match.group(1) != "Name":
+                    regions[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+                continue
+            if state != "map":
+                continue
+
+            if pending is not None:
+                match = INPUT_REST_RE.match(line)
+                if match:
+                    current = Section(pending, int(match.group(1), 16), int(match.group(2), 16),
+                                      module_name(match.group(3)))
+                    sections.append(current)
+                pending = None
+                continue
+
+            if line and not line[0].isspace():
+                output = line.split()[0]
+                current = None
+                # The heap and the stack are reserved by the linker, they have
+                # no input section
+                match = OUTPUT_RE.match(line)
+                if match and output.startswith(HEAP_INPUT + STACK_INPUT):
+                    sections.append(Section(output, int(match.group(2), 16), int(match.group(3), 16),
+                                            "linker"))
+                continue
+
+            if output is None or output.startswith(SKIP_OUTPUT + HEAP_INPUT + STACK_INPUT):
+                continue
+
+            match = INPUT_RE.match(line)
+            if match:
+                current = None
+                if match.group(1) != "*fill*":
+                    current = Section(match.group(1), int(match.group(2), 16), int(match.group(3), 16),
+                                      module_name(match.group(4)))
+                    sections.append(current)
+                continue
+
+            match = INPUT_NAME_RE.match(line)
+            if match and not match.group(1).startswith("*"):
+                pending = match.group(1)
+                continue
+
+            match = SYMBOL_RE.match(line)
+            if match and current is not None and "=" not in line:
+                current.symbols.append(match.group(2))
+
+    return regions, sections
+
+
+def in_region(regions, name, address):
+    if name not in regions:
+        return False
+    origin, length = regions[name]
+    return origin <= address < origin + length
+
+
+def classify(regions, sections):
+    """Set the kind of every section, drop the empty ones and those outside
+    the rom and ram regions."""
+    counted = []
+    for section in sections:
+        if section.size == 0:
+            continue
+        if in_region(regions, "ram", section.address):
+            if section.name.startswith(DATA_INPUT):
+                section.kind = "data"
+            elif section.name.startswith(HEAP_INPUT):
+                section.kind = "heap"
+            elif section.name.startswith(STACK_INPUT):
+                section.kind = "stack"
+            else:
+                section.kind = "bss"
+        elif in_region(regions, "rom", section.address):
+            section.kind = "text"
+        else:
+            continue
+        counted.append(section)
+    return counted
+
+
+def summarize(regions, sections):
+    modules = {}
+    totals = {"text": 0, "data": 0, "bss": 0, "heap": 0, "stack": 0}
+
+    for section in sections:
+        totals[section.kind] += section.size
+        if section.kind in ("heap", "stack"):
+            continue
+        module = modules.setdefault(section.module, {"text": 0, "data": 0, "bss": 0})
+        module[section.kind] += section.size
+
+    rom_size = regions.get("rom", (0, 0))[1]
+    ram_size = regions.get("ram", (0, 0))[1]
+    flash = totals["text"] + totals["data"]
+    ram = totals["data"] + totals["bss"]
+
+    return {
+        "flash": {"used": flash, "size": rom_size},
+        "ram": {"used": ram, "heap": totals["heap"], "stack": totals["stack"], "size": ram_size},
+        "stack_headroom": ram_size - ram - totals["heap"],
+        "modules": modules,
+    }
+
+
+def largest(sections, count):
+    variables = [s for s in sections if s.kind not in ("heap", "stack")]
+    return sorted(variables, key=lambda s: (-s.size, s.symbol()))[:count]
+
+
+def parse_size(text):
+    text = text.strip().upper()
+    if text.endswith("K"):
+        return int(text[:-1], 0) * 1024
+    return int(text, 0)
+
+
+def check_budgets(path, report):
+    """Return the list of the exceeded budgets."""
+    budgets = configparser.ConfigParser(inline_comment_prefixes=("#", ";"))
+    budgets.optionxform = str
+    if not budgets.read(path):
+        raise OSError("cannot read %s" % path)
+
+    failures = []
+    checks = []
+
+    if budgets.has_section("total"):
+        total = budgets["total"]
+        if "flash" in total:
+            checks.append(("flash", report["flash"]["used"], parse_size(total["flash"]), False))
+        if "ram" in total:
+            checks.append(("ram", report["ram"]["used"], parse_size(total["ram"]), False))
+        if "stack_headroom" in total:
+            checks.append(("stack headroom", report["stack_headroom"],
+                           parse_size(total["stack_headroom"]), True))
+
+    for kind in ("flash", "ram"):
+        if not budgets.has_section(kind):
+            continue
+        for name, limit in budgets[kind].items():
+            module = report["modules"].get(name, {"text": 0, "data": 0, "bss": 0})
+            if kind == "flash":
+                used = module["text"] + module["data"]
+            else:
+                used = module["data"] + module["bss"]
+            checks.append(("%s %s" % (name, kind), used, parse_size(limit), False))
+
+    print()
+    print("%-32s %8s %8s" % ("budget", "used", "limit"))
+    for name, used, limit, minimum in checks:
+        exceeded = used < limit if minimum else used > limit
+        print("%-32s %8d %s%7d  %s" % (name, used, ">=" if minimum else "<=", limit,
+                                       "EXCEEDED" if exceeded else "ok"))
+        if exceeded:
+            failures.append(name)
+
+    return failures
+
+
+def print_report(path, report, sections, top):
+    flash = report["flash"]
+    ram = report["ram"]
+
+    print("Memory footprint of %s" % os.path.basename(path))
+    print()
+    print("%-8s %8s %8s %8s" % ("region", "used", "size", "free"))
+    print("%-8s %8d %8d %8d" % ("flash", flash["used"], flash["size"], flash["size"] - flash["used"]))
+    print("%-8s %8d %8d %8d" % ("ram", ram["used"], ram["size"], ram["size"] - ram["used"]))
+    print("heap %d bytes, stack section %d bytes, stack headroom %d bytes" % (
+        ram["heap"], ram["stack"], report["stack_headroom"]))
+
+    print()
+    print("%-28s %8s %8s %8s" % ("module", "text", "data", "bss"))
+    modules = report["modules"]
+    for name in sorted(modules, key=lambda n: (-(modules[n]["data"] + modules[n]["bss"]),
+                                               -modules[n]["text"], n)):
+        module = modules[name]
+        print("%-28s %8d %8d %8d" % (name, module["text"], module["data"], module["bss"]))
+
+    print()
+    print("%-8s %-6s %-32s %s" % ("size", "kind", "symbol", "module"))
+    for section in largest(sections, top):
+        print("%-8d %-6s %-32s %s" % (section.size, section.kind, section.symbol(), section.module))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("map", help="linker map of the firmware build")
+    parser.add_argument("--budgets", help="budget file, see budgets.ini")
+    parser.add_argument("--top", type=int, default=20, help="number of symbols listed")
+    parser.add_argument("-o", "--output", help="also write the report as JSON")
+    args = parser.parse_args()
+
+    regions, sections = parse_map(args.map)
+    if "rom" not in regions or "ram" not in regions:
+        print("%s: no rom and ram regions in the memory configuration" % args.map, file=sys.stderr)
+        return 2
+
+    sections = classify(regions, sections)
+    report = summarize(regions, sections)
+    report["top"] = [{"symbol": s.symbol(), "module": s.module, "kind": s.kind, "size": s.size}
+                     for s in largest(sections, args.top)]
+
+    print_report(args.map, report, sections, args.top)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(report, f, indent=1, sort_keys=True)
+            f.write("\n")
+
+    if args.budgets:
+        failures = check_budgets(args.budgets, report)
+        if failures:
+            print()
+            print("%d budget(s) exceeded: %s" % (len(failures), ", ".join(failures)))
+            return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Summarize the -fstack-usage files of a firmware build.
+
+The heartrate.X C compile writes a .su file next to every object file, one
+line per function with the size of its stack frame and its kind:
+
+    static           fixed frame size
+    dynamic,bounded  the frame grows at run time up to the size shown
+    dynamic          the frame grows at run time without a known bound
+
+The summary lists the largest frames, the functions with a dynamic frame
+and the largest frame of every module. Frames are per function, the depth
+of a call chain is their sum. The "stack" command of the firmware reports
+the measured high-water mark, every interrupt nested on top of the super
+loop adds its handler frames and 32 bytes pushed by the exception entry.
+
+Usage:
+    stackusage.py build/default/production [--top 20]
+"""
+
+import argparse
+import os
+import sys
+
+
+class Frame:
+    def __init__(self, function, location, size, kind, module):
+        self.function = function
+        self.location = location
+        self.size = size
+        self.kind = kind
+        self.module = module
+
+
+def parse_su(path):
+    """Return the frames of one .su file."""
+    module = os.path.splitext(os.path.basename(path))[0]
+    frames = []
+    with open(path, errors="replace") as f:
+        for line in f:
+            fields = line.rstrip("\r\n").split("\t")
+            if len(fields) < 3:
+                continue
+            location, _, function = fields[0].rpartition(":")
+            try:
+                size = int(fields[1])
+            except ValueError:
+                continue
+            frames.append(Frame(function, location, size, fields[2], module))
+    return frames
+
+
+def find_su(root):
+    for directory, _, files in os.walk(root):
+        for name in sorted(files):
+            if name.endswith(".su"):
+                yield os.path.join(directory, name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("build", help="object directory of the build, searched for .su files")
+    parser.add_argument("--top", type=int, default=20, help="number of frames listed")
+    args = parser.parse_args()
+
+    frames = []
+    for path in find_su(args.build):
+        frames.extend(parse_su(path))
+
+    if not frames:
+        print("%s: no .su files, build with -fstack-usage" % args.build, file=sys.stderr)
+        return 2
+
+    print("%d functions" % len(frames))
+    print()
+    print("%6s %-16s %-32s %s" % ("bytes", "kind", "function", "module"))
+    for frame in sorted(frames, key=lambda f: (-f.size, f.function))[:args.top]:
+        print("%6d %-16s %-32s %s" % (frame.size, frame.kind, frame.function, frame.module))
+
+    dynamic = [f for f in frames if f.kind.startswith("dynamic")]
+    if dynamic:
+        print()
+        print("dynamic frames")
+        for frame in sorted(dynamic, key=lambda f: (f.kind, -f.size)):
+            print("%6d %-16s %-32s %s" % (frame.size, frame.kind, frame.function, frame.location))
+
+    largest = {}
+    for frame in frames:
+        if frame.module not in largest or frame.size > largest[frame.module].size:
+            largest[frame.module] = frame
+
+    print()
+    print("%-28s %6s  %s" % ("module", "bytes", "largest frame"))
+    for module in sorted(largest, key=lambda m: (-largest[m].size, m)):
+        print("%-28s %6d  %s" % (module, largest[module].size, largest[module].function))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
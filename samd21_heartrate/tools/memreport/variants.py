@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Compare the flash, RAM and benchmark cycles of the build configurations.
+
+heartrate.X has one configuration per optimization choice:
+
+    default  -O1
+    size     -Os with link time optimization
+    speed    -O2 with link time optimization
+    mixed    -Os, drv_heartrate.c and plib_sercom0_usart.c at -O2
+
+The production map of every configuration found in the dist directory is
+read with memreport.py. Benchmark cycles come from the console output of
+"bench run", captured once per configuration on the target and given with
+--bench. Changes are relative to the baseline configuration.
+
+Usage:
+    variants.py dist [--baseline default] [--bench size=size.txt ...]
+
+The cycle counts depend on the flash wait states of the CPU clock, the
+captures should be taken at the same clock, a note is printed otherwise.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+import memreport
+
+BENCH_CPU_RE = re.compile(r"cpu (\d+) MHz")
+BENCH_ROW_RE = re.compile(r"^(\S+)\s+(\d+|-)\s+(\d+|-)\s+(\d+|-)")
+
+
+def load_map(dist, conf):
+    path = os.path.join(dist, conf, "production", "heartrate.X.production.map")
+    if not os.path.exists(path):
+        return None
+    regions, sections = memreport.parse_map(path)
+    return memreport.summarize(regions, memreport.classify(regions, sections))
+
+
+def load_bench(path):
+    """Return the CPU clock and the average cycles by benchmark of a
+    "bench run" capture."""
+    cpu = None
+    results = {}
+    in_table = False
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            match = BENCH_CPU_RE.search(line)
+            if match:
+                cpu = int(match.group(1))
+                continue
+            if line.startswith("benchmark"):
+                in_table = True
+                continue
+            match = BENCH_ROW_RE.match(line)
+            if in_table and match:
+                if match.group(3) != "-":
+                    results[match.group(1)] = int(match.group(3))
+            elif in_table and line:
+                in_table = False
+    return cpu, results
+
+
+def change(new, old):
+    if old is None or new is None:
+        return "-"
+    if old == 0:
+        return "%+d" % (new - old)
+    return "%+.1f%%" % ((new - old) * 100.0 / old)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("dist", help="dist directory of heartrate.X")
+    parser.add_argument("--baseline", default="default", help="configuration compared against")
+    parser.add_argument("--bench", action="append", default=[], metavar="CONF=FILE",
+                        help="'bench run' console capture of a configuration")
+    args = parser.parse_args()
+
+    confs = sorted(c for c in os.listdir(args.dist) if load_map(args.dist, c) is not None)
+    if args.baseline not in confs:
+        print("%s: no map of the baseline configuration %s" % (args.dist, args.baseline),
+              file=sys.stderr)
+        return 2
+    confs.remove(args.baseline)
+    confs.insert(0, args.baseline)
+
+    reports = {conf: load_map(args.dist, conf) for conf in confs}
+    base = reports[args.baseline]
+
+    print("%-10s %8s %8s %8s %8s %9s" % ("conf", "flash", "change", "ram", "change", "headroom"))
+    for conf in confs:
+        report = reports[conf]
+        flash = report["flash"]["used"]
+        ram = report["ram"]["used"]
+        if conf == args.baseline:
+            flash_change = ram_change = "-"
+        else:
+            flash_change = change(flash, base["flash"]["used"])
+            ram_change = change(ram, base["ram"]["used"])
+        print("%-10s %8d %8s %8d %8s %9d" % (conf, flash, flash_change, ram, ram_change,
+                                            report["stack_headroom"]))
+
+    benches = {}
+    for item in args.bench:
+        conf, _, path = item.partition("=")
+        benches[conf] = load_bench(path)
+    if not benches:
+        return 0
+
+    clocks = set(cpu for cpu, _ in benches.values() if cpu is not None)
+    if len(clocks) > 1:
+        print()
+        print("note: captures taken at %s MHz, cycles differ by the flash wait states" % (
+            ", ".join(str(c) for c in sorted(clocks))))
+
+    bench_confs = [c for c in confs if c in benches] + sorted(set(benches) - set(confs))
+    baseline = benches.get(args.baseline, (None, {}))[1]
+    names = sorted(set(n for _, results in benches.values() for n in results))
+
+    print()
+    print("%-16s" % "avg cycles" + "".join(" %16s" % conf for conf in bench_confs))
+    for name in names:
+        row = "%-16s" % name
+        for conf in bench_confs:
+            cycles = benches[conf][1].get(name)
+            if cycles is None:
+                row += " %16s" % "-"
+            elif conf == args.baseline or name not in baseline:
+                row += " %16d" % cycles
+            else:
+                row += " %8d %7s" % (cycles, change(cycles, baseline[name]))
+        print(row)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Decode SYS_TLOG records captured from the console UART.
+
+The firmware sends the address of each log format string instead of the
+string itself. The strings are kept in the .tlog section of the ELF file,
+which is not programmed into the device. This tool reads that section and
+turns a raw console capture back into text. Plain console output passes
+through unchanged.
+
+Usage:
+    tlog_decode.py firmware.elf capture.bin
+    tlog_decode.py firmware.elf - < /dev/ttyACM0
+
+See system/tlog/sys_tlog.h for the record format.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_MARKER = 0xFE
+DROPPED_MARKER = 0xFD
+
+# printf conversions supported by SYS_TLOG, mapped to Python % formatting
+SPEC_RE = re.compile(r"%([-0]*)(\d*)(?:hh|h|l|z)?([diuxXcp%])")
+
+
+def load_tlog_section(path):
+    """Return (address, bytes) of the .tlog section of an ELF file."""
+    with open(path, "rb") as f:
+        elf = f.read()
+
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+
+    is64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+
+    if is64:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3A)
+        shdr = endian + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2E)
+        shdr = endian + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(shdr, elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    strtab_data = elf[strtab[4]:strtab[4] + strtab[5]]
+
+    for name, _type, _flags, addr, offset, size in (s[:6] for s in sections):
+        end = strtab_data.index(b"\0", name)
+        if strtab_data[name:end] == b".tlog":
+            return addr, elf[offset:offset + size]
+
+    raise ValueError("%s has no .tlog section" % path)
+
+
+def read_varint(payload, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = payload[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, pos
+
+
+def format_record(fmt, args):
+    """Apply a printf format to 32 bit unsigned arguments."""
+    args = list(args)
+
+    def convert(match):
+        flags, width, conv = match.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if conv in "di":
+            if value & 0x80000000:
+                value -= 1 << 32
+            conv = "d"
+        elif conv == "u":
+            conv = "d"
+        elif conv == "p":
+            return "0x%x" % value
+        elif conv == "c":
+            value = chr(value & 0xFF)
+        return ("%" + flags + width + conv) % value
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+class Decoder:
+    def __init__(self, tlog_addr, tlog_data, out):
+        self.addr = tlog_addr
+        self.data = tlog_data
+        self.out = out
+        self.at_line_start = True
+        self.pending = bytearray()
+
+    def string(self, string_id):
+        offset = string_id - self.addr
+        if offset < 0 or offset >= len(self.data):
+            return None
+        end = self.data.find(b"\0", offset)
+        return self.data[offset:end].decode("latin-1")
+
+    def line(self, text):
+        if not self.at_line_start:
+            self.out.write("\n")
+        self.out.write(text + "\n")
+        self.at_line_start = True
+
+    def record(self, marker, payload):
+        try:
+            value, pos = read_varint(payload, 0)
+            if marker == DROPPED_MARKER:
+                self.line("<tlog: %d records lost>" % value)
+                return
+            args = []
+            while pos < len(payload):
+                arg, pos = read_varint(payload, pos)
+                args.append(arg)
+        except IndexError:
+            self.line("<tlog: malformed record %s>" % payload.hex())
+            return
+
+        fmt = self.string(value)
+        if fmt is None:
+            self.line("<tlog: unknown id 0x%x %s>" % (value, args))
+        else:
+            self.line(format_record(fmt, args).rstrip("\r\n"))
+
+    def decode(self, final):
+        data = self.pending
+        pos = 0
+        while pos < len(data):
+            byte = data[pos]
+            if byte in (RECORD_MARKER, DROPPED_MARKER):
+                complete = pos + 1 < len(data) and pos + 2 + data[pos + 1] <= len(data)
+                if not complete and not final:
+                    # Keep the partial record for the next read
+                    break
+                if pos + 1 < len(data):
+                    length = data[pos + 1]
+                    self.record(byte, bytes(data[pos + 2:pos + 2 + length]))
+                    pos += 2 + length
+                    continue
+            end = pos + 1
+            while end < len(data) and data[end] not in (RECORD_MARKER, DROPPED_MARKER):
+                end += 1
+            text = data[pos:end].decode("latin-1")
+            self.out.write(text)
+            self.at_line_start = text.endswith("\n")
+            pos = end
+        del data[:pos]
+
+    def feed(self, stream):
+        # read1 returns what has arrived so far, a live UART is decoded as
+        # it runs instead of at an end of file that never comes
+        while True:
+            chunk = stream.read1(4096)
+            if not chunk:
+                break
+            self.pending += chunk
+            self.decode(final=False)
+            self.out.flush()
+        self.decode(final=True)
+        self.out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("elf", help="firmware ELF file the capture was produced with")
+    parser.add_argument("capture", help="raw console capture, '-' for stdin")
+    args = parser.parse_args()
+
+    addr, data = load_tlog_section(args.elf)
+    decoder = Decoder(addr, data, sys.stdout)
+
+    if args.capture == "-":
+        decoder.feed(sys.stdin.buffer)
+    else:
+        with open(args.capture, "rb") as f:
+            decoder.feed(f)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())